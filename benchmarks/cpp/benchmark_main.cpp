@@ -2,8 +2,21 @@
 #include <gtest/gtest.h>
 
 #include "benchmarks/cpp/bench.h"
+#include "benchmarks/cpp/flatbuffers/bench_generated.h"
 #include "benchmarks/cpp/flatbuffers/fb_bench.h"
+#include "benchmarks/cpp/flatbuffers/reference_text.h"
 #include "benchmarks/cpp/raw/raw_bench.h"
+#include "include/flatbuffers/idl.h"
+#include "include/flatbuffers/minireflect.h"
+#include "include/flatbuffers/reflection.h"
+#include "include/flatbuffers/util.h"
+
+// The static reflection benchmarks need C++17.
+#if ((__cplusplus >= 201703L) || \
+     (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L)))
+  #define FLATBUFFERS_BENCH_STATIC_REFLECTION 1
+  #include "generated_cpp17/monster_test_generated.h"
+#endif
 
 static inline void Encode(benchmark::State &state,
                           std::unique_ptr<Bench> &bench, uint8_t *buffer) {
@@ -68,6 +81,323 @@ static void BM_Flatbuffers_Use(benchmark::State &state) {
 }
 BENCHMARK(BM_Flatbuffers_Use);
 
+static inline void TextGen(benchmark::State &state, bool shortest_floats,
+                           bool reference_printer = false) {
+  std::string schema;
+  ASSERT_TRUE(flatbuffers::LoadFile(FLATBUFFERS_BENCH_FBS, false, &schema));
+  flatbuffers::Parser parser;
+  ASSERT_TRUE(parser.Parse(schema.c_str()));
+  parser.opts.json_shortest_floats = shortest_floats;
+  const auto gen_text = reference_printer ? flatbuffers::reference::GenText
+                                          : flatbuffers::GenText;
+
+  flatbuffers::FlatBufferBuilder fbb;
+  EncodeLargeFooBarContainer(fbb, 10000);
+
+  std::string json;
+  for (auto _ : state) {
+    // Reuse the capacity of the previous iteration, as a converter would.
+    json.clear();
+    auto err = gen_text(parser, fbb.GetBufferPointer(), &json);
+    EXPECT_TRUE(err == nullptr);
+    benchmark::DoNotOptimize(json.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(json.size()));
+}
+
+static void BM_Flatbuffers_GenText(benchmark::State &state) {
+  TextGen(state, false);
+}
+BENCHMARK(BM_Flatbuffers_GenText);
+
+static void BM_Flatbuffers_GenText_ShortestFloats(benchmark::State &state) {
+  TextGen(state, true);
+}
+BENCHMARK(BM_Flatbuffers_GenText_ShortestFloats);
+
+// The same text, printed without the fast paths, as the baseline for the two
+// above.
+static void BM_Flatbuffers_GenText_Reference(benchmark::State &state) {
+  TextGen(state, false, true);
+}
+BENCHMARK(BM_Flatbuffers_GenText_Reference);
+
+static inline void JsonParse(benchmark::State &state, bool table_parser) {
+  std::string schema;
+  ASSERT_TRUE(flatbuffers::LoadFile(FLATBUFFERS_BENCH_FBS, false, &schema));
+  flatbuffers::Parser parser;
+  ASSERT_TRUE(parser.Parse(schema.c_str()));
+
+  flatbuffers::FlatBufferBuilder fbb;
+  EncodeLargeFooBarContainer(fbb, 10000);
+  std::string json;
+  ASSERT_TRUE(flatbuffers::GenText(parser, fbb.GetBufferPointer(), &json) ==
+              nullptr);
+
+  flatbuffers::JsonTableParser fast(parser);
+  for (auto _ : state) {
+    bool ok = table_parser ? fast.Parse(json.c_str())
+                           : parser.ParseJson(json.c_str());
+    EXPECT_TRUE(ok);
+    benchmark::DoNotOptimize(parser.builder_.GetBufferPointer());
+  }
+  EXPECT_FALSE(table_parser && fast.used_fallback());
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(json.size()));
+}
+
+static void BM_Flatbuffers_ParseJson(benchmark::State &state) {
+  JsonParse(state, false);
+}
+BENCHMARK(BM_Flatbuffers_ParseJson);
+
+static void BM_Flatbuffers_ParseJson_TableParser(benchmark::State &state) {
+  JsonParse(state, true);
+}
+BENCHMARK(BM_Flatbuffers_ParseJson_TableParser);
+
+// Builds a schema of `tables` tables spread over a number of nested
+// namespaces, with fields referencing tables in both the current and other
+// namespaces, so parsing is dominated by type resolution.
+static std::string MakeSchemaCorpus(int tables, int namespaces) {
+  const int per_ns = tables / namespaces;
+  std::string schema;
+  for (int n = 0; n < namespaces; n++) {
+    const std::string mod = std::to_string(n);
+    schema += "namespace corp.area" + std::to_string(n % 7) + ".mod" + mod +
+              ";\n";
+    schema += "enum Kind" + mod + " : ubyte { A, B, C, D }\n";
+    schema += "struct Vec" + mod + " { x: float; y: float; z: float; }\n";
+    for (int t = 0; t < per_ns; t++) {
+      const int id = n * per_ns + t;
+      schema += "table T" + std::to_string(id) + " {\n";
+      schema += "  name: string (key);\n  kind: Kind" + mod + " = B;\n";
+      schema += "  pos: Vec" + mod + ";\n  count: int = 7 (deprecated);\n";
+      for (int f = 0; f < 6; f++) {
+        const int ref = (id * 31 + f * 17) % (id + 1);
+        const int rn = ref / per_ns;
+        std::string type = "T" + std::to_string(ref);
+        if (rn != n) {
+          type = "corp.area" + std::to_string(rn % 7) + ".mod" +
+                 std::to_string(rn) + "." + type;
+        }
+        schema += "  f" + std::to_string(f) + ": " +
+                  (f % 2 ? "[" + type + "]" : type) + ";\n";
+      }
+      schema += "}\n";
+    }
+  }
+  schema += "root_type corp.area0.mod0.T0;\n";
+  return schema;
+}
+
+static void BM_Flatbuffers_ParseSchema(benchmark::State &state) {
+  const std::string schema = MakeSchemaCorpus(3000, 60);
+  for (auto _ : state) {
+    flatbuffers::Parser parser;
+    EXPECT_TRUE(parser.Parse(schema.c_str()));
+    benchmark::DoNotOptimize(parser.structs_.vec.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(schema.size()));
+}
+BENCHMARK(BM_Flatbuffers_ParseSchema);
+
+// Verifies the inline fields of the Monster root table of monster_test, as
+// listed by its binary schema, either with a VerifyField() check per field or
+// with one VerifyInlineFields() call, as generated Verify() functions do.
+static inline void VerifyInline(benchmark::State &state, bool fused) {
+  std::string bfbs;
+  std::string data;
+  ASSERT_TRUE(flatbuffers::LoadFile(FLATBUFFERS_MONSTER_BFBS, true, &bfbs));
+  ASSERT_TRUE(flatbuffers::LoadFile(FLATBUFFERS_MONSTER_DATA, true, &data));
+  const auto schema = reflection::GetSchema(bfbs.data());
+  std::vector<flatbuffers::InlineField> fields;
+  for (const auto field : *schema->root_table()->fields()) {
+    const auto base_type = field->type()->base_type();
+    flatbuffers::InlineField f = { field->offset(), 0, 0 };
+    if (flatbuffers::IsScalar(base_type)) {
+      const auto size = flatbuffers::GetTypeSize(base_type);
+      f.size = f.align = static_cast<flatbuffers::voffset_t>(size);
+    } else if (base_type == reflection::Obj &&
+               schema->objects()->Get(field->type()->index())->is_struct()) {
+      const auto obj = schema->objects()->Get(field->type()->index());
+      f.size = static_cast<flatbuffers::voffset_t>(obj->bytesize());
+      f.align = static_cast<flatbuffers::voffset_t>(obj->minalign());
+    } else {
+      continue;
+    }
+    if (!field->deprecated()) fields.push_back(f);
+  }
+
+  const auto buf = reinterpret_cast<const uint8_t *>(data.data());
+  const auto table = flatbuffers::GetAnyRoot(buf);
+  const auto table_data = reinterpret_cast<const uint8_t *>(table);
+  for (auto _ : state) {
+    flatbuffers::Verifier verifier(buf, data.size());
+    bool ok = table->VerifyTableStart(verifier);
+    if (fused) {
+      ok = ok && verifier.VerifyInlineFields(table_data, fields.data(),
+                                             fields.size());
+    } else {
+      for (const auto &f : fields) {
+        const auto field_offset = table->GetOptionalFieldOffset(f.field);
+        ok = ok && (!field_offset ||
+                    verifier.VerifyFieldStruct(table_data, field_offset,
+                                               f.size, f.align));
+      }
+    }
+    EXPECT_TRUE(ok);
+    benchmark::DoNotOptimize(ok);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(fields.size()));
+}
+
+static void BM_Flatbuffers_VerifyInlineFields_PerField(
+    benchmark::State &state) {
+  VerifyInline(state, false);
+}
+BENCHMARK(BM_Flatbuffers_VerifyInlineFields_PerField);
+
+static void BM_Flatbuffers_VerifyInlineFields_Fused(benchmark::State &state) {
+  VerifyInline(state, true);
+}
+BENCHMARK(BM_Flatbuffers_VerifyInlineFields_Fused);
+
+// Builds vectors of 1M strings or structs into a builder that is reused, so
+// the runs measure the CreateVector*() overloads rather than allocation.
+static const size_t kVectorBenchSize = 1000000;
+
+static inline void CreateStrings(benchmark::State &state, bool from_span) {
+  std::vector<std::string> strings;
+  for (size_t i = 0; i < kVectorBenchSize; i++) {
+    strings.push_back("string" + std::to_string(i));
+  }
+  flatbuffers::FlatBufferBuilder builder;
+  for (auto _ : state) {
+    builder.Clear();
+    const auto vec =
+        from_span ? builder.CreateVectorOfStrings(
+                        flatbuffers::span<const std::string>(strings.data(),
+                                                             strings.size()))
+                  : builder.CreateVectorOfStrings(strings.cbegin(),
+                                                  strings.cend());
+    benchmark::DoNotOptimize(vec);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(kVectorBenchSize));
+}
+
+static void BM_Flatbuffers_CreateVectorOfStrings_Iterators(
+    benchmark::State &state) {
+  CreateStrings(state, false);
+}
+BENCHMARK(BM_Flatbuffers_CreateVectorOfStrings_Iterators);
+
+static void BM_Flatbuffers_CreateVectorOfStrings_Span(benchmark::State &state) {
+  CreateStrings(state, true);
+}
+BENCHMARK(BM_Flatbuffers_CreateVectorOfStrings_Span);
+
+static inline void CreateStructs(benchmark::State &state, bool from_span) {
+  using benchmarks_flatbuffers::Bar;
+  using benchmarks_flatbuffers::Foo;
+  std::vector<Bar> bars;
+  for (size_t i = 0; i < kVectorBenchSize; i++) {
+    const auto n = static_cast<int>(i);
+    bars.push_back(Bar(Foo(i, static_cast<int16_t>(n), 1, 2), n, 0.5f, 3));
+  }
+  flatbuffers::FlatBufferBuilder builder;
+  for (auto _ : state) {
+    builder.Clear();
+    const auto vec =
+        from_span
+            ? builder.CreateVectorOfStructs(
+                  flatbuffers::span<const Bar>(bars.data(), bars.size()))
+            : builder.CreateVectorOfStructs<Bar>(
+                  bars.size(), [&](size_t i, Bar *bar) { *bar = bars[i]; });
+    benchmark::DoNotOptimize(vec);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(kVectorBenchSize));
+}
+
+static void BM_Flatbuffers_CreateVectorOfStructs_Filler(
+    benchmark::State &state) {
+  CreateStructs(state, false);
+}
+BENCHMARK(BM_Flatbuffers_CreateVectorOfStructs_Filler);
+
+static void BM_Flatbuffers_CreateVectorOfStructs_Span(benchmark::State &state) {
+  CreateStructs(state, true);
+}
+BENCHMARK(BM_Flatbuffers_CreateVectorOfStructs_Span);
+
+#ifdef FLATBUFFERS_BENCH_STATIC_REFLECTION
+// Prints a Monster of monster_test with FlatBufferToString, either through its
+// mini reflection TypeTable or through the traits generated by
+// --cpp-static-reflection. Its vectors hold plain numbers, as the huge doubles
+// of monsterdata_test would dominate the run.
+static inline void MiniReflectToString(benchmark::State &state,
+                                       bool static_reflection) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<uint8_t> inventory;
+  std::vector<int64_t> longs;
+  std::vector<double> doubles;
+  for (int i = 0; i < 64; i++) {
+    inventory.push_back(static_cast<uint8_t>(i));
+    longs.push_back(static_cast<int64_t>(i) * 1000003);
+    doubles.push_back(i * 0.37);
+  }
+  const std::vector<std::string> strings = { "alpha", "beta", "gamma" };
+  const MyGame::Example::Vec3 pos(1.0f, 2.0f, 3.0f, 3.5,
+                                 MyGame::Example::Color::Green,
+                                 MyGame::Example::Test(5, 6));
+  const auto name = fbb.CreateString("MyMonster");
+  const auto inventory_vec = fbb.CreateVector(inventory);
+  const auto strings_vec = fbb.CreateVectorOfStrings(strings);
+  const auto longs_vec = fbb.CreateVector(longs);
+  const auto doubles_vec = fbb.CreateVector(doubles);
+  MyGame::Example::MonsterBuilder builder(fbb);
+  builder.add_pos(&pos);
+  builder.add_hp(80);
+  builder.add_name(name);
+  builder.add_inventory(inventory_vec);
+  builder.add_testarrayofstring(strings_vec);
+  builder.add_testf(3.25f);
+  builder.add_vector_of_longs(longs_vec);
+  builder.add_vector_of_doubles(doubles_vec);
+  fbb.Finish(builder.Finish());
+
+  size_t size = 0;
+  for (auto _ : state) {
+    const auto text =
+        static_reflection
+            ? flatbuffers::FlatBufferToString<MyGame::Example::Monster>(
+                  fbb.GetBufferPointer())
+            : flatbuffers::FlatBufferToString(
+                  fbb.GetBufferPointer(),
+                  MyGame::Example::Monster::MiniReflectTypeTable());
+    size = text.size();
+    benchmark::DoNotOptimize(text.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(size));
+}
+
+static void BM_Flatbuffers_MiniReflectToString(benchmark::State &state) {
+  MiniReflectToString(state, false);
+}
+BENCHMARK(BM_Flatbuffers_MiniReflectToString);
+
+static void BM_Flatbuffers_MiniReflectToString_Static(benchmark::State &state) {
+  MiniReflectToString(state, true);
+}
+BENCHMARK(BM_Flatbuffers_MiniReflectToString_Static);
+#endif  // FLATBUFFERS_BENCH_STATIC_REFLECTION
+
 static void BM_Raw_Encode(benchmark::State &state) {
   const int64_t kBufferLength = 1024;
   uint8_t buffer[kBufferLength];
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "benchmarks/cpp/bench.h"
 #include "benchmarks/cpp/flatbuffers/bench_generated.h"
@@ -78,3 +79,21 @@ std::unique_ptr<Bench> NewFlatBuffersBench(int64_t initial_size,
   return std::unique_ptr<FlatBufferBench>(
       new FlatBufferBench(initial_size, allocator));
 }
+
+void EncodeLargeFooBarContainer(FlatBufferBuilder &fbb, int count) {
+  fbb.Clear();
+  std::vector<Offset<FooBar>> vec;
+  vec.reserve(static_cast<size_t>(count));
+  for (int i = 0; i < count; ++i) {
+    Foo foo(0xABADCAFEABADCAFE + i, 10000 + i % 1000, '@' + i % 64,
+            1000000 + i);
+    Bar bar(foo, 123456 + i, 3.14159f + i, 10000 + i % 1000);
+    auto name = fbb.CreateString("Hello, \"World\"!");
+    vec.push_back(
+        CreateFooBar(fbb, &bar, name, 3.1415432432445543543 + i, '!' + i % 64));
+  }
+  auto location = fbb.CreateString("http://google.com/flatbuffers/");
+  auto foobarvec = fbb.CreateVector(vec);
+  fbb.Finish(
+      CreateFooBarContainer(fbb, foobarvec, true, Enum_Bananas, location));
+}
@@ -20,4 +20,9 @@ struct StaticAllocator : public flatbuffers::Allocator {
 std::unique_ptr<Bench> NewFlatBuffersBench(
     int64_t initial_size = 1024, flatbuffers::Allocator *allocator = nullptr);
 
+// Finishes a FooBarContainer with `count` list entries into `fbb`, used for
+// the throughput benchmarks that need more than the 3 entries above.
+void EncodeLargeFooBarContainer(flatbuffers::FlatBufferBuilder &fbb,
+                                int count);
+
 #endif  // BENCHMARKS_CPP_FLATBUFFERS_FB_BENCH_H_
\ No newline at end of file
@@ -0,0 +1,20 @@
+#ifndef BENCHMARKS_CPP_FLATBUFFERS_REFERENCE_TEXT_H_
+#define BENCHMARKS_CPP_FLATBUFFERS_REFERENCE_TEXT_H_
+
+#include <string>
+
+#include "include/flatbuffers/idl.h"
+
+namespace flatbuffers {
+namespace reference {
+
+// Like flatbuffers::GenText, printed the way it was before the fast paths
+// of the text generator. The text is the same; this is the baseline the
+// text benchmarks compare against.
+const char *GenText(const Parser &parser, const void *flatbuffer,
+                    std::string *text);
+
+}  // namespace reference
+}  // namespace flatbuffers
+
+#endif  // BENCHMARKS_CPP_FLATBUFFERS_REFERENCE_TEXT_H_
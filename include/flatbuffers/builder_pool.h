@@ -0,0 +1,201 @@
+/*
+ * Copyright 2024 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_BUILDER_POOL_H_
+#define FLATBUFFERS_BUILDER_POOL_H_
+
+#include <algorithm>
+#include <mutex>
+
+#include "flatbuffers/allocator.h"
+#include "flatbuffers/base.h"
+#include "flatbuffers/flatbuffer_builder.h"
+
+namespace flatbuffers {
+
+// BuilderPool is an Allocator that keeps the buffers of finished builders
+// around for the next ones, so a server building a message per request
+// doesn't have to go to the heap for each one. It can be shared between
+// threads.
+//
+// Builders made by NewBuilder() start out at the size of recent large
+// messages, so they rarely have to grow. When such a builder is released, the
+// DetachedBuffer it returns gives its memory back to the pool when it is
+// destroyed. The pool must outlive all the builders and buffers that use it.
+//
+// Buffers are kept in power of two size classes between `min_block_size` and
+// `max_block_size`; larger ones are allocated and freed as usual. At most
+// `max_cached_bytes` are kept, and Trim() frees the ones that have been idle
+// since the previous Trim(), so calling it periodically gives back what a
+// burst of large messages left behind.
+class BuilderPool : public Allocator {
+ public:
+  explicit BuilderPool(size_t min_block_size = 1024,
+                       size_t max_block_size = 16 * 1024 * 1024,
+                       size_t max_cached_bytes = 64 * 1024 * 1024)
+      : min_block_size_(min_block_size),
+        num_classes_(1),
+        max_cached_bytes_(max_cached_bytes),
+        cached_bytes_(0),
+        recent_size_(min_block_size) {
+    FLATBUFFERS_ASSERT(min_block_size >= sizeof(Block));
+    while (num_classes_ < kMaxClasses &&
+           ClassSize(num_classes_ - 1) < max_block_size) {
+      num_classes_++;
+    }
+  }
+
+  ~BuilderPool() FLATBUFFERS_OVERRIDE {
+    for (size_t k = 0; k < num_classes_; k++) {
+      while (classes_[k].free) delete[] Pop(k);
+    }
+  }
+
+  // A builder that allocates from this pool.
+  template<bool Is64Aware = false>
+  FlatBufferBuilderImpl<Is64Aware> NewBuilder() {
+    return FlatBufferBuilderImpl<Is64Aware>(InitialSize(), this);
+  }
+
+  // The size new builders start at. It goes up to the size a builder had to
+  // grow to, and decays as messages are finished that fit.
+  size_t InitialSize() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const size_t k = ClassOf(recent_size_);
+    return k == kNoClass ? recent_size_ : ClassSize(k);
+  }
+
+  // Frees the buffers that weren't needed since the previous call.
+  void Trim() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t k = 0; k < num_classes_; k++) {
+      auto &c = classes_[k];
+      for (size_t idle = c.idle; idle > 0; idle--) {
+        delete[] Pop(k);
+        cached_bytes_ -= ClassSize(k);
+      }
+      c.idle = c.count;
+    }
+  }
+
+  // The total size of the buffers kept for reuse.
+  size_t cached_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cached_bytes_;
+  }
+
+  uint8_t *allocate(size_t size) FLATBUFFERS_OVERRIDE {
+    const size_t k = ClassOf(size);
+    if (k == kNoClass) return new uint8_t[size];
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (classes_[k].free) {
+        cached_bytes_ -= ClassSize(k);
+        return Pop(k);
+      }
+    }
+    return new uint8_t[ClassSize(k)];
+  }
+
+  // Called for a finished buffer, either by its builder or by the
+  // DetachedBuffer it was released as.
+  void deallocate(uint8_t *p, size_t size) FLATBUFFERS_OVERRIDE {
+    std::lock_guard<std::mutex> lock(mutex_);
+    recent_size_ = (std::max)(recent_size_ - recent_size_ / 16,
+                              min_block_size_);
+    Recycle(p, size);
+  }
+
+  uint8_t *reallocate_downward(uint8_t *old_p, size_t old_size,
+                               size_t new_size, size_t in_use_back,
+                               size_t in_use_front) FLATBUFFERS_OVERRIDE {
+    FLATBUFFERS_ASSERT(new_size > old_size);  // vector_downward only grows
+    uint8_t *new_p = allocate(new_size);
+    memcpy_downward(old_p, old_size, new_p, new_size, in_use_back,
+                    in_use_front);
+    std::lock_guard<std::mutex> lock(mutex_);
+    recent_size_ = (std::max)(recent_size_, new_size);
+    Recycle(old_p, old_size);
+    return new_p;
+  }
+
+  // These may change access mode, leave these at end of public section
+  FLATBUFFERS_DELETE_FUNC(BuilderPool(const BuilderPool &other));
+  FLATBUFFERS_DELETE_FUNC(BuilderPool &operator=(const BuilderPool &other));
+
+ private:
+  // Free buffers are linked through their first bytes.
+  struct Block {
+    Block *next;
+  };
+
+  struct SizeClass {
+    SizeClass() : free(nullptr), count(0), idle(0) {}
+    Block *free;
+    size_t count;
+    // The fewest free buffers since the last Trim(), which weren't needed.
+    size_t idle;
+  };
+
+  static const size_t kMaxClasses = sizeof(size_t) * 8;
+  static const size_t kNoClass = ~static_cast<size_t>(0);
+
+  size_t ClassSize(size_t k) const { return min_block_size_ << k; }
+
+  size_t ClassOf(size_t size) const {
+    if (size > ClassSize(num_classes_ - 1)) return kNoClass;
+    size_t k = 0;
+    while (ClassSize(k) < size) k++;
+    return k;
+  }
+
+  // Call with mutex_ held.
+  uint8_t *Pop(size_t k) {
+    auto &c = classes_[k];
+    Block *block = c.free;
+    c.free = block->next;
+    c.count--;
+    if (c.idle > c.count) c.idle = c.count;
+    return reinterpret_cast<uint8_t *>(block);
+  }
+
+  // Call with mutex_ held.
+  void Recycle(uint8_t *p, size_t size) {
+    const size_t k = ClassOf(size);
+    if (k == kNoClass || cached_bytes_ + ClassSize(k) > max_cached_bytes_) {
+      delete[] p;
+      return;
+    }
+    auto &c = classes_[k];
+    Block *block = reinterpret_cast<Block *>(p);
+    block->next = c.free;
+    c.free = block;
+    c.count++;
+    cached_bytes_ += ClassSize(k);
+  }
+
+  const size_t min_block_size_;
+  size_t num_classes_;
+  const size_t max_cached_bytes_;
+  mutable std::mutex mutex_;
+  SizeClass classes_[kMaxClasses];
+  size_t cached_bytes_;
+  size_t recent_size_;
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_BUILDER_POOL_H_
@@ -25,7 +25,8 @@
 namespace flatbuffers {
 
 // A File interface to write data to file by default or
-// save only file names
+// save only file names. SaveFile may be called from several threads at once
+// (flatc --jobs), so implementations must guard any state they keep.
 class FileManager {
  public:
   FileManager() = default;
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <map>
 #include <type_traits>
 
 #include "flatbuffers/allocator.h"
@@ -34,10 +35,15 @@
 #include "flatbuffers/string.h"
 #include "flatbuffers/struct.h"
 #include "flatbuffers/table.h"
+#include "flatbuffers/trusted_buffer.h"
 #include "flatbuffers/vector.h"
 #include "flatbuffers/vector_downward.h"
 #include "flatbuffers/verifier.h"
 
+#if defined(FLATBUFFERS_USE_STD_SPAN) && defined(__cpp_lib_ranges)
+  #include <ranges>
+#endif
+
 namespace flatbuffers {
 
 // Converts a Field ID to a virtual table offset.
@@ -107,7 +113,8 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
         minalign_(1),
         force_defaults_(false),
         dedup_vtables_(true),
-        string_pool(nullptr) {
+        string_pool(nullptr),
+        fixed_vtables_(nullptr) {
     EndianCheck();
   }
 
@@ -124,7 +131,8 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
         minalign_(1),
         force_defaults_(false),
         dedup_vtables_(true),
-        string_pool(nullptr) {
+        string_pool(nullptr),
+        fixed_vtables_(nullptr) {
     EndianCheck();
     // Default construct and swap idiom.
     // Lack of delegating constructors in vs2010 makes it more verbose than
@@ -152,10 +160,12 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
     swap(force_defaults_, other.force_defaults_);
     swap(dedup_vtables_, other.dedup_vtables_);
     swap(string_pool, other.string_pool);
+    swap(fixed_vtables_, other.fixed_vtables_);
   }
 
   ~FlatBufferBuilderImpl() {
     if (string_pool) delete string_pool;
+    if (fixed_vtables_) delete fixed_vtables_;
   }
 
   void Reset() {
@@ -173,8 +183,14 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
     minalign_ = 1;
     length_of_64_bit_region_ = 0;
     if (string_pool) string_pool->clear();
+    if (fixed_vtables_) fixed_vtables_->clear();
   }
 
+  /// @brief Make sure that at least `size` more bytes can be serialized
+  /// without growing the buffer, growing it at most once now if needed.
+  /// @param size The number of bytes to make room for.
+  void Reserve(size_t size) { buf_.ensure_space(size); }
+
   /// @brief The current size of the serialized buffer, counting from the end.
   /// @return Returns an `SizeT` with the current size of the buffer.
   SizeT GetSize() const { return buf_.size(); }
@@ -459,6 +475,7 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
       for (auto it = buf_.scratch_data(); it < buf_.scratch_end();
            it += sizeof(uoffset_t)) {
         auto vt_offset_ptr = reinterpret_cast<uoffset_t *>(it);
+        if (*vt_offset_ptr & kScratchElementMark) continue;
         auto vt2 = reinterpret_cast<voffset_t *>(buf_.data_at(*vt_offset_ptr));
         auto vt2_size = ReadScalar<voffset_t>(vt2);
         if (vt1_size != vt2_size || 0 != memcmp(vt2, vt1, vt1_size)) continue;
@@ -488,6 +505,54 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
     return EndTable(start);
   }
 
+  // Code generated for `fixed_layout` tables lays out the table object at
+  // compile time instead, and creates it with StartFixedTable, one Set*
+  // call per field, and EndFixedTable with its precomputed vtable.
+
+  // Makes room for a zeroed table object of `object_size` bytes, including
+  // its vtable offset, with the fields aligned to at most `alignment`.
+  // Returns the location of the table.
+  uoffset_t StartFixedTable(size_t object_size, size_t alignment) {
+    NotNested();
+    PreAlign(object_size, alignment);
+    buf_.fill_big(object_size);
+    return GetSizeRelative32BitRegion();
+  }
+
+  // Stores the field at offset `field` of the table object at `table`.
+  template<typename T> void SetFixedField(uoffset_t table, voffset_t field,
+                                          T e) {
+    WriteScalar(FixedFieldPointer(table, field), e);
+  }
+
+  template<typename T> void SetFixedStruct(uoffset_t table, voffset_t field,
+                                           const T *structptr) {
+    // If you hit this, a struct field of a fixed_layout table wasn't set.
+    FLATBUFFERS_ASSERT(structptr);
+    memcpy(FixedFieldPointer(table, field), structptr, sizeof(T));
+  }
+
+  template<typename T> void SetFixedOffset(uoffset_t table, voffset_t field,
+                                           Offset<T> off) {
+    // If you hit this, an offset field of a fixed_layout table wasn't set.
+    FLATBUFFERS_ASSERT(off.o && off.o <= table - field);
+    WriteScalar(FixedFieldPointer(table, field),
+                static_cast<uoffset_t>(table - field - off.o));
+  }
+
+  // Finishes the table object at `table` with `vtable`, the vtable image its
+  // layout was generated with. The vtable is written (or, like in EndTable,
+  // an identical one already in the buffer is looked for) only for the first
+  // table of each layout, later ones refer to the same vtable directly.
+  uoffset_t EndFixedTable(uoffset_t table, const voffset_t *vtable) {
+    if (!fixed_vtables_) fixed_vtables_ = new FixedVTableMap();
+    uoffset_t &vt_use = (*fixed_vtables_)[vtable];
+    if (!vt_use) vt_use = FindOrCreateFixedVTable(vtable);
+    WriteScalar(buf_.data_at(table + length_of_64_bit_region_),
+                static_cast<soffset_t>(vt_use) - static_cast<soffset_t>(table));
+    return table;
+  }
+
   // This checks a required field has been set in a given table that has
   // just been constructed.
   template<typename T> void Required(Offset<T> table, voffset_t field) {
@@ -782,6 +847,32 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
     return CreateVector(v.begin(), v.size());
   }
 
+  /// @brief Serialize a `span` into a FlatBuffer `vector`, straight from the
+  /// memory it views.
+  /// @tparam T The data type of the `span` elements.
+  /// @param[in] v The `span` to serialize into the buffer as a `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T, size_t Extent>
+  Offset<Vector<typename std::remove_const<T>::type>> CreateVector(
+      span<T, Extent> v) {
+    return CreateVector(v.data(), v.size());
+  }
+
+#if defined(FLATBUFFERS_USE_STD_SPAN) && defined(__cpp_lib_ranges)
+  /// @brief Serialize any contiguous range, e.g. a `std::array` or a
+  /// `std::basic_string`, into a FlatBuffer `vector`.
+  /// @param[in] range The range to serialize into the buffer as a `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<std::ranges::contiguous_range R>
+    requires std::ranges::sized_range<const R>
+  auto CreateVector(const R &range) {
+    return CreateVector(span<const std::ranges::range_value_t<R>>(
+        std::ranges::data(range), std::ranges::size(range)));
+  }
+#endif
+
   template<typename T>
   Offset<Vector<Offset<T>>> CreateVector(const Offset<T> *v, size_t len) {
     StartVector<Offset<T>>(len);
@@ -801,15 +892,16 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
   }
 
   template<template<typename...> class VectorT = Vector64,
-           int &...ExplicitArgumentBarrier, typename T>
-  Offset64<VectorT<T>> CreateVector64(const std::vector<T> &v) {
+           int &...ExplicitArgumentBarrier, typename T, typename Alloc>
+  Offset64<VectorT<T>> CreateVector64(const std::vector<T, Alloc> &v) {
     return CreateVector<T, Offset64, VectorT>(data(v), v.size());
   }
 
   // vector<bool> may be implemented using a bit-set, so we can't access it as
   // an array. Instead, read elements manually.
   // Background: https://isocpp.org/blog/2012/11/on-vectorbool
-  Offset<Vector<uint8_t>> CreateVector(const std::vector<bool> &v) {
+  template<int &...ExplicitArgumentBarrier, typename Alloc>
+  Offset<Vector<uint8_t>> CreateVector(const std::vector<bool, Alloc> &v) {
     StartVector<uint8_t>(v.size());
     for (auto i = v.size(); i > 0;) {
       PushElement(static_cast<uint8_t>(v[--i]));
@@ -834,9 +926,9 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
   }
 
   /// @brief Serialize values returned by a function into a FlatBuffer `vector`.
-  /// This is a convenience function that takes care of iteration for you. This
-  /// uses a vector stored on the heap to store the intermediate results of the
-  /// iteration.
+  /// This is a convenience function that takes care of iteration for you. The
+  /// intermediate results of the iteration are stored in the scratch area of
+  /// the builder if they are offsets, and in a vector on the heap otherwise.
   /// @tparam T The data type of the `std::vector` elements.
   /// @param f A function that takes the current iteration 0..vector_size-1,
   /// and the state parameter returning any type that you can construct a
@@ -846,10 +938,8 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
   /// where the vector is stored.
   template<typename T, typename F, typename S>
   Offset<Vector<T>> CreateVector(size_t vector_size, F f, S *state) {
-    FLATBUFFERS_ASSERT(FLATBUFFERS_GENERAL_HEAP_ALLOC_OK);
-    std::vector<T> elems(vector_size);
-    for (size_t i = 0; i < vector_size; i++) elems[i] = f(i, state);
-    return CreateVector(elems);
+    return CreateVectorByFunction(vector_size, f, state,
+                                  static_cast<T *>(nullptr));
   }
 
   /// @brief Serialize a `std::vector<StringType>` into a FlatBuffer `vector`.
@@ -886,17 +976,43 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
     for (auto it = begin; it != end; ++it) {
       buf_.scratch_push_small(CreateString(*it));
     }
-    StartVector<Offset<String>>(size);
-    for (size_t i = 1; i <= size; i++) {
-      // Note we re-evaluate the buf location each iteration to account for any
-      // underlying buffer resizing that may occur.
-      PushElement(*reinterpret_cast<Offset<String> *>(
-          buf_.scratch_end() - i * sizeof(Offset<String>)));
+    return EndVectorOfStringsInScratch(size, false);
+  }
+
+  /// @brief Serialize a `span` of strings into a FlatBuffer `vector`, where
+  /// the element type is any type that is accepted by the CreateString()
+  /// overloads.
+  /// The strings are created last to first, so they end up in the buffer in
+  /// the same order as the vector that refers to them.
+  /// @param[in] v The `span` to serialize into the buffer as a `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename StringType, size_t Extent>
+  Offset<Vector<Offset<String>>> CreateVectorOfStrings(
+      span<StringType, Extent> v) {
+    const size_t size = v.size();
+    // See CreateVectorOfStrings(It, It) about reserving the scratch space.
+    buf_.ensure_space(size * sizeof(Offset<String>));
+    for (size_t i = size; i > 0;) {
+      buf_.scratch_push_small(CreateString(v[--i]));
     }
-    buf_.scratch_pop(scratch_buffer_usage);
-    return Offset<Vector<Offset<String>>>(EndVector(size));
+    return EndVectorOfStringsInScratch(size, true);
   }
 
+#if defined(FLATBUFFERS_USE_STD_SPAN) && defined(__cpp_lib_ranges)
+  /// @brief Serialize any contiguous range of strings into a FlatBuffer
+  /// `vector`, see CreateVectorOfStrings(span).
+  /// @param[in] range The range to serialize into the buffer as a `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<std::ranges::contiguous_range R>
+    requires std::ranges::sized_range<const R>
+  Offset<Vector<Offset<String>>> CreateVectorOfStrings(const R &range) {
+    return CreateVectorOfStrings(span<const std::ranges::range_value_t<R>>(
+        std::ranges::data(range), std::ranges::size(range)));
+  }
+#endif
+
   /// @brief Serialize an array of structs into a FlatBuffer `vector`.
   /// @tparam T The data type of the struct array elements.
   /// @param[in] v A pointer to the array of type `T` to serialize into the
@@ -971,6 +1087,33 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
     return CreateVectorOfStructs<T, OffsetT, VectorT>(data(v), v.size());
   }
 
+  /// @brief Serialize a `span` of structs into a FlatBuffer `vector`, straight
+  /// from the memory it views.
+  /// @tparam T The data type of the `span` struct elements.
+  /// @param[in] v The `span` of structs to serialize into the buffer as a
+  /// `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T, size_t Extent>
+  Offset<Vector<const typename std::remove_const<T>::type *>>
+  CreateVectorOfStructs(span<T, Extent> v) {
+    return CreateVectorOfStructs(v.data(), v.size());
+  }
+
+#if defined(FLATBUFFERS_USE_STD_SPAN) && defined(__cpp_lib_ranges)
+  /// @brief Serialize any contiguous range of structs into a FlatBuffer
+  /// `vector`.
+  /// @param[in] range The range to serialize into the buffer as a `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<std::ranges::contiguous_range R>
+    requires std::ranges::sized_range<const R>
+  auto CreateVectorOfStructs(const R &range) {
+    return CreateVectorOfStructs(span<const std::ranges::range_value_t<R>>(
+        std::ranges::data(range), std::ranges::size(range)));
+  }
+#endif
+
   template<template<typename...> class VectorT = Vector64, int &..., typename T>
   Offset64<VectorT<const T *>> CreateVectorOfStructs64(
       const std::vector<T> &v) {
@@ -1242,6 +1385,18 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
     Finish(root.o, file_identifier, true);
   }
 
+  /// @brief Finish a buffer and release it as a `TrustedBuffer`, which
+  /// generated code and `GetRoot` accept without verifying it.
+  /// @param[in] file_identifier If a `file_identifier` is given, the buffer
+  /// will be prefixed with a standard FlatBuffers file header.
+  /// @return A `TrustedBuffer` that owns the buffer and its allocator.
+  template<typename T>
+  TrustedBuffer<T> FinishAndRelease(Offset<T> root,
+                                    const char *file_identifier = nullptr) {
+    Finish(root, file_identifier);
+    return TrustedBuffer<T>(Release());
+  }
+
   void SwapBufAllocator(FlatBufferBuilderImpl &other) {
     buf_.swap_allocator(other.buf_);
   }
@@ -1287,6 +1442,40 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
     voffset_t id;
   };
 
+  // Marks the element offsets CreateVector(size, f, state) keeps in the
+  // scratch area, see CreateVectorByFunction().
+  static const uoffset_t kScratchElementMark = 0x80000000;
+
+  uint8_t *FixedFieldPointer(uoffset_t table, voffset_t field) {
+    return buf_.data_at(table + length_of_64_bit_region_) + field;
+  }
+
+  // Writes `vtable` for EndFixedTable, unless an identical vtable is already
+  // in the buffer and vtables are deduplicated.
+  uoffset_t FindOrCreateFixedVTable(const voffset_t *vtable) {
+    const voffset_t vt_size = vtable[0];
+    const size_t vt_len = vt_size / sizeof(voffset_t);
+    uoffset_t vt_use = 0;
+    if (dedup_vtables_) {
+      for (auto it = buf_.scratch_data(); it < buf_.scratch_end() && !vt_use;
+           it += sizeof(uoffset_t)) {
+        auto vt_offset_ptr = reinterpret_cast<uoffset_t *>(it);
+        if (*vt_offset_ptr & kScratchElementMark) continue;
+        auto vt2 = reinterpret_cast<voffset_t *>(buf_.data_at(*vt_offset_ptr));
+        size_t i = 0;
+        while (i < vt_len && ReadScalar<voffset_t>(vt2 + i) == vtable[i]) i++;
+        if (i == vt_len) vt_use = *vt_offset_ptr;
+      }
+    }
+    if (!vt_use) {
+      auto vt = reinterpret_cast<voffset_t *>(buf_.make_space(vt_size));
+      for (size_t i = 0; i < vt_len; i++) WriteScalar(vt + i, vtable[i]);
+      vt_use = GetSizeRelative32BitRegion();
+      buf_.scratch_push_small(vt_use);
+    }
+    return vt_use;
+  }
+
   vector_downward<SizeT> buf_;
 
   // Accumulating offsets of table members while it is being built.
@@ -1344,6 +1533,11 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
   typedef std::set<Offset<String>, StringOffsetCompare> StringOffsetMap;
   StringOffsetMap *string_pool;
 
+  // The vtable EndFixedTable uses for each generated vtable image, by its
+  // address. Instantiated on first use only.
+  typedef std::map<const voffset_t *, uoffset_t> FixedVTableMap;
+  FixedVTableMap *fixed_vtables_;
+
  private:
   void CanAddOffset64() {
     // If you hit this assertion, you are attempting to add a 64-bit offset to
@@ -1398,6 +1592,78 @@ template<bool Is64Aware = false> class FlatBufferBuilderImpl {
             vector_size));
   }
 
+  // Ends CreateVectorOfStrings() by turning the `size` string offsets on top
+  // of the scratch area into a vector, and popping them. They are in vector
+  // order, or last to first if `reversed`. This reserves the whole vector at
+  // once and writes it in order, instead of a PushElement() per string.
+  Offset<Vector<Offset<String>>> EndVectorOfStringsInScratch(size_t size,
+                                                             bool reversed) {
+    const size_t bytes = size * sizeof(Offset<String>);
+    StartVector<Offset<String>>(size);
+    uint8_t *dst = buf_.make_space(bytes);
+    // Read the scratch area after make_space(), which may have moved it.
+    const auto src =
+        reinterpret_cast<const Offset<String> *>(buf_.scratch_end() - bytes);
+    // Where the first element starts, as counted by ReferTo().
+    auto at = static_cast<uoffset_t>(GetSizeRelative32BitRegion() -
+                                     sizeof(uoffset_t));
+    for (size_t i = 0; i < size; i++) {
+      const auto str = src[reversed ? size - 1 - i : i];
+      WriteScalar(dst + i * sizeof(uoffset_t), ReferTo(str.o, at));
+      at -= static_cast<uoffset_t>(sizeof(uoffset_t));
+    }
+    buf_.scratch_pop(bytes);
+    return Offset<Vector<Offset<String>>>(EndVector(size));
+  }
+
+  template<typename T, typename F, typename S>
+  Offset<Vector<T>> CreateVectorByFunction(size_t vector_size, F f, S *state,
+                                           T *) {
+    FLATBUFFERS_ASSERT(FLATBUFFERS_GENERAL_HEAP_ALLOC_OK);
+    std::vector<T> elems(vector_size);
+    for (size_t i = 0; i < vector_size; i++) elems[i] = f(i, state);
+    return CreateVector(elems);
+  }
+
+  // The element offsets of CreateVector(size, f, state) are collected on top
+  // of the scratch area, like those of CreateVectorOfStrings(). The tables f
+  // creates push their vtable offsets in between, so the element offsets are
+  // marked with kScratchElementMark, which EndTable() and EndFixedTable()
+  // skip. Offsets in the 32-bit region are less than 2^31, so it is free.
+  template<typename T, typename F, typename S>
+  Offset<Vector<Offset<T>>> CreateVectorByFunction(size_t vector_size, F f,
+                                                   S *state, Offset<T> *) {
+    const size_t start = buf_.scratch_size();
+    // See CreateVectorOfStrings(It, It) about reserving the scratch space.
+    buf_.ensure_space(vector_size * sizeof(uoffset_t));
+    for (size_t i = 0; i < vector_size; i++) {
+      const Offset<T> elem = f(i, state);
+      buf_.scratch_push_small(elem.o | kScratchElementMark);
+    }
+    StartVector<Offset<T>>(vector_size);
+    if (!vector_size) return Offset<Vector<Offset<T>>>(EndVector(0));
+    uint8_t *dst = buf_.make_space(vector_size * sizeof(uoffset_t));
+    // Read the scratch area after make_space(), which may have moved it.
+    auto src = reinterpret_cast<uoffset_t *>(buf_.scratch_data() + start);
+    const auto end = reinterpret_cast<uoffset_t *>(buf_.scratch_end());
+    // Moves the vtable offsets down over the element offsets, in order.
+    auto vtables = src;
+    // Where the first element starts, as counted by ReferTo().
+    auto at = static_cast<uoffset_t>(GetSizeRelative32BitRegion() -
+                                     sizeof(uoffset_t));
+    for (; src < end; src++) {
+      if (*src & kScratchElementMark) {
+        WriteScalar(dst, ReferTo(*src & ~kScratchElementMark, at));
+        dst += sizeof(uoffset_t);
+        at -= static_cast<uoffset_t>(sizeof(uoffset_t));
+      } else {
+        *vtables++ = *src;
+      }
+    }
+    buf_.scratch_pop(static_cast<size_t>(end - vtables) * sizeof(uoffset_t));
+    return Offset<Vector<Offset<T>>>(EndVector(vector_size));
+  }
+
   template<typename T>
   typename std::enable_if<std::is_same<T, uoffset_t>::value, T>::type
   CalculateOffset() {
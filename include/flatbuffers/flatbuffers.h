@@ -31,6 +31,7 @@
 #include "flatbuffers/string.h"
 #include "flatbuffers/struct.h"
 #include "flatbuffers/table.h"
+#include "flatbuffers/trusted_buffer.h"
 #include "flatbuffers/vector.h"
 #include "flatbuffers/vector_downward.h"
 #include "flatbuffers/verifier.h"
@@ -110,6 +111,118 @@ typedef std::function<void(void **pointer_adr, hash_value_t hash)>
     resolver_function_t;
 typedef std::function<hash_value_t(void *pointer)> rehasher_function_t;
 
+// Upper bounds on the bytes a FlatBufferBuilder needs for the parts of a
+// buffer, counting alignment padding and the builder's scratch space. The
+// PackedSize() functions of the generated object API add these up.
+
+// A table with `num_fields` fields, whose inline parts take at most
+// `field_bytes` bytes, padding included.
+inline size_t PackedTableSize(size_t num_fields, size_t field_bytes) {
+  // The padded vtable offset, the vtable, and the scratch space used to
+  // record the field locations and the vtable.
+  return field_bytes + 2 * sizeof(soffset_t) - 1 +
+         (num_fields + 2) * sizeof(voffset_t) +
+         num_fields * 2 * sizeof(uoffset_t) + sizeof(uoffset_t);
+}
+
+inline size_t PackedStringSize(size_t len) {
+  return sizeof(uoffset_t) + len + 1 + sizeof(uoffset_t) - 1;
+}
+
+// A vector of `len` elements, with a 32 or 64-bit length.
+inline size_t PackedVectorSize(size_t len, size_t elem_size,
+                               size_t alignment) {
+  return len * elem_size + sizeof(uoffset64_t) +
+         (std::max)(alignment, sizeof(uoffset64_t)) - 1;
+}
+
+// A vector of offsets to strings, tables or unions, excluding the objects
+// they point to, but including the scratch space the builder collects them
+// in.
+inline size_t PackedOffsetVectorSize(size_t len) {
+  return PackedVectorSize(len, sizeof(uoffset_t), sizeof(uoffset_t)) +
+         len * sizeof(uoffset_t);
+}
+
+// A finished buffer whose root table takes at most `root_size` bytes, with
+// a file identifier and a size prefix.
+inline size_t PackedBufferSize(size_t root_size) {
+  return root_size + sizeof(uoffset64_t) + sizeof(uoffset_t) +
+         kFileIdentifierLength + FLATBUFFERS_MAX_ALIGNMENT - 1;
+}
+
+// Allocator handing out a single caller-owned region, so a FlatBufferBuilder
+// can build a buffer in it without allocating. The region is handed out
+// aligned to its end, so the builder should be created with the region size
+// as initial size. Should the builder outgrow the region anyway, it carries
+// on in memory from `fallback` (or the default allocator), and overflowed()
+// tells the buffer didn't end up in the region.
+class FixedAllocator : public Allocator {
+ public:
+  FixedAllocator(uint8_t *buf, size_t size, Allocator *fallback = nullptr)
+      : buf_(buf),
+        size_(size),
+        in_use_(false),
+        overflowed_(false),
+        fallback_(fallback) {}
+
+  uint8_t *allocate(size_t size) FLATBUFFERS_OVERRIDE {
+    if (in_use_ || size > size_) {
+      overflowed_ = true;
+      return Allocate(fallback_, size);
+    }
+    in_use_ = true;
+    return buf_ + size_ - size;
+  }
+
+  void deallocate(uint8_t *p, size_t size) FLATBUFFERS_OVERRIDE {
+    if (p >= buf_ && p < buf_ + size_) {
+      in_use_ = false;
+    } else {
+      Deallocate(fallback_, p, size);
+    }
+  }
+
+  bool overflowed() const { return overflowed_; }
+
+ private:
+  uint8_t *buf_;
+  size_t size_;
+  bool in_use_;
+  bool overflowed_;
+  Allocator *fallback_;
+};
+
+/// @brief Pack an object API object into a finished buffer, serializing it
+/// directly into `buf` instead of memory allocated by the builder.
+/// @tparam T The generated table type of the object.
+/// @param buf The memory to build the buffer in.
+/// @param obj The object to pack.
+/// @param file_identifier The file identifier to finish the buffer with, or
+/// nullptr.
+/// @return The finished buffer, which ends near the end of `buf`, or an empty
+/// span if the object doesn't fit in `buf`: when `buf` is smaller than
+/// T::PackedSize() says the object needs, or if the object outgrows it anyway.
+template<typename T, typename BuilderT = FlatBufferBuilder>
+span<uint8_t> PackInto(span<uint8_t> buf,
+                       const typename T::NativeTableType &obj,
+                       const char *file_identifier = nullptr,
+                       const rehasher_function_t *rehasher = nullptr) {
+  // Make the region end aligned, and its size a multiple of the alignment,
+  // like the builder would allocate it.
+  const size_t align = AlignOf<largest_scalar_t>();
+  const uintptr_t begin = reinterpret_cast<uintptr_t>(buf.data());
+  const uintptr_t end = (begin + buf.size()) & ~(align - 1);
+  const size_t size = end > begin ? (end - begin) & ~(align - 1) : 0;
+  if (size < PackedBufferSize(T::PackedSize(obj))) return span<uint8_t>();
+  FixedAllocator allocator(reinterpret_cast<uint8_t *>(end - size), size);
+  BuilderT fbb(size, &allocator);
+  fbb.Finish(T::Pack(fbb, &obj, rehasher), file_identifier);
+  // The buffer is in memory the builder frees on return.
+  if (allocator.overflowed()) return span<uint8_t>();
+  return fbb.GetBufferSpan();
+}
+
 // Helper function to test if a field is present, using any of the field
 // enums in the generated code.
 // `table` must be a generated table type. Since this is a template parameter,
@@ -50,6 +50,12 @@ struct FlatCOptions {
   std::string conform_to_schema;
   std::string annotate_schema;
   bool annotate_include_vector_contents = true;
+  // Limits for annotating large binaries, see docs/source/annotation.md.
+  bool annotate_streaming = false;
+  uint64_t annotate_batch_size = 0;
+  uint64_t annotate_begin = 0;
+  uint64_t annotate_end = std::numeric_limits<uint64_t>::max();
+  uint64_t annotate_max_vector_elements = 0;
   bool any_generator = false;
   bool print_make_rules = false;
   bool raw_binary = false;
@@ -57,6 +63,13 @@ struct FlatCOptions {
   bool grpc_enabled = false;
   bool requires_bfbs = false;
   bool file_names_only = false;
+  int jobs = 1;
+  bool skip_unchanged = false;
+  std::string output_manifest;
+  std::string stamp_dir;
+  // The options that affect generated output, as given on the command line.
+  // Part of the key of the --stamp-dir stamps.
+  std::string stamp_key;
 
   std::vector<std::shared_ptr<CodeGenerator>> generators;
 };
@@ -121,9 +134,63 @@ class FlatCompiler {
   std::unique_ptr<Parser> GenerateCode(const FlatCOptions &options,
                                        Parser &conform_parser);
 
+  // The schema that the data files following it are converted against, kept
+  // so each worker of a parallel conversion can load its own copy.
+  struct SchemaSource {
+    std::string filename;
+    std::string contents;
+    IDLOptions opts;
+  };
+
+  void ConvertDataFilesInParallel(const FlatCOptions &options,
+                                  const SchemaSource &schema, size_t begin,
+                                  size_t end);
+
+  // A warning or error from a generator, held back so that messages from
+  // generators running concurrently are reported in input order.
+  struct Message {
+    bool is_error;
+    std::string text;
+  };
+  typedef std::vector<Message> Messages;
+
+  // A schema file whose code generation was deferred, to run together with
+  // the other generators and schema files.
+  struct CodeGenUnit {
+    Parser *parser;
+    std::string filename;
+    std::string filebase;
+    std::string root_type;
+    const uint8_t *bfbs_buffer;
+    int64_t bfbs_length;
+    // Whether to write a --stamp-dir stamp for the file once it is generated.
+    bool write_stamp;
+  };
+
+  void RunCodeGenerator(const FlatCOptions &options,
+                        CodeGenerator &code_generator, const Parser &parser,
+                        const std::string &filebase, bool is_schema,
+                        const uint8_t *bfbs_buffer, int64_t bfbs_length,
+                        Messages &messages) const;
+
+  void RunGrpcGenerator(const FlatCOptions &options,
+                        CodeGenerator &code_generator, const Parser &parser,
+                        const std::string &filebase, Messages &messages) const;
+
+  void Report(const Messages &messages) const;
+
+  void FinishFile(Parser &parser, const std::string &root_type);
+
+  void GenerateSchemasInParallel(const FlatCOptions &options,
+                                 const std::vector<CodeGenUnit> &units);
+
   std::map<std::string, std::shared_ptr<CodeGenerator>> code_generators_;
 
   InitParams params_;
+
+  // The number of errors reported so far, so that files whose processing
+  // reported one are not recorded as up to date.
+  mutable size_t error_count_ = 0;
 };
 
 }  // namespace flatbuffers
@@ -22,6 +22,7 @@
 #include <map>
 #include <memory>
 #include <stack>
+#include <unordered_map>
 #include <vector>
 
 #include "flatbuffers/base.h"
@@ -235,39 +236,114 @@ struct Value {
 
 // Helper class that retains the original order of a set of identifiers and
 // also provides quick lookup.
+// Type resolution probes the struct and enum tables several times per type
+// reference with long fully qualified names, so names are hashed rather than
+// ordered, and can be looked up without copying them into a std::string.
 template<typename T> class SymbolTable {
  public:
+  // A name in the table, which holds its own copy, or a name being looked
+  // up, which refers to the caller's characters.
+  class Key {
+   public:
+    Key(const char *data, size_t size) : data_(data), size_(size) {}
+    explicit Key(const std::string &name)
+        : name_(name), data_(name_.c_str()), size_(name_.size()) {}
+    Key(const Key &other)
+        : name_(other.name_),
+          data_(other.Owned() ? name_.c_str() : other.data_),
+          size_(other.size_) {}
+
+    std::string str() const { return std::string(data_, size_); }
+
+    bool operator==(const Key &other) const {
+      return size_ == other.size_ && !memcmp(data_, other.data_, size_);
+    }
+
+    // FNV-1a, see hash.h.
+    size_t Hash() const {
+      uint64_t hash = 0xcbf29ce484222325ULL;
+      for (size_t i = 0; i < size_; i++) {
+        hash ^= static_cast<uint8_t>(data_[i]);
+        hash *= 0x100000001b3ULL;
+      }
+      return static_cast<size_t>(hash);
+    }
+
+   private:
+    FLATBUFFERS_DELETE_FUNC(Key &operator=(const Key &other));
+
+    bool Owned() const { return data_ == name_.c_str(); }
+
+    std::string name_;
+    const char *data_;
+    size_t size_;
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key &key) const { return key.Hash(); }
+  };
+
+  typedef std::unordered_map<Key, T *, KeyHash> Dict;
+  typedef typename Dict::const_iterator const_iterator;
+
   ~SymbolTable() {
     for (auto it = vec.begin(); it != vec.end(); ++it) { delete *it; }
   }
 
   bool Add(const std::string &name, T *e) {
     vec.emplace_back(e);
-    auto it = dict.find(name);
-    if (it != dict.end()) return true;
-    dict[name] = e;
-    return false;
+    return !dict_.insert(std::make_pair(Key(name), e)).second;
   }
 
   void Move(const std::string &oldname, const std::string &newname) {
-    auto it = dict.find(oldname);
-    if (it != dict.end()) {
+    auto it = dict_.find(Key(oldname.c_str(), oldname.size()));
+    if (it != dict_.end()) {
       auto obj = it->second;
-      dict.erase(it);
-      dict[newname] = obj;
+      dict_.erase(it);
+      dict_[Key(newname)] = obj;
     } else {
       FLATBUFFERS_ASSERT(false);
     }
   }
 
+  // Removes `name` from the lookup map, the object itself stays owned.
+  void Erase(const std::string &name) {
+    dict_.erase(Key(name.c_str(), name.size()));
+  }
+
+  // Makes every name that refers to `from` refer to `to` instead.
+  void Redirect(const T *from, T *to) {
+    for (auto it = dict_.begin(); it != dict_.end(); ++it) {
+      if (it->second == from) it->second = to;
+    }
+  }
+
+  // Forgets all objects without deleting them.
+  void Release() {
+    dict_.clear();
+    vec.clear();
+  }
+
+  T *Lookup(const char *name, size_t size) const {
+    auto it = dict_.find(Key(name, size));
+    return it == dict_.end() ? nullptr : it->second;
+  }
+
   T *Lookup(const std::string &name) const {
-    auto it = dict.find(name);
-    return it == dict.end() ? nullptr : it->second;
+    return Lookup(name.c_str(), name.size());
   }
 
+  bool empty() const { return dict_.empty(); }
+
+  // The names in the table and their objects, in no particular order.
+  const_iterator begin() const { return dict_.begin(); }
+  const_iterator end() const { return dict_.end(); }
+
  public:
-  std::map<std::string, T *> dict;  // quick lookup
-  std::vector<T *> vec;             // Used to iterate in order of insertion
+  std::vector<T *> vec;  // Used to iterate in order of insertion
+
+ private:
+  Dict dict_;  // quick lookup
 };
 
 // A name space, as set in the schema.
@@ -662,6 +738,7 @@ struct IDLOptions {
   std::string cpp_object_api_string_type;
   bool cpp_object_api_string_flexible_constructor;
   CaseStyle cpp_object_api_field_case_style;
+  bool cpp_object_api_arena;
   bool cpp_direct_copy;
   bool gen_nullable;
   std::string java_package_prefix;
@@ -691,6 +768,7 @@ struct IDLOptions {
   std::vector<std::string> cpp_includes;
   std::string cpp_std;
   bool cpp_static_reflection;
+  bool cpp_struct_columns;
   std::string proto_namespace_suffix;
   std::string filename_suffix;
   std::string filename_extension;
@@ -701,6 +779,7 @@ struct IDLOptions {
   bool json_nested_flatbuffers;
   bool json_nested_flexbuffers;
   bool json_nested_legacy_flatbuffers;
+  bool json_shortest_floats;
   bool ts_flat_files;
   bool ts_entry_points;
   bool ts_no_import_ext;
@@ -814,6 +893,7 @@ struct IDLOptions {
         cpp_object_api_pointer_type("std::unique_ptr"),
         cpp_object_api_string_flexible_constructor(false),
         cpp_object_api_field_case_style(CaseStyle_Unchanged),
+        cpp_object_api_arena(false),
         cpp_direct_copy(true),
         gen_nullable(false),
         java_checkerframework(false),
@@ -834,6 +914,7 @@ struct IDLOptions {
         java_primitive_has_method(false),
         cs_gen_json_serializer(false),
         cpp_static_reflection(false),
+        cpp_struct_columns(false),
         filename_suffix("_generated"),
         filename_extension(),
         no_warnings(false),
@@ -843,6 +924,7 @@ struct IDLOptions {
         json_nested_flatbuffers(true),
         json_nested_flexbuffers(true),
         json_nested_legacy_flatbuffers(false),
+        json_shortest_floats(false),
         ts_flat_files(false),
         ts_entry_points(false),
         ts_no_import_ext(false),
@@ -874,7 +956,10 @@ struct ParserState {
         line_start_(nullptr),
         line_(0),
         token_(-1),
-        attr_is_trivial_ascii_string_(true) {}
+        attr_is_trivial_ascii_string_(true),
+        token_start_(nullptr),
+        token_size_(0),
+        attribute_set_(true) {}
 
  protected:
   void ResetState(const char *source) {
@@ -894,6 +979,30 @@ struct ParserState {
     return static_cast<int64_t>(cursor_ - line_start_);
   }
 
+  // The text of the current token, without copying it. It stays valid until
+  // the next token, or the next call to SetAttribute().
+  const char *TokenText() const {
+    return attribute_set_ ? attribute_.c_str() : token_start_;
+  }
+  size_t TokenSize() const {
+    return attribute_set_ ? attribute_.size() : token_size_;
+  }
+
+  // The text of the current token, copied into attribute_ on first use.
+  const std::string &Attribute() {
+    if (!attribute_set_) {
+      attribute_.assign(token_start_, token_size_);
+      attribute_set_ = true;
+    }
+    return attribute_;
+  }
+
+  // Replaces the text of the current token.
+  void SetAttribute(const std::string &text) {
+    attribute_ = text;
+    attribute_set_ = true;
+  }
+
   const char *prev_cursor_;
   const char *cursor_;
   const char *line_start_;
@@ -904,6 +1013,16 @@ struct ParserState {
   // sequences. Only printable ASCII (without [\t\r\n]).
   // Used for number-in-string (and base64 string in future).
   bool attr_is_trivial_ascii_string_;
+  // Where the text of the current token is in the source: an identifier, a
+  // number, or the contents of a string constant without escape sequences.
+  // It only ever points into the source, so a copy of the state stays valid
+  // as long as the source does.
+  const char *token_start_;
+  size_t token_size_;
+  // Whether attribute_ holds the text of the current token instead: once
+  // Attribute() copied it, or the lexer decoded the escape sequences of a
+  // string constant into it, or SetAttribute() replaced it.
+  bool attribute_set_;
   std::string attribute_;
   std::vector<std::string> doc_comment_;
 };
@@ -954,6 +1073,8 @@ class CheckedError {
 #endif
 // clang-format on
 
+class JsonTableParser;
+
 class Parser : public ParserState {
  public:
   explicit Parser(const IDLOptions &options = IDLOptions())
@@ -982,6 +1103,8 @@ class Parser : public ParserState {
     known_attributes_["force_align"] = true;
     known_attributes_["bit_flags"] = true;
     known_attributes_["original_order"] = true;
+    known_attributes_["fixed_layout"] = true;
+    known_attributes_["columnar"] = true;
     known_attributes_["nested_flatbuffer"] = true;
     known_attributes_["csharp_partial"] = true;
     known_attributes_["streaming"] = true;
@@ -1091,6 +1214,7 @@ class Parser : public ParserState {
 
  private:
   class ParseDepthGuard;
+  friend class JsonTableParser;
 
   void Message(const std::string &msg);
   void Warning(const std::string &msg);
@@ -1131,6 +1255,7 @@ class Parser : public ParserState {
   FLATBUFFERS_CHECKED_ERROR ParseVector(const Type &type, uoffset_t *ovalue,
                                         FieldDef *field, size_t fieldn);
   FLATBUFFERS_CHECKED_ERROR ParseArray(Value &array);
+  void SortVectorByKey(const Type &type);
   FLATBUFFERS_CHECKED_ERROR ParseNestedFlatbuffer(
       Value &val, FieldDef *field, size_t fieldn,
       const StructDef *parent_struct_def);
@@ -1175,12 +1300,27 @@ class Parser : public ParserState {
                                       const char **include_paths,
                                       const char *source_filename);
   FLATBUFFERS_CHECKED_ERROR CheckPrivateLeak();
+  FLATBUFFERS_CHECKED_ERROR CheckFixedLayouts();
+  FLATBUFFERS_CHECKED_ERROR ResolveColumnarFields();
   FLATBUFFERS_CHECKED_ERROR CheckPrivatelyLeakedFields(
       const Definition &def, const Definition &value_type);
   FLATBUFFERS_CHECKED_ERROR DoParse(const char *_source,
                                     const char **include_paths,
                                     const char *source_filename,
                                     const char *include_filename);
+  std::string FindIncludeFile(const std::string &name,
+                              const char *source_filename,
+                              const char **include_paths) const;
+
+  // An include file as loaded from disk.
+  struct LoadedInclude {
+    void Load(const std::string &filepath);
+
+    bool loaded = false;
+    uint64_t hash = 0;
+    std::string contents;
+  };
+  const LoadedInclude &LoadInclude(const std::string &filepath);
   FLATBUFFERS_CHECKED_ERROR DoParseJson();
   FLATBUFFERS_CHECKED_ERROR CheckClash(std::vector<FieldDef *> &fields,
                                        StructDef *struct_def,
@@ -1219,6 +1359,9 @@ class Parser : public ParserState {
   std::string file_extension_;
 
   std::map<uint64_t, std::string> included_files_;
+  // The include files loaded during the current Parse(), by path, so that
+  // each is read once however often it is included.
+  std::map<std::string, LoadedInclude> loaded_includes_;
   std::map<std::string, std::set<IncludedFile>> files_included_per_file_;
   std::vector<std::string> native_included_files_;
 
@@ -1241,10 +1384,101 @@ class Parser : public ParserState {
   // on memory usage.
   mutable std::set<std::string> string_cache_;
 
+  // The qualified names LookupEnum and LookupStructThruParentNamespaces probe
+  // are built here, reusing its capacity from lookup to lookup.
+  mutable std::string lookup_name_;
+
   int anonymous_counter_;
   int parse_depth_counter_;  // stack-overflow guard
 };
 
+// Converts JSON documents of a parser's root type straight into its
+// `builder_`, for callers that ingest a lot of JSON against one schema.
+// Compared to Parser::ParseJson it uses a JSON-only tokenizer that doesn't
+// allocate per token, a perfect hash per table for field names, and keeps
+// values typed instead of round-tripping them through strings.
+// Anything it doesn't handle (syntax errors, unions whose type field comes
+// after the value, vectors of unions, nested flatbuffers or flexbuffers,
+// 64-bit offsets, protobuf-style text, ...) is parsed again with
+// Parser::ParseJson, so the resulting buffer and any error in `error_` are the
+// same as ParseJson gives.
+class JsonTableParser {
+ public:
+  // `parser` must outlive this object, and its schema must not change while
+  // this object is in use.
+  explicit JsonTableParser(Parser &parser);
+
+  // Same contract as Parser::ParseJson: returns false and sets
+  // `parser.error_` on failure.
+  bool Parse(const char *json, const char *json_filename = nullptr);
+
+  // True if the last Parse() was handled by Parser::ParseJson.
+  bool used_fallback() const { return used_fallback_; }
+
+ private:
+  struct TableInfo;
+
+  struct FieldSlot {
+    const FieldDef *field;  // nullptr for an empty slot.
+    TableInfo *child;       // For struct, table and vector-of-those fields.
+    uint64_t default_bits;  // Typed default of a scalar field.
+    size_t index;           // Position in StructDef::fields.vec.
+    const char *hash;       // Function of the `hash` attribute, if any.
+    uint8_t force_align;
+    bool supported;
+  };
+
+  struct TableInfo {
+    const StructDef *struct_def;
+    std::vector<FieldSlot> slots;  // Open addressing, collision free.
+    uint32_t seed;
+    uint32_t mask;
+    std::vector<const FieldDef *> required;
+    // False if no perfect hash was found, or for structs with more than 64
+    // fields (see ParseStruct).
+    bool supported;
+  };
+
+  struct ParsedField {
+    const FieldSlot *slot;
+    // Scalar value, offset of a child object, or for inline structs the
+    // position of their bytes in `scratch_`.
+    uint64_t value;
+    bool is_null;
+  };
+
+  TableInfo *GetTableInfo(const StructDef &struct_def);
+  const FieldSlot *LookupField(const TableInfo &info, const char *name,
+                               size_t len) const;
+
+  bool ParseDocument(const char *json);
+  bool SkipWhitespace();
+  bool ReadString(const char **str, size_t *len);
+  bool ReadName(const char **name, size_t *len);
+  template<typename F> bool ParseObject(size_t &count, F body);
+  template<typename F> bool ParseList(size_t &count, F body);
+  bool ParseScalar(const Type &type, const char *hash, uint64_t *bits,
+                   bool *is_null);
+  bool ParseHash(BaseType type, const char *hash, uint64_t *bits);
+  bool ParseString(bool shared, uoffset_t *off);
+  bool ParseField(const FieldSlot &slot, size_t fields_mark, size_t &fieldn);
+  bool ParseTable(const TableInfo &info, uoffset_t *off);
+  bool ParseStruct(const TableInfo &info, uint8_t *dest);
+  bool ParseArray(const FieldSlot &slot, uint8_t *dest);
+  bool ParseVector(const FieldSlot &slot, uoffset_t *off);
+  bool ParseUnion(const FieldDef &field, size_t fields_mark, uoffset_t *off);
+  bool SkipValue();
+
+  Parser &parser_;
+  std::map<const StructDef *, TableInfo> tables_;
+  std::vector<ParsedField> fields_;  // Fields of the tables being parsed.
+  std::vector<uint8_t> scratch_;     // Inline structs and vector elements.
+  std::string string_;               // Unescaped string values.
+  const char *cursor_;
+  int depth_;
+  bool used_fallback_;
+};
+
 // Utility functions for multiple generators:
 
 // Generate text (JSON) from a given FlatBuffer, and a given Parser
@@ -1273,6 +1507,28 @@ extern const char *GenText(const Parser &parser, const void *flatbuffer,
                            std::string *text);
 extern const char *GenTextFile(const Parser &parser, const std::string &path,
                                const std::string &file_name);
+// Like GenTextFile, but for the `size` bytes at `flatbuffer` rather than the
+// contents of the parser's builder.
+extern const char *GenTextFile(const Parser &parser, const void *flatbuffer,
+                               size_t size, const std::string &path,
+                               const std::string &file_name);
+
+// Calls `task(i)` for every `i` in [0, count), possibly concurrently, and
+// returns once all the calls have finished.
+typedef std::function<void(size_t count,
+                           const std::function<void(size_t)> &task)>
+    TextExecutor;
+
+// Like GenText, but vectors of tables, unions or strings with at least
+// `min_parallel_elements` elements are split into up to `num_chunks` chunks.
+// These are rendered through `executor`, which decides which threads to run
+// them on, and stitched back together in order. The output is byte-identical
+// to GenText.
+extern const char *GenTextParallel(const Parser &parser, const void *flatbuffer,
+                                   std::string *text,
+                                   const TextExecutor &executor,
+                                   size_t num_chunks,
+                                   size_t min_parallel_elements = 1024);
 
 // Generate GRPC Cpp interfaces.
 // See idl_gen_grpc.cpp.
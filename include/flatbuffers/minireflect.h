@@ -416,6 +416,342 @@ inline std::string FlatBufferToString(const uint8_t *buffer,
   return tostring_visitor.s;
 }
 
+#if ((__cplusplus >= 201703L) || \
+     (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L)))
+
+// Compile-time counterpart of the above, for code generated with
+// --cpp-static-reflection. Rather than interpreting a TypeTable at runtime,
+// this iterates over the generated Traits of a table or struct, so the field
+// loop is unrolled and every visitor call is statically dispatched.
+// Any class with the methods of IterationVisitor can be used as visitor, it
+// does not need to derive from it. Differences with IterateObject are that
+// deprecated fields are skipped (field_idx counts non-deprecated fields only),
+// type_table arguments are always nullptr, union types are visited as their
+// underlying integer type and vectors of bools as vectors of bytes.
+
+namespace internal {
+
+template<typename T> struct is_static_vector : std::false_type {};
+template<typename T, typename SizeT>
+struct is_static_vector<Vector<T, SizeT>> : std::true_type {
+  static constexpr size_t element_stride = IndirectHelper<T>::element_stride;
+};
+template<typename T, uint16_t length>
+struct is_static_vector<Array<T, length>> : std::true_type {
+  static constexpr size_t element_stride = sizeof(T);
+};
+
+template<typename T> struct is_static_optional : std::false_type {};
+template<typename T>
+struct is_static_optional<Optional<T>> : std::true_type {};
+
+template<typename T, typename = void>
+struct has_static_reflection : std::false_type {};
+template<typename T>
+struct has_static_reflection<T,
+                             std::void_t<decltype(T::Traits::field_offsets)>>
+    : std::true_type {};
+
+template<typename T> constexpr ElementaryType StaticElementaryType() {
+  using U = std::remove_cv_t<std::remove_pointer_t<std::decay_t<T>>>;
+  if constexpr (is_static_optional<U>::value) {
+    return StaticElementaryType<typename U::value_type>();
+  } else if constexpr (std::is_enum_v<U>) {
+    return StaticElementaryType<std::underlying_type_t<U>>();
+  } else if constexpr (std::is_same_v<U, bool>) {
+    return ET_BOOL;
+  } else if constexpr (std::is_same_v<U, int8_t>) {
+    return ET_CHAR;
+  } else if constexpr (std::is_same_v<U, uint8_t>) {
+    return ET_UCHAR;
+  } else if constexpr (std::is_same_v<U, int16_t>) {
+    return ET_SHORT;
+  } else if constexpr (std::is_same_v<U, uint16_t>) {
+    return ET_USHORT;
+  } else if constexpr (std::is_same_v<U, int32_t>) {
+    return ET_INT;
+  } else if constexpr (std::is_same_v<U, uint32_t>) {
+    return ET_UINT;
+  } else if constexpr (std::is_same_v<U, int64_t>) {
+    return ET_LONG;
+  } else if constexpr (std::is_same_v<U, uint64_t>) {
+    return ET_ULONG;
+  } else if constexpr (std::is_same_v<U, float>) {
+    return ET_FLOAT;
+  } else if constexpr (std::is_same_v<U, double>) {
+    return ET_DOUBLE;
+  } else if constexpr (std::is_same_v<U, String>) {
+    return ET_STRING;
+  } else if constexpr (is_static_vector<U>::value) {
+    return StaticElementaryType<decltype(std::declval<U>().Get(0))>();
+  } else {
+    return ET_SEQUENCE;
+  }
+}
+
+template<typename T, typename Visitor>
+void StaticIterateScalar(T val, const char *name, Visitor *visitor) {
+  if constexpr (std::is_same_v<T, bool>) {
+    visitor->Bool(val);
+  } else if constexpr (std::is_same_v<T, int8_t>) {
+    visitor->Char(val, name);
+  } else if constexpr (std::is_same_v<T, uint8_t>) {
+    visitor->UChar(val, name);
+  } else if constexpr (std::is_same_v<T, int16_t>) {
+    visitor->Short(val, name);
+  } else if constexpr (std::is_same_v<T, uint16_t>) {
+    visitor->UShort(val, name);
+  } else if constexpr (std::is_same_v<T, int32_t>) {
+    visitor->Int(val, name);
+  } else if constexpr (std::is_same_v<T, uint32_t>) {
+    visitor->UInt(val, name);
+  } else if constexpr (std::is_same_v<T, int64_t>) {
+    visitor->Long(val);
+  } else if constexpr (std::is_same_v<T, uint64_t>) {
+    visitor->ULong(val);
+  } else if constexpr (std::is_same_v<T, float>) {
+    visitor->Float(val);
+  } else {
+    static_assert(std::is_same_v<T, double>, "Unexpected scalar type");
+    visitor->Double(val);
+  }
+}
+
+template<typename T, typename Visitor>
+void StaticIterateObject(const T &obj, Visitor *visitor);
+
+template<typename T, typename Visitor>
+void StaticIterateValue(const T &val, Visitor *visitor) {
+  if constexpr (std::is_pointer_v<T>) {
+    using U = std::remove_cv_t<std::remove_pointer_t<T>>;
+    if constexpr (std::is_same_v<U, String>) {
+      visitor->String(val);
+    } else if constexpr (has_static_reflection<U>::value) {
+      StaticIterateObject(*val, visitor);
+    } else {
+      visitor->Unknown(reinterpret_cast<const uint8_t *>(val));
+    }
+  } else if constexpr (has_static_reflection<T>::value) {
+    StaticIterateObject(val, visitor);  // Struct inside a struct.
+  } else if constexpr (std::is_enum_v<T>) {
+    // Found through ADL, generated next to EnumName<Enum>().
+    auto name = EnumName(val);
+    StaticIterateScalar(static_cast<std::underlying_type_t<T>>(val),
+                        name && *name ? name : nullptr, visitor);
+  } else {
+    StaticIterateScalar(val, nullptr, visitor);
+  }
+}
+
+// Visits a (union) value of which the type is stored in "type".
+template<typename E, typename Visitor>
+void StaticIterateUnion(E type, const void *val, Visitor *visitor) {
+  // Found through ADL, generated next to the union enum.
+  if (!VisitUnion(type, val,
+                  [&](const auto *u) { StaticIterateValue(u, visitor); })) {
+    visitor->Unknown(static_cast<const uint8_t *>(val));
+  }
+}
+
+template<size_t Index, typename T, typename Visitor>
+void StaticIterateField(const T &obj, size_t &set_idx, Visitor *visitor) {
+  using Traits = typename T::Traits;
+  using FieldType = typename Traits::template FieldType<Index>;
+  constexpr auto type = StaticElementaryType<FieldType>();
+  const uint8_t *val = nullptr;
+  if constexpr (std::is_base_of_v<Table, T>) {
+    val = reinterpret_cast<const Table *>(&obj)->GetAddressOf(
+        Traits::field_offsets[Index]);
+  } else {
+    val = reinterpret_cast<const uint8_t *>(&obj) +
+          Traits::field_offsets[Index];
+  }
+  using V = std::remove_cv_t<std::remove_pointer_t<std::decay_t<FieldType>>>;
+  constexpr bool is_vector = is_static_vector<V>::value;
+  visitor->Field(Index, set_idx, type, is_vector, nullptr,
+                 Traits::field_names[Index], val);
+  if (!val) return;
+  set_idx++;
+  const auto &field = obj.template get_field<Index>();
+  if constexpr (is_vector) {
+    visitor->StartVector();
+    for (size_t i = 0; i < field->size(); i++) {
+      visitor->Element(
+          i, type, nullptr,
+          field->Data() + i * is_static_vector<V>::element_stride);
+      const auto elem = field->Get(static_cast<typename V::size_type>(i));
+      if constexpr (std::is_same_v<std::decay_t<decltype(elem)>,
+                                   const void *>) {
+        static_assert(Index > 0, "Union vector without type vector");
+        StaticIterateUnion(obj.template get_field<Index - 1>()->Get(
+                               static_cast<typename V::size_type>(i)),
+                           elem, visitor);
+      } else {
+        StaticIterateValue(elem, visitor);
+      }
+    }
+    visitor->EndVector();
+  } else if constexpr (std::is_same_v<std::decay_t<FieldType>, const void *>) {
+    static_assert(Index > 0, "Union without type field");
+    StaticIterateUnion(obj.template get_field<Index - 1>(), field, visitor);
+  } else if constexpr (is_static_optional<std::decay_t<FieldType>>::value) {
+    StaticIterateValue(*field, visitor);
+  } else {
+    StaticIterateValue(field, visitor);
+  }
+}
+
+template<typename T, typename Visitor, size_t... Indexes>
+void StaticIterateFields(const T &obj, Visitor *visitor,
+                         std::index_sequence<Indexes...>) {
+  size_t set_idx = 0;
+  (void)obj;
+  (void)visitor;
+  (void)set_idx;
+  (StaticIterateField<Indexes>(obj, set_idx, visitor), ...);
+}
+
+template<typename T, typename Visitor>
+void StaticIterateObject(const T &obj, Visitor *visitor) {
+  visitor->StartSequence();
+  StaticIterateFields(obj, visitor,
+                      std::make_index_sequence<T::Traits::fields_number>{});
+  visitor->EndSequence();
+}
+
+// The output of ToStringVisitor, from a class without virtual methods, that
+// appends numbers in place instead of through NumToString.
+struct StaticToStringVisitor {
+  std::string s;
+  std::string d;
+  bool q;
+  std::string in;
+  size_t indent_level;
+  bool vector_delimited;
+  StaticToStringVisitor(std::string delimiter, bool quotes, std::string indent,
+                        bool vdelimited)
+      : d(delimiter),
+        q(quotes),
+        in(indent),
+        indent_level(0),
+        vector_delimited(vdelimited) {}
+
+  void append_indent() {
+    for (size_t i = 0; i < indent_level; i++) { s += in; }
+  }
+
+  void StartSequence() {
+    s += '{';
+    s += d;
+    indent_level++;
+  }
+  void EndSequence() {
+    s += d;
+    indent_level--;
+    append_indent();
+    s += '}';
+  }
+  void Field(size_t /*field_idx*/, size_t set_idx, ElementaryType /*type*/,
+             bool /*is_vector*/, const TypeTable * /*type_table*/,
+             const char *name, const uint8_t *val) {
+    if (!val) return;
+    if (set_idx) {
+      s += ',';
+      s += d;
+    }
+    append_indent();
+    if (name) {
+      if (q) s += '"';
+      s += name;
+      if (q) s += '"';
+      s += ": ";
+    }
+  }
+  template<typename T> void Named(T x, const char *name) {
+    if (name) {
+      if (q) s += '"';
+      s += name;
+      if (q) s += '"';
+    } else {
+      AppendInteger(x, &s);
+    }
+  }
+  void UType(uint8_t x, const char *name) { Named(x, name); }
+  void Bool(bool x) { s += x ? "true" : "false"; }
+  void Char(int8_t x, const char *name) { Named(x, name); }
+  void UChar(uint8_t x, const char *name) { Named(x, name); }
+  void Short(int16_t x, const char *name) { Named(x, name); }
+  void UShort(uint16_t x, const char *name) { Named(x, name); }
+  void Int(int32_t x, const char *name) { Named(x, name); }
+  void UInt(uint32_t x, const char *name) { Named(x, name); }
+  void Long(int64_t x) { AppendInteger(x, &s); }
+  void ULong(uint64_t x) { AppendInteger(x, &s); }
+  void Float(float x) { AppendFloat(x, 6, &s); }
+  void Double(double x) { AppendFloat(x, 12, &s); }
+  void String(const struct String *str) {
+    EscapeString(str->c_str(), str->size(), &s, true, false);
+  }
+  void Unknown(const uint8_t *) { s += "(?)"; }
+  void StartVector() {
+    s += '[';
+    if (vector_delimited) {
+      s += d;
+      indent_level++;
+      append_indent();
+    } else {
+      s += ' ';
+    }
+  }
+  void EndVector() {
+    if (vector_delimited) {
+      s += d;
+      indent_level--;
+      append_indent();
+    } else {
+      s += ' ';
+    }
+    s += ']';
+  }
+  void Element(size_t i, ElementaryType /*type*/,
+               const TypeTable * /*type_table*/, const uint8_t * /*val*/) {
+    if (i) {
+      s += ',';
+      if (vector_delimited) {
+        s += d;
+        append_indent();
+      } else {
+        s += ' ';
+      }
+    }
+  }
+};
+
+}  // namespace internal
+
+template<typename T, typename Visitor>
+void IterateObject(const T &obj, Visitor *visitor) {
+  internal::StaticIterateObject(obj, visitor);
+}
+
+template<typename T, typename Visitor>
+void IterateFlatBuffer(const uint8_t *buffer, Visitor *visitor) {
+  internal::StaticIterateObject(*GetRoot<T>(buffer), visitor);
+}
+
+// Same output as FlatBufferToString(buffer, T::MiniReflectTypeTable()).
+template<typename T>
+std::string FlatBufferToString(const uint8_t *buffer, bool multi_line = false,
+                               bool vector_delimited = true,
+                               const std::string &indent = "",
+                               bool quotes = false) {
+  internal::StaticToStringVisitor tostring_visitor(
+      multi_line ? "\n" : " ", quotes, indent, vector_delimited);
+  IterateFlatBuffer<T>(buffer, &tostring_visitor);
+  return tostring_visitor.s;
+}
+
+#endif  // __cplusplus >= 201703L
+
 }  // namespace flatbuffers
 
 #endif  // FLATBUFFERS_MINIREFLECT_H_
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2024 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_NATIVE_ARENA_H_
+#define FLATBUFFERS_NATIVE_ARENA_H_
+
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+#include "flatbuffers/base.h"
+
+namespace flatbuffers {
+
+// Support for object API code generated with `flatc --cpp-arena`, where
+// UnPack() takes a std::pmr::memory_resource and allocates all the native
+// objects, strings and vectors it creates from it. With a
+// std::pmr::monotonic_buffer_resource, a whole unpacked tree is then freed at
+// once by releasing the resource.
+
+// Deleter for native objects allocated from a memory resource. Objects that
+// weren't (the resource is null) are deleted as usual, so pointers using it
+// can hold either.
+template<typename T> struct ArenaDeleter {
+  ArenaDeleter() : resource(nullptr) {}
+  explicit ArenaDeleter(std::pmr::memory_resource *r) : resource(r) {}
+
+  void operator()(T *p) const {
+    if (!resource) {
+      delete p;
+      return;
+    }
+    p->~T();
+    resource->deallocate(p, sizeof(T), alignof(T));
+  }
+
+  std::pmr::memory_resource *resource;
+};
+
+// The pointer type for sub-objects of native objects in arena mode.
+template<typename T> using arena_ptr = std::unique_ptr<T, ArenaDeleter<T>>;
+
+// Creates a T from `resource`, passing it an allocator for `resource` if it
+// takes one, or on the heap if `resource` is null.
+template<typename T, typename... Args>
+arena_ptr<T> ArenaNew(std::pmr::memory_resource *resource, Args &&...args) {
+  if (!resource) return arena_ptr<T>(new T(std::forward<Args>(args)...));
+  std::pmr::polymorphic_allocator<T> alloc(resource);
+  T *p = alloc.allocate(1);
+  alloc.construct(p, std::forward<Args>(args)...);
+  return arena_ptr<T>(p, ArenaDeleter<T>(resource));
+}
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_NATIVE_ARENA_H_
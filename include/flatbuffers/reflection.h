@@ -470,6 +470,85 @@ void ResizeVector(const reflection::Schema &schema, uoffset_t newsize, T val,
   }
 }
 
+// Batched version of SetString / ResizeVector above.
+// Each of those calls walks the entire FlatBuffer to fix up offsets and then
+// moves all bytes after the insertion point, so N edits cost N times the size
+// of the buffer. ResizeBatch instead records any number of edits, and Apply()
+// fixes up all offsets in a single walk and moves every byte at most once.
+// All pointers passed in must point into "flatbuf", and must refer to
+// distinct strings / vectors. The buffer is not touched until Apply(), so
+// pointers into it (and in-place scalar setters like SetField) remain valid
+// while edits are being recorded. After Apply() all such pointers are
+// invalidated (use piv() if you need to hold on to them).
+// If your FlatBuffer's root table is not the schema's root table, you should
+// pass in your root_table type as well.
+class ResizeBatch {
+ public:
+  ResizeBatch(const reflection::Schema &schema, std::vector<uint8_t> *flatbuf,
+              const reflection::Object *root_table = nullptr)
+      : schema_(schema), flatbuf_(flatbuf), root_table_(root_table) {}
+
+  // Changes the contents of "str" to "val".
+  void SetString(const std::string &val, const String *str);
+
+  // Resizes "vec" to "newsize" elements, new elements are set to 0.
+  void ResizeAnyVector(uoffset_t newsize, const VectorOfAny *vec,
+                       uoffset_t num_elems, uoffset_t elem_size);
+
+  // Resizes "vec" to "newsize" elements, new elements are set to "val".
+  template<typename T>
+  void ResizeVector(uoffset_t newsize, T val, const Vector<T> *vec) {
+    uint8_t fill[sizeof(T)];
+    if (flatbuffers::is_scalar<T>::value) {
+      WriteScalar(fill, val);
+    } else {  // struct
+      memcpy(fill, &val, sizeof(T));
+    }
+    AddEdit(reinterpret_cast<const uint8_t *>(vec), vec->size(), newsize,
+            static_cast<uoffset_t>(sizeof(T)),
+            std::string(reinterpret_cast<const char *>(fill), sizeof(T)),
+            false);
+  }
+
+  // Number of edits recorded since the last Apply().
+  size_t size() const { return edits_.size(); }
+
+  // Performs all recorded edits on the buffer, and clears the batch.
+  void Apply();
+
+ private:
+  struct Edit {
+    uoffset_t object;     // Start of the string or vector (its length field).
+    uoffset_t point;      // End of the current payload, where bytes move.
+    int delta;            // Bytes inserted (or removed, if negative) at point.
+    uoffset_t old_len;    // Old number of elements / characters.
+    uoffset_t new_len;    // New number of elements / characters.
+    uoffset_t elem_size;  // 1 for strings.
+    std::string data;     // New string contents, or vector element filler.
+    bool is_string;
+  };
+
+  void AddEdit(const uint8_t *object, uoffset_t old_len, uoffset_t new_len,
+               uoffset_t elem_size, const std::string &data, bool is_string);
+
+  // Total amount of bytes inserted before "loc" (an offset into the
+  // unmodified buffer) once all edits have been applied.
+  int64_t Shift(uoffset_t loc) const;
+  template<typename T>
+  void FixOffset(uoffset_t loc, uoffset_t from, uoffset_t to);
+  void FixTable(const reflection::Object &objectdef, uoffset_t table);
+  void FixVector(const reflection::Field &fielddef, const Table &table,
+                 uoffset_t vec);
+  uint8_t &Visited(uoffset_t loc) { return visited_[loc / sizeof(uoffset_t)]; }
+
+  const reflection::Schema &schema_;
+  std::vector<uint8_t> *flatbuf_;
+  const reflection::Object *root_table_;
+  std::vector<Edit> edits_;
+  std::vector<int64_t> shifts_;  // Prefix sums of edits_[i].delta.
+  std::vector<uint8_t> visited_;
+};
+
 // Adds any new data (in the form of a new FlatBuffer) to an existing
 // FlatBuffer. This can be used when any of the above methods are not
 // sufficient, in particular for adding new tables and new fields.
@@ -197,13 +197,16 @@ struct Type FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     return GetField<uint32_t>(VT_ELEMENT_SIZE, 0);
   }
   bool Verify(::flatbuffers::Verifier &verifier) const {
+    static const ::flatbuffers::InlineField inline_fields_[] = {
+      { VT_BASE_TYPE, 1, 1 },
+      { VT_ELEMENT, 1, 1 },
+      { VT_INDEX, 4, 4 },
+      { VT_FIXED_LENGTH, 2, 2 },
+      { VT_BASE_SIZE, 4, 4 },
+      { VT_ELEMENT_SIZE, 4, 4 },
+    };
     return VerifyTableStart(verifier) &&
-           VerifyField<int8_t>(verifier, VT_BASE_TYPE, 1) &&
-           VerifyField<int8_t>(verifier, VT_ELEMENT, 1) &&
-           VerifyField<int32_t>(verifier, VT_INDEX, 4) &&
-           VerifyField<uint16_t>(verifier, VT_FIXED_LENGTH, 2) &&
-           VerifyField<uint32_t>(verifier, VT_BASE_SIZE, 4) &&
-           VerifyField<uint32_t>(verifier, VT_ELEMENT_SIZE, 4) &&
+           VerifyInlineFields(verifier, inline_fields_) &&
            verifier.EndTable();
   }
 };
@@ -676,27 +679,30 @@ struct Field FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     return GetField<uint8_t>(VT_OFFSET64, 0) != 0;
   }
   bool Verify(::flatbuffers::Verifier &verifier) const {
+    static const ::flatbuffers::InlineField inline_fields_[] = {
+      { VT_ID, 2, 2 },
+      { VT_OFFSET, 2, 2 },
+      { VT_DEFAULT_INTEGER, 8, 8 },
+      { VT_DEFAULT_REAL, 8, 8 },
+      { VT_DEPRECATED, 1, 1 },
+      { VT_REQUIRED, 1, 1 },
+      { VT_KEY, 1, 1 },
+      { VT_OPTIONAL, 1, 1 },
+      { VT_PADDING, 2, 2 },
+      { VT_OFFSET64, 1, 1 },
+    };
     return VerifyTableStart(verifier) &&
+           VerifyInlineFields(verifier, inline_fields_) &&
            VerifyOffsetRequired(verifier, VT_NAME) &&
            verifier.VerifyString(name()) &&
            VerifyOffsetRequired(verifier, VT_TYPE) &&
            verifier.VerifyTable(type()) &&
-           VerifyField<uint16_t>(verifier, VT_ID, 2) &&
-           VerifyField<uint16_t>(verifier, VT_OFFSET, 2) &&
-           VerifyField<int64_t>(verifier, VT_DEFAULT_INTEGER, 8) &&
-           VerifyField<double>(verifier, VT_DEFAULT_REAL, 8) &&
-           VerifyField<uint8_t>(verifier, VT_DEPRECATED, 1) &&
-           VerifyField<uint8_t>(verifier, VT_REQUIRED, 1) &&
-           VerifyField<uint8_t>(verifier, VT_KEY, 1) &&
            VerifyOffset(verifier, VT_ATTRIBUTES) &&
            verifier.VerifyVector(attributes()) &&
            verifier.VerifyVectorOfTables(attributes()) &&
            VerifyOffset(verifier, VT_DOCUMENTATION) &&
            verifier.VerifyVector(documentation()) &&
            verifier.VerifyVectorOfStrings(documentation()) &&
-           VerifyField<uint8_t>(verifier, VT_OPTIONAL, 1) &&
-           VerifyField<uint16_t>(verifier, VT_PADDING, 2) &&
-           VerifyField<uint8_t>(verifier, VT_OFFSET64, 1) &&
            verifier.EndTable();
   }
 };
@@ -881,15 +887,18 @@ struct Object FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     return GetPointer<const ::flatbuffers::String *>(VT_DECLARATION_FILE);
   }
   bool Verify(::flatbuffers::Verifier &verifier) const {
+    static const ::flatbuffers::InlineField inline_fields_[] = {
+      { VT_IS_STRUCT, 1, 1 },
+      { VT_MINALIGN, 4, 4 },
+      { VT_BYTESIZE, 4, 4 },
+    };
     return VerifyTableStart(verifier) &&
+           VerifyInlineFields(verifier, inline_fields_) &&
            VerifyOffsetRequired(verifier, VT_NAME) &&
            verifier.VerifyString(name()) &&
            VerifyOffsetRequired(verifier, VT_FIELDS) &&
            verifier.VerifyVector(fields()) &&
            verifier.VerifyVectorOfTables(fields()) &&
-           VerifyField<uint8_t>(verifier, VT_IS_STRUCT, 1) &&
-           VerifyField<int32_t>(verifier, VT_MINALIGN, 4) &&
-           VerifyField<int32_t>(verifier, VT_BYTESIZE, 4) &&
            VerifyOffset(verifier, VT_ATTRIBUTES) &&
            verifier.VerifyVector(attributes()) &&
            verifier.VerifyVectorOfTables(attributes()) &&
@@ -1480,6 +1489,11 @@ inline const reflection::Schema *GetSchema(const void *buf) {
   return ::flatbuffers::GetRoot<reflection::Schema>(buf);
 }
 
+inline const reflection::Schema *GetSchema(
+    const ::flatbuffers::TrustedBuffer<reflection::Schema> &buf) {
+  return ::flatbuffers::GetRoot(buf);
+}
+
 inline const reflection::Schema *GetSizePrefixedSchema(const void *buf) {
   return ::flatbuffers::GetSizePrefixedRoot<reflection::Schema>(buf);
 }
@@ -1508,6 +1522,12 @@ inline bool VerifySizePrefixedSchemaBuffer(
   return verifier.VerifySizePrefixedBuffer<reflection::Schema>(SchemaIdentifier());
 }
 
+inline ::flatbuffers::TrustedBuffer<reflection::Schema> TrustSchemaBuffer(
+    ::flatbuffers::DetachedBuffer &&buf) {
+  return ::flatbuffers::TrustedBuffer<reflection::Schema>::Verify(
+      std::move(buf), SchemaIdentifier());
+}
+
 inline const char *SchemaExtension() {
   return "bfbs";
 }
@@ -1524,6 +1544,12 @@ inline void FinishSizePrefixedSchemaBuffer(
   fbb.FinishSizePrefixed(root, SchemaIdentifier());
 }
 
+inline ::flatbuffers::TrustedBuffer<reflection::Schema> FinishAndReleaseSchemaBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<reflection::Schema> root) {
+  return fbb.FinishAndRelease(root, SchemaIdentifier());
+}
+
 }  // namespace reflection
 
 #endif  // FLATBUFFERS_GENERATED_REFLECTION_REFLECTION_H_
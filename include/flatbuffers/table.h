@@ -131,6 +131,14 @@ class Table {
     return !field_offset || verifier.VerifyField<T>(data_, field_offset, align);
   }
 
+  // Verify the inline fields listed in `fields` at once, in place of a
+  // VerifyField() call for each of them.
+  template<size_t N>
+  bool VerifyInlineFields(const Verifier &verifier,
+                          const InlineField (&fields)[N]) const {
+    return verifier.VerifyInlineFields(data_, fields, N);
+  }
+
   // VerifyField for required fields.
   template<typename T>
   bool VerifyFieldRequired(const Verifier &verifier, voffset_t field,
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2024 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_TRUSTED_BUFFER_H_
+#define FLATBUFFERS_TRUSTED_BUFFER_H_
+
+#include <utility>
+
+#include "flatbuffers/base.h"
+#include "flatbuffers/buffer.h"
+#include "flatbuffers/detached_buffer.h"
+#include "flatbuffers/verifier.h"
+
+namespace flatbuffers {
+
+template<bool Is64Aware> class FlatBufferBuilderImpl;
+
+// A finished buffer with root type T that is known to be valid, because it
+// was either released by the FlatBufferBuilder that built it, see
+// FlatBufferBuilder::FinishAndRelease(), or passed Verify() below. Those are
+// the only ways to make a non-empty one, and its contents can't be modified,
+// so code that takes a TrustedBuffer<T> can read it without verifying it
+// again. It owns its memory like the DetachedBuffer it wraps.
+template<typename T> class TrustedBuffer {
+ public:
+  TrustedBuffer() {}
+
+  TrustedBuffer(TrustedBuffer &&other) noexcept
+      : buf_(std::move(other.buf_)) {}
+
+  TrustedBuffer &operator=(TrustedBuffer &&other) noexcept {
+    buf_ = std::move(other.buf_);
+    return *this;
+  }
+
+  // Verifies `buf` as a buffer with root type T, and takes it over if it is
+  // valid. Otherwise returns an empty TrustedBuffer and leaves `buf` alone.
+  static TrustedBuffer Verify(
+      DetachedBuffer &&buf, const char *identifier = nullptr,
+      const Verifier::Options &opts = Verifier::Options()) {
+    Verifier verifier(buf.data(), buf.size(), opts);
+    if (!buf.data() || !verifier.VerifyBuffer<T>(identifier)) {
+      return TrustedBuffer();
+    }
+    return TrustedBuffer(std::move(buf));
+  }
+
+  bool empty() const { return buf_.data() == nullptr; }
+
+  const uint8_t *data() const { return buf_.data(); }
+
+  size_t size() const { return buf_.size(); }
+
+  // The root table, or nullptr if empty.
+  const T *root() const {
+    return empty() ? nullptr : flatbuffers::GetRoot<T>(buf_.data());
+  }
+
+  // Gives up the buffer, and with it the guarantee that it is valid.
+  DetachedBuffer Release() { return std::move(buf_); }
+
+  // These may change access mode, leave these at end of public section
+  FLATBUFFERS_DELETE_FUNC(TrustedBuffer(const TrustedBuffer &other));
+  FLATBUFFERS_DELETE_FUNC(TrustedBuffer &operator=(const TrustedBuffer &other));
+
+ private:
+  template<bool Is64Aware> friend class FlatBufferBuilderImpl;
+
+  explicit TrustedBuffer(DetachedBuffer &&buf) : buf_(std::move(buf)) {}
+
+  DetachedBuffer buf_;
+};
+
+// GetRoot() for a buffer that needs no verification.
+template<typename T> const T *GetRoot(const TrustedBuffer<T> &buf) {
+  return buf.root();
+}
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_TRUSTED_BUFFER_H_
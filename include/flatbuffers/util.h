@@ -31,6 +31,7 @@
 #  include <stdio.h>
 #endif  // FLATBUFFERS_PREFER_PRINTF
 
+#include <cfloat>
 #include <cmath>
 #include <limits>
 #include <string>
@@ -149,25 +150,144 @@ template<> inline std::string NumToString<char>(char t) {
   return NumToString(static_cast<int>(t));
 }
 
+// Multiplies two 64-bit values into a 128-bit result split in two halves.
+inline void Mul64To128(uint64_t a, uint64_t b, uint64_t *hi, uint64_t *lo) {
+  const uint64_t a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32;
+  const uint64_t b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+  const uint64_t p0 = a_lo * b_lo;
+  const uint64_t p1 = a_lo * b_hi;
+  const uint64_t p2 = a_hi * b_lo;
+  const uint64_t mid = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+  *lo = (mid << 32) | (p0 & 0xFFFFFFFFu);
+  *hi = a_hi * b_hi + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+}
+
+// Size of the buffer FloatToFixedChars() writes to.
+static const size_t kFloatToFixedCharsSize = 48;
+
+// Prints `t` like printf("%.*f", precision, t) does, without going through
+// the C library or the current locale. The value, which is m * 2^-s for
+// integers m and s, is scaled to round(|t| * 10^precision) exactly with
+// 128-bit integer arithmetic, rounding ties to even as printf does.
+// Returns the length written to `buf` (kFloatToFixedCharsSize chars), or 0 if
+// the value is not finite or too large for this fast path.
+inline int FloatToFixedChars(double t, int precision, char *buf) {
+  static const uint64_t kPowersOf10[] = { 1ULL,
+                                          10ULL,
+                                          100ULL,
+                                          1000ULL,
+                                          10000ULL,
+                                          100000ULL,
+                                          1000000ULL,
+                                          10000000ULL,
+                                          100000000ULL,
+                                          1000000000ULL,
+                                          10000000000ULL,
+                                          100000000000ULL,
+                                          1000000000000ULL,
+                                          10000000000000ULL,
+                                          100000000000000ULL,
+                                          1000000000000000ULL,
+                                          10000000000000000ULL,
+                                          100000000000000000ULL };
+  if (precision < 0 || precision > 17) return 0;
+  uint64_t bits;
+  memcpy(&bits, &t, sizeof(bits));
+  const bool negative = (bits >> 63) != 0;
+  const int exponent = static_cast<int>((bits >> 52) & 0x7FF);
+  uint64_t mantissa = bits & ((1ULL << 52) - 1);
+  if (exponent == 0x7FF) return 0;  // inf or nan
+  int shift = 1074;                 // subnormal: t = mantissa * 2^-1074
+  if (exponent) {
+    mantissa |= 1ULL << 52;
+    shift = 1075 - exponent;
+  }
+  if (shift < 0) return 0;  // at least 2^53, too large anyway
+  uint64_t hi, lo;
+  Mul64To128(mantissa, kPowersOf10[precision], &hi, &lo);
+  // Split hi:lo into the quotient q and remainder of a division by 2^shift,
+  // and compare the remainder against half the divisor (2^(shift - 1)).
+  uint64_t q = 0;
+  int rem_vs_half = -1;
+  if (shift == 0) {
+    if (hi) return 0;
+    q = lo;
+  } else if (shift < 64) {
+    if (hi >> shift) return 0;
+    q = (lo >> shift) | (hi << (64 - shift));
+    const uint64_t rem = lo & ((1ULL << shift) - 1);
+    const uint64_t half = 1ULL << (shift - 1);
+    rem_vs_half = rem < half ? -1 : (rem > half ? 1 : 0);
+  } else if (shift == 64) {
+    q = hi;
+    rem_vs_half = lo < (1ULL << 63) ? -1 : (lo > (1ULL << 63) ? 1 : 0);
+  } else if (shift < 128) {
+    // Both the remainder and half of the divisor span hi:lo, with half's low
+    // 64 bits all zero.
+    const int hi_shift = shift - 64;
+    q = hi >> hi_shift;
+    const uint64_t rem_hi = hi & ((1ULL << hi_shift) - 1);
+    const uint64_t half_hi = 1ULL << (hi_shift - 1);
+    if (rem_hi != half_hi) {
+      rem_vs_half = rem_hi < half_hi ? -1 : 1;
+    } else {
+      rem_vs_half = lo ? 1 : 0;
+    }
+  }
+  // else: the product is below 2^117, much less than half of 2^shift.
+  if (q > 9999999999999999999ULL) return 0;
+  if (rem_vs_half > 0 || (rem_vs_half == 0 && (q & 1))) q++;
+  if (q > 9999999999999999999ULL) return 0;
+  // Print the digits of q backwards, with the point `precision` from the end.
+  char digits[24];
+  char *end = digits + sizeof(digits);
+  char *p = end;
+  int count = 0;
+  do {
+    *--p = static_cast<char>('0' + q % 10);
+    q /= 10;
+    count++;
+  } while (q || count <= precision);
+  int len = 0;
+  if (negative) buf[len++] = '-';
+  const int int_digits = count - precision;
+  memcpy(buf + len, p, static_cast<size_t>(int_digits));
+  len += int_digits;
+  if (precision) {
+    buf[len++] = '.';
+    memcpy(buf + len, p + int_digits, static_cast<size_t>(precision));
+    len += precision;
+  }
+  buf[len] = '\0';
+  return len;
+}
+
 // Special versions for floats/doubles.
 template<typename T> std::string FloatToString(T t, int precision) {
-  // clang-format off
-
-  #ifndef FLATBUFFERS_PREFER_PRINTF
-    // to_string() prints different numbers of digits for floats depending on
-    // platform and isn't available on Android, so we use stringstream
-    std::stringstream ss;
-    // Use std::fixed to suppress scientific notation.
-    ss << std::fixed;
-    // Default precision is 6, we want that to be higher for doubles.
-    ss << std::setprecision(precision);
-    ss << t;
-    auto s = ss.str();
-  #else // FLATBUFFERS_PREFER_PRINTF
-    auto v = static_cast<double>(t);
-    auto s = NumToStringImplWrapper(v, "%0.*f", precision);
-  #endif // FLATBUFFERS_PREFER_PRINTF
-  // clang-format on
+  char buf[kFloatToFixedCharsSize];
+  const int len = FloatToFixedChars(static_cast<double>(t), precision, buf);
+  std::string s;
+  if (len > 0) {
+    s.assign(buf, static_cast<size_t>(len));
+  } else {
+    // clang-format off
+
+    #ifndef FLATBUFFERS_PREFER_PRINTF
+      // to_string() prints different numbers of digits for floats depending
+      // on platform and isn't available on Android, so we use stringstream
+      std::stringstream ss;
+      // Use std::fixed to suppress scientific notation.
+      ss << std::fixed;
+      // Default precision is 6, we want that to be higher for doubles.
+      ss << std::setprecision(precision);
+      ss << t;
+      s = ss.str();
+    #else // FLATBUFFERS_PREFER_PRINTF
+      auto v = static_cast<double>(t);
+      s = NumToStringImplWrapper(v, "%0.*f", precision);
+    #endif // FLATBUFFERS_PREFER_PRINTF
+    // clang-format on
+  }
   // Sadly, std::fixed turns "1" into "1.00000", so here we undo that.
   auto p = s.find_last_not_of('0');
   if (p != std::string::npos) {
@@ -184,6 +304,78 @@ template<> inline std::string NumToString<float>(float t) {
   return FloatToString(t, 6);
 }
 
+// Appends the decimal digits of `val` to `text`, two at a time from a lookup
+// table.
+inline void AppendDigits(uint64_t val, std::string *text) {
+  static const char kDigitPairs[] =
+      "00010203040506070809"
+      "10111213141516171819"
+      "20212223242526272829"
+      "30313233343536373839"
+      "40414243444546474849"
+      "50515253545556575859"
+      "60616263646566676869"
+      "70717273747576777879"
+      "80818283848586878889"
+      "90919293949596979899";
+  char buf[20];
+  char *end = buf + sizeof(buf);
+  char *p = end;
+  while (val >= 100) {
+    const auto pair = static_cast<size_t>(val % 100) * 2;
+    val /= 100;
+    *--p = kDigitPairs[pair + 1];
+    *--p = kDigitPairs[pair];
+  }
+  if (val >= 10) {
+    const auto pair = static_cast<size_t>(val) * 2;
+    *--p = kDigitPairs[pair + 1];
+    *--p = kDigitPairs[pair];
+  } else {
+    *--p = static_cast<char>('0' + val);
+  }
+  text->append(p, static_cast<size_t>(end - p));
+}
+
+template<typename T>
+void AppendInteger(T val, std::string *text, std::true_type /*signed*/) {
+  if (val < 0) {
+    *text += '-';
+    // Negate after widening, so the minimum value doesn't overflow.
+    AppendDigits(0 - static_cast<uint64_t>(val), text);
+  } else {
+    AppendDigits(static_cast<uint64_t>(val), text);
+  }
+}
+
+template<typename T>
+void AppendInteger(T val, std::string *text, std::false_type /*signed*/) {
+  AppendDigits(static_cast<uint64_t>(val), text);
+}
+
+// Same as `*text += NumToString(val)` for an integer, without building a
+// temporary string.
+template<typename T> void AppendInteger(T val, std::string *text) {
+  AppendInteger(val, text, std::is_signed<T>());
+}
+
+// Same as `*text += FloatToString(val, precision)`, without building a
+// temporary string unless the value needs the slow path.
+template<typename T>
+void AppendFloat(T val, int precision, std::string *text) {
+  char buf[kFloatToFixedCharsSize];
+  const int len = FloatToFixedChars(static_cast<double>(val), precision, buf);
+  if (len <= 0) {
+    *text += FloatToString(val, precision);
+    return;
+  }
+  // Strip trailing zeroes. If it is a whole number, keep one zero.
+  auto p = len - 1;
+  while (p > 0 && buf[p] == '0') p--;
+  if (buf[p] == '.') p++;
+  text->append(buf, static_cast<size_t>(p + 1));
+}
+
 // Convert an integer value to a hexadecimal string.
 // The returned string length is always xdigits long, prefixed by 0 digits.
 // For example, IntToStringHex(0x23, 8) returns the string "00000023".
@@ -267,6 +459,143 @@ inline void strtoval_impl(float *val, const char *str, char **endptr) {
 #undef __strtof_impl
 // clang-format on
 
+// Plain decimal integers of up to 18 digits, with an optional sign, can't
+// overflow 64 bits and are parsed here without strtoll/strtoull.
+inline bool ParseShortDecimal(const char *s, bool *negative, uint64_t *mag) {
+  *negative = *s == '-';
+  if (*s == '-' || *s == '+') s++;
+  const char *digits = s;
+  uint64_t m = 0;
+  for (; is_digit(*s); s++) {
+    if (s - digits == 18) return false;
+    m = m * 10 + static_cast<uint64_t>(*s - '0');
+  }
+  if (*s || s == digits) return false;
+  *mag = m;
+  return true;
+}
+
+inline bool DecimalFastPath(const char *str, int64_t *val) {
+  bool negative;
+  uint64_t mag;
+  if (!ParseShortDecimal(str, &negative, &mag)) return false;
+  *val = negative ? -static_cast<int64_t>(mag) : static_cast<int64_t>(mag);
+  return true;
+}
+
+inline bool DecimalFastPath(const char *str, uint64_t *val) {
+  bool negative;
+  uint64_t mag;
+  // strtoull wraps negative input around, leave that to it.
+  if (!ParseShortDecimal(str, &negative, &mag) || negative) return false;
+  *val = mag;
+  return true;
+}
+
+// Splits a plain decimal floating point number ("-12.5e-3") into its sign,
+// significand and power of ten, if the significand has at most 19 digits.
+inline bool ParseDecimalFloat(const char *s, bool *negative, uint64_t *mag,
+                              int *exp10) {
+  *negative = *s == '-';
+  if (*s == '-' || *s == '+') s++;
+  uint64_t m = 0;
+  int significant = 0, digits = 0, e = 0;
+  for (; is_digit(*s); s++, digits++) {
+    if (significant || *s != '0') significant++;
+    m = m * 10 + static_cast<uint64_t>(*s - '0');
+    if (significant > 19) return false;
+  }
+  if (*s == '.') {
+    for (s++; is_digit(*s); s++, digits++, e--) {
+      if (significant || *s != '0') significant++;
+      m = m * 10 + static_cast<uint64_t>(*s - '0');
+      if (significant > 19) return false;
+    }
+  }
+  if (!digits) return false;
+  if (*s == 'e' || *s == 'E') {
+    s++;
+    const bool negative_exp = *s == '-';
+    if (*s == '-' || *s == '+') s++;
+    const char *exp_digits = s;
+    int exp = 0;
+    for (; is_digit(*s); s++) {
+      if (s - exp_digits == 5) return false;
+      exp = exp * 10 + (*s - '0');
+    }
+    if (s == exp_digits) return false;
+    e += negative_exp ? -exp : exp;
+  }
+  if (*s) return false;
+  *mag = m;
+  *exp10 = e;
+  return true;
+}
+
+// Exact fast path for strtod: when the significand and the power of ten are
+// both exactly representable (at most 2^53 and 10^22), one correctly rounded
+// multiplication or division gives the correctly rounded result (Clinger's
+// fast path), which is bit for bit what strtod returns. Only enabled when
+// doubles are evaluated in double precision, not in x87 extended precision.
+inline bool DecimalFastPath(const char *str, double *val) {
+  // clang-format off
+  #if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+    static const double kPowersOf10[] = { 1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                          1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                          1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                          1e18, 1e19, 1e20, 1e21, 1e22 };
+    bool negative;
+    uint64_t mag;
+    int exp10;
+    if (!ParseDecimalFloat(str, &negative, &mag, &exp10)) return false;
+    double v = 0.0;
+    if (mag) {
+      if (mag > (1ULL << 53) || exp10 < -22 || exp10 > 22) return false;
+      v = static_cast<double>(mag);
+      v = exp10 < 0 ? v / kPowersOf10[-exp10] : v * kPowersOf10[exp10];
+    }
+    *val = negative ? -v : v;
+    return true;
+  #else
+    (void)str;
+    (void)val;
+    return false;
+  #endif
+  // clang-format on
+}
+
+inline bool DecimalFastPath(const char *str, float *val) {
+  // clang-format off
+  #if defined(FLATBUFFERS_LOCALE_INDEPENDENT) && \
+      (FLATBUFFERS_LOCALE_INDEPENDENT > 0) && \
+      defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+    // strtof rounds once, straight to float: the same fast path applies with
+    // float limits (2^24 and 10^10).
+    static const float kPowersOf10[] = { 1e0f, 1e1f, 1e2f, 1e3f,
+                                         1e4f, 1e5f, 1e6f, 1e7f,
+                                         1e8f, 1e9f, 1e10f };
+    bool negative;
+    uint64_t mag;
+    int exp10;
+    if (!ParseDecimalFloat(str, &negative, &mag, &exp10)) return false;
+    float v = 0.0f;
+    if (mag) {
+      if (mag > (1ULL << 24) || exp10 < -10 || exp10 > 10) return false;
+      v = static_cast<float>(mag);
+      v = exp10 < 0 ? v / kPowersOf10[-exp10] : v * kPowersOf10[exp10];
+    }
+    *val = negative ? -v : v;
+    return true;
+  #else
+    // Floats are parsed as doubles and narrowed, see strtoval_impl.
+    double d;
+    if (!DecimalFastPath(str, &d)) return false;
+    *val = static_cast<float>(d);
+    return true;
+  #endif
+  // clang-format on
+}
+
 // Adaptor for strtoull()/strtoll().
 // Flatbuffers accepts numbers with any count of leading zeros (-009 is -9),
 // while strtoll with base=0 interprets first leading zero as octal prefix.
@@ -293,6 +622,7 @@ inline bool StringToIntegerImpl(T *val, const char *const str,
     // if a prefix not match, try base=10
     return StringToIntegerImpl(val, str, 10, check_errno);
   } else {
+    if (base == 10 && DecimalFastPath(str, val)) return true;
     if (check_errno) errno = 0;  // clear thread-local errno
     auto endptr = str;
     strtoval_impl(val, str, const_cast<char **>(&endptr), base);
@@ -310,6 +640,7 @@ template<typename T>
 inline bool StringToFloatImpl(T *val, const char *const str) {
   // Type T must be either float or double.
   FLATBUFFERS_ASSERT(str && val);
+  if (DecimalFastPath(str, val)) return true;
   auto end = str;
   strtoval_impl(val, str, const_cast<char **>(&end));
   auto done = (end != str) && (*end == '\0');
@@ -410,12 +741,16 @@ inline bool StringIsFlatbufferNegativeInfinity(const std::string &s) {
 typedef bool (*LoadFileFunction)(const char *filename, bool binary,
                                  std::string *dest);
 typedef bool (*FileExistsFunction)(const char *filename);
+typedef bool (*SaveFileFunction)(const char *filename, const char *buf,
+                                 size_t len, bool binary);
 
 LoadFileFunction SetLoadFileFunction(LoadFileFunction load_file_function);
 
 FileExistsFunction SetFileExistsFunction(
     FileExistsFunction file_exists_function);
 
+SaveFileFunction SetSaveFileFunction(SaveFileFunction save_file_function);
+
 // Check if file "name" exists.
 bool FileExists(const char *name);
 
@@ -443,6 +778,44 @@ inline bool SaveFile(const char *name, const std::string &buf, bool binary) {
   return SaveFile(name, buf.c_str(), buf.size(), binary);
 }
 
+// Like SaveFile, but leaves file "name" alone if it already holds exactly
+// "buf", so that its modification time only moves when its contents do.
+// Sets "changed" (when not null) to whether the file was written.
+bool SaveFileIfChanged(const char *name, const char *buf, size_t len,
+                       bool binary, bool *changed);
+
+// Read-only view of the whole contents of a file, opened in binary mode.
+// Where the platform supports it the file is memory mapped, so that large
+// binaries are paged in on demand instead of being copied into memory up
+// front. Otherwise, or when a custom LoadFileFunction is installed, the
+// contents are loaded with LoadFile.
+class MappedFile {
+ public:
+  MappedFile() : data_(nullptr), size_(0), mapping_(nullptr) {}
+  ~MappedFile() { Close(); }
+
+  // Opens file "name", returning true if successful.
+  bool Open(const char *name);
+
+  // Releases the contents, after which the view is empty.
+  void Close();
+
+  const uint8_t *data() const { return data_; }
+  size_t size() const { return size_; }
+
+  // Whether the contents are memory mapped rather than a loaded copy.
+  bool mapped() const { return mapping_ != nullptr; }
+
+ private:
+  FLATBUFFERS_DELETE_FUNC(MappedFile(const MappedFile &other));
+  FLATBUFFERS_DELETE_FUNC(MappedFile &operator=(const MappedFile &other));
+
+  const uint8_t *data_;
+  size_t size_;
+  void *mapping_;     // Start of the mapping, if mapped.
+  std::string copy_;  // The contents, if not mapped.
+};
+
 // Functionality for minimalistic portable path handling.
 
 // The functions below behave correctly regardless of whether posix ('/') or
@@ -596,11 +969,45 @@ inline std::string WordWrap(const std::string in, size_t max_length,
 }
 #endif  // !FLATBUFFERS_PREFER_PRINTF
 
+// Returns the length of the leading run of printable ASCII characters in `s`
+// that EscapeString can copy verbatim. Checks 8 bytes at a time, so long
+// strings without escapes are copied with a single append.
+inline size_t EscapeFreePrefixLength(const char *s, size_t length) {
+  const uint64_t ones = 0x0101010101010101ULL;
+  const uint64_t highs = ones * 0x80;
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+    uint64_t w;
+    memcpy(&w, s + i, sizeof(w));
+    // Standard "has byte less than n" / "has zero byte" word tricks: flag
+    // control characters, non-ASCII, DEL, '"' and '\\'.
+    const uint64_t quote = w ^ (ones * '"');
+    const uint64_t backslash = w ^ (ones * '\\');
+    const uint64_t del = w ^ (ones * 0x7F);
+    const uint64_t special = ((w - ones * 0x20) & ~w) | w |
+                             ((quote - ones) & ~quote) |
+                             ((backslash - ones) & ~backslash) |
+                             ((del - ones) & ~del);
+    if (special & highs) break;
+  }
+  for (; i < length; i++) {
+    const char c = s[i];
+    if (c < ' ' || c > '~' || c == '\"' || c == '\\') break;
+  }
+  return i;
+}
+
 inline bool EscapeString(const char *s, size_t length, std::string *_text,
                          bool allow_non_utf8, bool natural_utf8) {
   std::string &text = *_text;
   text += "\"";
   for (uoffset_t i = 0; i < length; i++) {
+    const auto run = EscapeFreePrefixLength(s + i, length - i);
+    if (run) {
+      text.append(s + i, run);
+      i += static_cast<uoffset_t>(run);
+      if (i == length) break;
+    }
     char c = s[i];
     switch (c) {
       case '\n': text += "\\n"; break;
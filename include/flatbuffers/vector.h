@@ -370,6 +370,43 @@ FLATBUFFERS_CONSTEXPR_CPP11 flatbuffers::span<const U> make_span(
   return ptr ? make_span(*ptr) : span<const U>();
 }
 
+// Struct-of-arrays access to vectors of structs: copies one scalar field of
+// each struct into a contiguous column, or a column into the structs. `W` is
+// the type the field is stored as (such as the underlying type of an enum),
+// and `field_offset` its offset in T. Generated structs wrap these as
+// gather_x() and scatter_x(). The loops have a constant stride so compilers
+// can vectorize them.
+
+// Returns the number of values copied, the smaller of the two sizes, or 0
+// if `vec` is null (the field is not set).
+template<typename W, typename T, typename SizeT, typename C>
+size_t GatherStructField(const Vector<const T *, SizeT> *vec,
+                         size_t field_offset, span<C> column) {
+  if (!vec) return 0;
+  const size_t n = (std::min)(static_cast<size_t>(vec->size()), column.size());
+  const uint8_t *src = vec->Data() + field_offset;
+  C *dst = column.data();
+  for (size_t i = 0; i < n; i++) {
+    dst[i] = static_cast<C>(ReadScalar<W>(src + i * sizeof(T)));
+  }
+  return n;
+}
+
+// Writes `column` into the field of `structs`, e.g. ones allocated with
+// FlatBufferBuilder::CreateUninitializedVectorOfStructs(). Returns the number
+// of values copied.
+template<typename W, typename C, typename T>
+size_t ScatterStructField(span<const C> column, size_t field_offset,
+                          span<T> structs) {
+  const size_t n = (std::min)(column.size(), structs.size());
+  const C *src = column.data();
+  uint8_t *dst = reinterpret_cast<uint8_t *>(structs.data()) + field_offset;
+  for (size_t i = 0; i < n; i++) {
+    WriteScalar(dst + i * sizeof(T), static_cast<W>(src[i]));
+  }
+  return n;
+}
+
 // Represent a vector much like the template above, but in this case we
 // don't know what the element types are (used with reflection.h).
 class VectorOfAny {
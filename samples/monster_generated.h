@@ -146,7 +146,9 @@ struct EquipmentUnion {
   }
 
   static void *UnPack(const void *obj, Equipment type, const ::flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, const ::flatbuffers::resolver_function_t *resolver);
   ::flatbuffers::Offset<void> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t PackedSize() const;
 
   MyGame::Sample::WeaponT *AsWeapon() {
     return type == Equipment_Weapon ?
@@ -332,19 +334,22 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     return GetPointer<::flatbuffers::Vector<const MyGame::Sample::Vec3 *> *>(VT_PATH);
   }
   bool Verify(::flatbuffers::Verifier &verifier) const {
+    static const ::flatbuffers::InlineField inline_fields_[] = {
+      { VT_POS, 12, 4 },
+      { VT_MANA, 2, 2 },
+      { VT_HP, 2, 2 },
+      { VT_COLOR, 1, 1 },
+      { VT_EQUIPPED_TYPE, 1, 1 },
+    };
     return VerifyTableStart(verifier) &&
-           VerifyField<MyGame::Sample::Vec3>(verifier, VT_POS, 4) &&
-           VerifyField<int16_t>(verifier, VT_MANA, 2) &&
-           VerifyField<int16_t>(verifier, VT_HP, 2) &&
+           VerifyInlineFields(verifier, inline_fields_) &&
            VerifyOffset(verifier, VT_NAME) &&
            verifier.VerifyString(name()) &&
            VerifyOffset(verifier, VT_INVENTORY) &&
            verifier.VerifyVector(inventory()) &&
-           VerifyField<int8_t>(verifier, VT_COLOR, 1) &&
            VerifyOffset(verifier, VT_WEAPONS) &&
            verifier.VerifyVector(weapons()) &&
            verifier.VerifyVectorOfTables(weapons()) &&
-           VerifyField<uint8_t>(verifier, VT_EQUIPPED_TYPE, 1) &&
            VerifyOffset(verifier, VT_EQUIPPED) &&
            VerifyEquipment(verifier, equipped(), equipped_type()) &&
            VerifyOffset(verifier, VT_PATH) &&
@@ -354,6 +359,7 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   MonsterT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(MonsterT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static ::flatbuffers::Offset<Monster> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static size_t PackedSize(const MonsterT &_o);
 };
 
 template<> inline const MyGame::Sample::Weapon *Monster::equipped_as<MyGame::Sample::Weapon>() const {
@@ -501,6 +507,7 @@ struct Weapon FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   WeaponT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(WeaponT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static ::flatbuffers::Offset<Weapon> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const WeaponT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static size_t PackedSize(const WeaponT &_o);
 };
 
 struct WeaponBuilder {
@@ -601,22 +608,35 @@ inline MonsterT *Monster::UnPack(const ::flatbuffers::resolver_function_t *_reso
 inline void Monster::UnPackTo(MonsterT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = pos(); if (_e) _o->pos = std::unique_ptr<MyGame::Sample::Vec3>(new MyGame::Sample::Vec3(*_e)); }
+  { auto _e = pos(); if (_e) { if(_o->pos) { *_o->pos = *_e; } else { _o->pos = std::unique_ptr<MyGame::Sample::Vec3>(new MyGame::Sample::Vec3(*_e)); } } else if (_o->pos) { _o->pos.reset(); } }
   { auto _e = mana(); _o->mana = _e; }
   { auto _e = hp(); _o->hp = _e; }
-  { auto _e = name(); if (_e) _o->name = _e->str(); }
-  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->inventory.begin()); } }
+  { auto _e = name(); if (_e) { _o->name.assign(_e->c_str(), _e->size()); } else { _o->name.clear(); } }
+  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->inventory.begin()); } else { _o->inventory.resize(0); } }
   { auto _e = color(); _o->color = _e; }
   { auto _e = weapons(); if (_e) { _o->weapons.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->weapons[_i]) { _e->Get(_i)->UnPackTo(_o->weapons[_i].get(), _resolver); } else { _o->weapons[_i] = std::unique_ptr<MyGame::Sample::WeaponT>(_e->Get(_i)->UnPack(_resolver)); } } } else { _o->weapons.resize(0); } }
-  { auto _e = equipped_type(); _o->equipped.type = _e; }
-  { auto _e = equipped(); if (_e) _o->equipped.value = MyGame::Sample::EquipmentUnion::UnPack(_e, equipped_type(), _resolver); }
+  { auto _e = equipped_type(); if (_o->equipped.type != _e) { _o->equipped.Reset(); _o->equipped.type = _e; } }
+  { auto _e = equipped(); if (_e) _o->equipped.UnPackTo(_e, _resolver); }
   { auto _e = path(); if (_e) { _o->path.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->path[_i] = *_e->Get(_i); } } else { _o->path.resize(0); } }
 }
 
 inline ::flatbuffers::Offset<Monster> Monster::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(::flatbuffers::PackedBufferSize(PackedSize(*_o)));
   return CreateMonster(_fbb, _o, _rehasher);
 }
 
+inline size_t Monster::PackedSize(const MonsterT &_o) {
+  (void)_o;
+  size_t _s = ::flatbuffers::PackedTableSize(10, 58);
+  _s += ::flatbuffers::PackedStringSize(_o.name.length());
+  _s += ::flatbuffers::PackedVectorSize(_o.inventory.size(), 1, 1);
+  _s += ::flatbuffers::PackedOffsetVectorSize(_o.weapons.size());
+  for (size_t _i = 0; _i < _o.weapons.size(); _i++) _s += MyGame::Sample::Weapon::PackedSize(*_o.weapons[_i].get());
+  _s += _o.equipped.PackedSize();
+  _s += ::flatbuffers::PackedVectorSize(_o.path.size(), 12, 4);
+  return _s;
+}
+
 inline ::flatbuffers::Offset<Monster> CreateMonster(::flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -666,14 +686,22 @@ inline WeaponT *Weapon::UnPack(const ::flatbuffers::resolver_function_t *_resolv
 inline void Weapon::UnPackTo(WeaponT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = name(); if (_e) _o->name = _e->str(); }
+  { auto _e = name(); if (_e) { _o->name.assign(_e->c_str(), _e->size()); } else { _o->name.clear(); } }
   { auto _e = damage(); _o->damage = _e; }
 }
 
 inline ::flatbuffers::Offset<Weapon> Weapon::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const WeaponT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(::flatbuffers::PackedBufferSize(PackedSize(*_o)));
   return CreateWeapon(_fbb, _o, _rehasher);
 }
 
+inline size_t Weapon::PackedSize(const WeaponT &_o) {
+  (void)_o;
+  size_t _s = ::flatbuffers::PackedTableSize(2, 10);
+  _s += ::flatbuffers::PackedStringSize(_o.name.length());
+  return _s;
+}
+
 inline ::flatbuffers::Offset<Weapon> CreateWeapon(::flatbuffers::FlatBufferBuilder &_fbb, const WeaponT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -722,6 +750,21 @@ inline void *EquipmentUnion::UnPack(const void *obj, Equipment type, const ::fla
   }
 }
 
+inline void EquipmentUnion::UnPackTo(const void *obj, const ::flatbuffers::resolver_function_t *resolver) {
+  if (!value) {
+    value = UnPack(obj, type, resolver);
+    return;
+  }
+  switch (type) {
+    case Equipment_Weapon: {
+      auto ptr = reinterpret_cast<const MyGame::Sample::Weapon *>(obj);
+      ptr->UnPackTo(reinterpret_cast<MyGame::Sample::WeaponT *>(value), resolver);
+      break;
+    }
+    default: break;
+  }
+}
+
 inline ::flatbuffers::Offset<void> EquipmentUnion::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ::flatbuffers::rehasher_function_t *_rehasher) const {
   (void)_rehasher;
   switch (type) {
@@ -733,6 +776,15 @@ inline ::flatbuffers::Offset<void> EquipmentUnion::Pack(::flatbuffers::FlatBuffe
   }
 }
 
+inline size_t EquipmentUnion::PackedSize() const {
+  switch (type) {
+    case Equipment_Weapon: {
+      return MyGame::Sample::Weapon::PackedSize(*reinterpret_cast<const MyGame::Sample::WeaponT *>(value));
+    }
+    default: return 0;
+  }
+}
+
 inline EquipmentUnion::EquipmentUnion(const EquipmentUnion &u) : type(u.type), value(nullptr) {
   switch (type) {
     case Equipment_Weapon: {
@@ -871,6 +923,11 @@ inline const MyGame::Sample::Monster *GetMonster(const void *buf) {
   return ::flatbuffers::GetRoot<MyGame::Sample::Monster>(buf);
 }
 
+inline const MyGame::Sample::Monster *GetMonster(
+    const ::flatbuffers::TrustedBuffer<MyGame::Sample::Monster> &buf) {
+  return ::flatbuffers::GetRoot(buf);
+}
+
 inline const MyGame::Sample::Monster *GetSizePrefixedMonster(const void *buf) {
   return ::flatbuffers::GetSizePrefixedRoot<MyGame::Sample::Monster>(buf);
 }
@@ -893,6 +950,12 @@ inline bool VerifySizePrefixedMonsterBuffer(
   return verifier.VerifySizePrefixedBuffer<MyGame::Sample::Monster>(nullptr);
 }
 
+inline ::flatbuffers::TrustedBuffer<MyGame::Sample::Monster> TrustMonsterBuffer(
+    ::flatbuffers::DetachedBuffer &&buf) {
+  return ::flatbuffers::TrustedBuffer<MyGame::Sample::Monster>::Verify(
+      std::move(buf), nullptr);
+}
+
 inline void FinishMonsterBuffer(
     ::flatbuffers::FlatBufferBuilder &fbb,
     ::flatbuffers::Offset<MyGame::Sample::Monster> root) {
@@ -905,6 +968,12 @@ inline void FinishSizePrefixedMonsterBuffer(
   fbb.FinishSizePrefixed(root);
 }
 
+inline ::flatbuffers::TrustedBuffer<MyGame::Sample::Monster> FinishAndReleaseMonsterBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<MyGame::Sample::Monster> root) {
+  return fbb.FinishAndRelease(root, nullptr);
+}
+
 inline std::unique_ptr<MyGame::Sample::MonsterT> UnPackMonster(
     const void *buf,
     const ::flatbuffers::resolver_function_t *res = nullptr) {
@@ -917,6 +986,14 @@ inline std::unique_ptr<MyGame::Sample::MonsterT> UnPackSizePrefixedMonster(
   return std::unique_ptr<MyGame::Sample::MonsterT>(GetSizePrefixedMonster(buf)->UnPack(res));
 }
 
+inline ::flatbuffers::span<uint8_t> PackMonsterInto(
+    ::flatbuffers::span<uint8_t> buf,
+    const MyGame::Sample::MonsterT &_o,
+    const ::flatbuffers::rehasher_function_t *_rehasher = nullptr) {
+  return ::flatbuffers::PackInto<MyGame::Sample::Monster>(
+      buf, _o, nullptr, _rehasher);
+}
+
 }  // namespace Sample
 }  // namespace MyGame
 
@@ -299,6 +299,7 @@ flatc(
         "--bfbs-gen-embed",
         "--bfbs-filenames",
         str(tests_path),
+        "--cpp-struct-columns",
     ],
     include="include_test",
     schema="monster_test.fbs",
@@ -499,6 +500,11 @@ flatc(
     schema="union_vector/union_vector.fbs",
     prefix=cpp_17_prefix,
 )
+flatc(
+    CPP_17_OPTS + ["--cpp-arena"],
+    schema="arena_test.fbs",
+    prefix=cpp_17_prefix,
+)
 
 # Private annotations
 annotations_test_schema = "private_annotation_test.fbs"
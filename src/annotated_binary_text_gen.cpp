@@ -223,6 +223,9 @@ static std::string GenerateComment(const BinaryRegionComment &comment,
     case BinaryRegionCommentType::VectorUnionValue:
       s = "offset to union[" + std::to_string(comment.index) + "]";
       break;
+    case BinaryRegionCommentType::VectorValuesOmitted:
+      s = std::to_string(comment.index) + " values omitted";
+      break;
 
     default: break;
   }
@@ -324,6 +327,17 @@ static void GenerateDocumentation(std::ostream &os, const BinaryRegion &region,
 static void GenerateRegion(std::ostream &os, const BinaryRegion &region,
                            const BinarySection &section, const uint8_t *binary,
                            const OutputConfig &output_config) {
+  if (region.comment.type == BinaryRegionCommentType::VectorValuesOmitted) {
+    // Values left out by sampling take a single line, not a dump of their
+    // bytes.
+    os << std::endl;
+    os << "  +0x" << ToHex(region.offset, output_config.offset_max_char);
+    os << " " << output_config.delimiter << " <"
+       << GenerateComment(region.comment, section) << ", " << region.length
+       << " bytes>";
+    return;
+  }
+
   bool doc_generated = false;
   DocContinuation doc_continuation;
   for (uint64_t i = 0; i < region.length; ++i) {
@@ -399,27 +413,13 @@ static void GenerateSection(std::ostream &os, const BinarySection &section,
   }
   os << std::endl;
 }
-}  // namespace
-
-bool AnnotatedBinaryTextGenerator::Generate(
-    const std::string &filename, const std::string &schema_filename,
-    const std::string &output_filename) {
-  OutputConfig output_config;
-  output_config.max_bytes_per_line = options_.max_bytes_per_line;
-  output_config.include_vector_contents = options_.include_vector_contents;
-
-  // Given the length of the binary, we can calculate the maximum number of
-  // characters to display in the offset hex: (i.e. 2 would lead to 0XFF being
-  // the max output).
-  output_config.offset_max_char =
-      binary_length_ > 0xFFFFFF
-          ? 8
-          : (binary_length_ > 0xFFFF ? 6 : (binary_length_ > 0xFF ? 4 : 2));
 
-  // Find the largest type string of all the regions in this file, so we can
-  // align the output nicely.
-  output_config.largest_type_string = 0;
-  for (const auto &section : annotations_) {
+// Widens the type and value columns of `output_config` to fit all the regions
+// of `sections`, so we can align the output nicely.
+static void FitColumns(OutputConfig &output_config,
+                       const std::map<uint64_t, BinarySection> &sections,
+                       const uint8_t *binary) {
+  for (const auto &section : sections) {
     for (const auto &region : section.second.regions) {
       std::string s = GenerateTypeString(region);
       if (s.size() > output_config.largest_type_string) {
@@ -428,32 +428,70 @@ bool AnnotatedBinaryTextGenerator::Generate(
 
       // Don't consider array regions, as they will be split to multiple lines.
       if (!region.array_length) {
-        s = ToValueString(region, binary_, output_config);
+        s = ToValueString(region, binary, output_config);
         if (s.size() > output_config.largest_value_string) {
           output_config.largest_value_string = s.size();
         }
       }
     }
   }
+}
 
-  std::string out = output_filename;
-  if (out.empty()) {
-    // Modify the output filename.
-    out = StripExtension(filename);
-    out += options_.output_postfix;
-    out +=
-        "." + (options_.output_extension.empty() ? GetExtension(filename)
-                                                 : options_.output_extension);
-  }
+static OutputConfig MakeOutputConfig(
+    const AnnotatedBinaryTextGenerator::Options &options,
+    const int64_t binary_length) {
+  OutputConfig output_config;
+  output_config.max_bytes_per_line = options.max_bytes_per_line;
+  output_config.include_vector_contents = options.include_vector_contents;
 
-  std::ofstream ofs(out.c_str());
+  // Given the length of the binary, we can calculate the maximum number of
+  // characters to display in the offset hex: (i.e. 2 would lead to 0XFF being
+  // the max output).
+  output_config.offset_max_char =
+      binary_length > 0xFFFFFF
+          ? 8
+          : (binary_length > 0xFFFF ? 6 : (binary_length > 0xFF ? 4 : 2));
 
-  ofs << "// Annotated Flatbuffer Binary" << std::endl;
-  ofs << "//" << std::endl;
+  output_config.largest_type_string = 0;
+  return output_config;
+}
+
+static std::string OutputFilename(
+    const AnnotatedBinaryTextGenerator::Options &options,
+    const std::string &filename, const std::string &output_filename) {
+  if (!output_filename.empty()) { return output_filename; }
+
+  // Modify the output filename.
+  std::string out = StripExtension(filename);
+  out += options.output_postfix;
+  out += "." + (options.output_extension.empty() ? GetExtension(filename)
+                                                 : options.output_extension);
+  return out;
+}
+
+static void GenerateHeader(std::ostream &os, const std::string &filename,
+                           const std::string &schema_filename) {
+  os << "// Annotated Flatbuffer Binary" << std::endl;
+  os << "//" << std::endl;
   if (!schema_filename.empty()) {
-    ofs << "// Schema file: " << schema_filename << std::endl;
+    os << "// Schema file: " << schema_filename << std::endl;
   }
-  ofs << "// Binary file: " << filename << std::endl;
+  os << "// Binary file: " << filename << std::endl;
+}
+}  // namespace
+
+bool AnnotatedBinaryTextGenerator::Generate(
+    const std::string &filename, const std::string &schema_filename,
+    const std::string &output_filename) {
+  OutputConfig output_config = MakeOutputConfig(options_, binary_length_);
+
+  // Find the largest type string of all the regions in this file, so we can
+  // align the output nicely.
+  FitColumns(output_config, annotations_, binary_);
+
+  const std::string out = OutputFilename(options_, filename, output_filename);
+  std::ofstream ofs(out.c_str());
+  GenerateHeader(ofs, filename, schema_filename);
 
   // Generate each of the binary sections
   for (const auto &section : annotations_) {
@@ -464,4 +502,50 @@ bool AnnotatedBinaryTextGenerator::Generate(
   return true;
 }
 
+bool AnnotatedBinaryTextGenerator::GenerateStreaming(
+    BinaryAnnotator &annotator, const uint64_t batch_size,
+    const std::string &filename, const std::string &schema_filename,
+    const std::string &output_filename) {
+  const BinaryAnnotator::Options &annotator_options = annotator.options();
+  const uint64_t begin = annotator_options.window_begin;
+  const uint64_t end = (std::min)(annotator_options.window_end,
+                                  static_cast<uint64_t>(binary_length_));
+
+  OutputConfig output_config = MakeOutputConfig(options_, binary_length_);
+
+  const std::string out = OutputFilename(options_, filename, output_filename);
+  std::ofstream ofs(out.c_str());
+  GenerateHeader(ofs, filename, schema_filename);
+  if (begin != 0 || end != static_cast<uint64_t>(binary_length_)) {
+    ofs << "// Annotated range: 0x"
+        << ToHex(begin, output_config.offset_max_char) << " to 0x"
+        << ToHex(end, output_config.offset_max_char) << std::endl;
+  }
+
+  // The sections handed over but not written yet.
+  std::map<uint64_t, BinarySection> batch;
+  const auto write_batch = [&]() {
+    // The columns can only grow as we go, the earlier batches are already
+    // written out.
+    FitColumns(output_config, batch, binary_);
+    for (const auto &section : batch) {
+      GenerateSection(ofs, section.second, binary_, output_config);
+    }
+    batch.clear();
+  };
+
+  annotator.AnnotateStreaming(
+      [&](const uint64_t offset, BinarySection &section) {
+        if (batch_size != 0 && !batch.empty() &&
+            offset - batch.begin()->first >= batch_size) {
+          write_batch();
+        }
+        batch[offset] = std::move(section);
+      });
+  write_batch();
+
+  ofs.close();
+  return true;
+}
+
 }  // namespace flatbuffers
@@ -54,11 +54,27 @@ class AnnotatedBinaryTextGenerator {
         binary_length_(binary_length),
         options_(options) {}
 
+  // For use with GenerateStreaming, which produces the annotations itself.
+  explicit AnnotatedBinaryTextGenerator(const Options &options,
+                                        const uint8_t *const binary,
+                                        const int64_t binary_length)
+      : binary_(binary), binary_length_(binary_length), options_(options) {}
+
   // Generate the annotated binary for the given `filename`. Returns true if the
   // annotated binary was successfully saved.
   bool Generate(const std::string &filename, const std::string &schema_filename,
                 const std::string &output_filename = "");
 
+  // Like Generate, but annotates the range set in the options of `annotator`
+  // with its AnnotateStreaming(), and writes out the sections in batches of at
+  // least `batch_size` bytes (0 for a single batch) as they come, so they
+  // don't have to be held in memory all at once. The output columns are fit
+  // to each batch, so they can widen between batches.
+  bool GenerateStreaming(BinaryAnnotator &annotator, uint64_t batch_size,
+                         const std::string &filename,
+                         const std::string &schema_filename,
+                         const std::string &output_filename = "");
+
  private:
   const std::map<uint64_t, BinarySection> annotations_;
 
@@ -117,24 +117,111 @@ static BinarySection GenerateMissingSection(const uint64_t offset,
   return MakeBinarySection("", BinarySectionType::Padding, std::move(regions));
 }
 
+// Applies BinaryAnnotator::Options::max_vector_elements to the elements of a
+// single vector. Elements left out of the sample are still built, so that what
+// they reference is accounted for, but with recording turned off, and the
+// regions of each run of them are replaced by a single region.
+class VectorSample {
+ public:
+  VectorSample(std::vector<BinaryRegion> &regions, bool &recording,
+               const uint64_t length, const uint64_t max_elements)
+      : regions_(regions),
+        recording_(recording),
+        was_recording_(recording),
+        length_(length),
+        max_elements_(max_elements) {}
+
+  ~VectorSample() {
+    EndElement();
+    Flush();
+    recording_ = was_recording_;
+  }
+
+  // Called before building the element at `index`.
+  void BeginElement(const uint64_t index) {
+    EndElement();
+    element_sampled_ = IsSampled(index);
+    if (element_sampled_) { Flush(); }
+    element_begin_ = regions_.size();
+    in_element_ = true;
+    recording_ = was_recording_ && element_sampled_;
+  }
+
+ private:
+  bool IsSampled(const uint64_t index) const {
+    if (max_elements_ == 0 || length_ <= max_elements_) { return true; }
+    if (max_elements_ == 1) { return index == 0; }
+    if (index == length_ - 1) { return true; }
+    const uint64_t stride = (length_ - 1) / (max_elements_ - 1);
+    return index % stride == 0 && index / stride < max_elements_ - 1;
+  }
+
+  void EndElement() {
+    if (!in_element_) { return; }
+    in_element_ = false;
+    if (element_sampled_ || regions_.size() == element_begin_) { return; }
+
+    for (size_t i = element_begin_; i < regions_.size(); ++i) {
+      const BinaryRegion &region = regions_[i];
+      if (omitted_ == 0) { omitted_begin_ = region.offset; }
+      omitted_end_ = (std::max)(omitted_end_, region.offset + region.length);
+    }
+    regions_.resize(element_begin_);
+    omitted_++;
+  }
+
+  void Flush() {
+    if (omitted_ == 0) { return; }
+    BinaryRegionComment comment;
+    comment.type = BinaryRegionCommentType::VectorValuesOmitted;
+    comment.index = omitted_;
+    regions_.push_back(MakeBinaryRegion(omitted_begin_,
+                                        omitted_end_ - omitted_begin_,
+                                        BinaryRegionType::Unknown, 0, 0,
+                                        comment));
+    omitted_ = 0;
+    omitted_end_ = 0;
+  }
+
+  std::vector<BinaryRegion> &regions_;
+  bool &recording_;
+  const bool was_recording_;
+  const uint64_t length_;
+  const uint64_t max_elements_;
+
+  bool in_element_ = false;
+  bool element_sampled_ = true;
+  size_t element_begin_ = 0;
+
+  uint64_t omitted_ = 0;
+  uint64_t omitted_begin_ = 0;
+  uint64_t omitted_end_ = 0;
+};
+
 }  // namespace
 
-std::map<uint64_t, BinarySection> BinaryAnnotator::Annotate() {
+bool BinaryAnnotator::CanAnnotate() const {
   if (bfbs_ != nullptr && bfbs_length_ != 0) {
     flatbuffers::Verifier verifier(bfbs_, static_cast<size_t>(bfbs_length_));
     if ((is_size_prefixed_ &&
          !reflection::VerifySizePrefixedSchemaBuffer(verifier)) ||
         !reflection::VerifySchemaBuffer(verifier)) {
-      return {};
+      return false;
     }
   }
 
   // The binary is too short to read as a flatbuffers.
-  if (binary_length_ < FLATBUFFERS_MIN_BUFFER_SIZE) { return {}; }
+  return binary_length_ >= FLATBUFFERS_MIN_BUFFER_SIZE;
+}
+
+std::map<uint64_t, BinarySection> BinaryAnnotator::Annotate() {
+  if (!CanAnnotate()) { return {}; }
 
   // Make sure we start with a clean slate.
   vtables_.clear();
   sections_.clear();
+  extents_.clear();
+  recording_ = true;
 
   // First parse the header region which always start at offset 0.
   // The returned offset will point to the root_table location.
@@ -148,12 +235,69 @@ std::map<uint64_t, BinarySection> BinaryAnnotator::Annotate() {
   // Now that all the sections are built, make sure the binary sections are
   // contiguous.
   FixMissingRegions();
+  for (const auto &section : sections_) {
+    extents_[section.first] = SectionEnd(section.first, section.second);
+  }
 
   // Then scan the area between BinarySections insert padding sections that are
   // implied.
   FixMissingSections();
 
-  return sections_;
+  // Hand the sections over rather than copying them, they can be large.
+  std::map<uint64_t, BinarySection> sections;
+  sections.swap(sections_);
+  return sections;
+}
+
+void BinaryAnnotator::AnnotateStreaming(const SectionSink &sink) {
+  if (!CanAnnotate()) { return; }
+
+  vtables_.clear();
+  sections_.clear();
+  extents_.clear();
+  recording_ = true;
+  streaming_ = true;
+  flushed_extent_ = std::make_pair(0, 0);
+  gap_offset_ = 0;
+
+  const uint64_t root_table_offset = BuildHeader(0);
+  if (IsValidOffset(root_table_offset)) {
+    VisitTable(root_table_offset, BinarySectionType::RootTable, RootTable());
+  }
+
+  // Build the pending items from the lowest offset up. Everything they find
+  // is further on, except vtables, which are accounted for in their keys, so
+  // the sections before the lowest pending one are complete.
+  while (!pending_.empty()) {
+    const uint64_t next_offset = pending_.begin()->first;
+    FlushSections(next_offset, sink);
+    if (next_offset >= options_.window_end) { break; }
+
+    const Pending item = pending_.begin()->second;
+    pending_.erase(pending_.begin());
+    recording_ = item.recording;
+    Build(item);
+  }
+
+  if (pending_.empty()) {
+    FlushSections((std::numeric_limits<uint64_t>::max)(), sink);
+    // The bytes left in the binary after the last section.
+    FlushGap(binary_length_, sink);
+  } else {
+    // Stopped past the window, the gap before the next section may still be
+    // in it.
+    uint64_t next_offset = pending_.begin()->first;
+    if (!extents_.empty()) {
+      next_offset = (std::min)(next_offset, extents_.begin()->first);
+    }
+    FlushGap(next_offset, sink);
+  }
+
+  streaming_ = false;
+  pending_.clear();
+  sections_.clear();
+  extents_.clear();
+  flushed_extent_ = std::make_pair(0, 0);
 }
 
 uint64_t BinaryAnnotator::BuildHeader(const uint64_t header_offset) {
@@ -474,12 +618,21 @@ BinaryAnnotator::VTable *BinaryAnnotator::GetOrBuildVTable(
   }
 
   // If we have never added this vtable before record the Binary section.
+  // Vtables are shared, so they are recorded even when built for a table
+  // that isn't, as long as they are within the window.
   if (vtables.empty()) {
-    sections_[vtable_offset] = MakeBinarySection(
+    BinarySection section = MakeBinarySection(
         referring_table_name, BinarySectionType::VTable, std::move(regions));
+    extents_[vtable_offset] = SectionEnd(vtable_offset, section);
+    if (IsInWindow(vtable_offset)) {
+      sections_[vtable_offset] = std::move(section);
+    }
   } else {
     // Add the current table name to the name of the section.
-    sections_[vtable_offset].name += ", " + referring_table_name;
+    auto it = sections_.find(vtable_offset);
+    if (it != sections_.end()) {
+      it->second.name += ", " + referring_table_name;
+    }
   }
 
   VTable vtable;
@@ -755,7 +908,7 @@ void BinaryAnnotator::BuildTable(const uint64_t table_offset,
                                              0, offset_of_next_item,
                                              offset_field_comment));
 
-          BuildTable(offset_of_next_item, BinarySectionType::Table,
+          VisitTable(offset_of_next_item, BinarySectionType::Table,
                      next_object);
         }
       } break;
@@ -765,7 +918,7 @@ void BinaryAnnotator::BuildTable(const uint64_t table_offset,
         regions.push_back(MakeBinaryRegion(field_offset, length, region_type, 0,
                                            offset_of_next_item,
                                            offset_field_comment));
-        BuildString(offset_of_next_item, table, field);
+        VisitString(offset_of_next_item, table, field);
       } break;
 
       case reflection::BaseType::Vector: {
@@ -773,16 +926,14 @@ void BinaryAnnotator::BuildTable(const uint64_t table_offset,
         regions.push_back(MakeBinaryRegion(field_offset, length, region_type, 0,
                                            offset_of_next_item,
                                            offset_field_comment));
-        BuildVector(offset_of_next_item, table, field, table_offset,
-                    vtable->fields);
+        VisitVector(offset_of_next_item, table, field, table_offset, vtable);
       } break;
       case reflection::BaseType::Vector64: {
         offset_field_comment.default_value = "(vector64)";
         regions.push_back(MakeBinaryRegion(field_offset, length, region_type, 0,
                                            offset_of_next_item,
                                            offset_field_comment));
-        BuildVector(offset_of_next_item, table, field, table_offset,
-                    vtable->fields);
+        VisitVector(offset_of_next_item, table, field, table_offset, vtable);
       } break;
 
       case reflection::BaseType::Union: {
@@ -820,7 +971,7 @@ void BinaryAnnotator::BuildTable(const uint64_t table_offset,
         }
 
         const std::string enum_type =
-            BuildUnion(union_offset, realized_type.value(), field);
+            VisitUnion(union_offset, realized_type.value(), field);
 
         offset_field_comment.default_value =
             "(union of type `" + enum_type + "`)";
@@ -1113,7 +1264,10 @@ void BinaryAnnotator::BuildVector(
 
       if (object->is_struct()) {
         // Vector of structs
+        VectorSample sample(regions, recording_, vector_length.value(),
+                            options_.max_vector_elements);
         for (size_t i = 0; i < vector_length.value(); ++i) {
+          sample.BeginElement(i);
           // Structs are inline to the vector.
           const uint64_t next_offset =
               BuildStruct(offset, regions, "[" + NumToString(i) + "]", object);
@@ -1122,7 +1276,10 @@ void BinaryAnnotator::BuildVector(
         }
       } else {
         // Vector of objects
+        VectorSample sample(regions, recording_, vector_length.value(),
+                            options_.max_vector_elements);
         for (size_t i = 0; i < vector_length.value(); ++i) {
+          sample.BeginElement(i);
           BinaryRegionComment vector_object_comment;
           vector_object_comment.type =
               BinaryRegionCommentType::VectorTableValue;
@@ -1174,13 +1331,16 @@ void BinaryAnnotator::BuildVector(
           // Consume the offset to the table.
           offset += sizeof(uint32_t);
 
-          BuildTable(table_offset, BinarySectionType::Table, object);
+          VisitTable(table_offset, BinarySectionType::Table, object);
         }
       }
     } break;
     case reflection::BaseType::String: {
       // Vector of strings
+      VectorSample sample(regions, recording_, vector_length.value(),
+                          options_.max_vector_elements);
       for (size_t i = 0; i < vector_length.value(); ++i) {
+        sample.BeginElement(i);
         BinaryRegionComment vector_object_comment;
         vector_object_comment.type = BinaryRegionCommentType::VectorStringValue;
         vector_object_comment.index = i;
@@ -1216,7 +1376,7 @@ void BinaryAnnotator::BuildVector(
             offset, sizeof(uint32_t), BinaryRegionType::UOffset, 0,
             string_offset, vector_object_comment));
 
-        BuildString(string_offset, table, field);
+        VisitString(string_offset, table, field);
 
         offset += sizeof(uint32_t);
       }
@@ -1261,7 +1421,10 @@ void BinaryAnnotator::BuildVector(
           union_type_vector_field_offset +
           union_type_vector_field_relative_offset.value() + sizeof(uint32_t);
 
+      VectorSample sample(regions, recording_, vector_length.value(),
+                          options_.max_vector_elements);
       for (size_t i = 0; i < vector_length.value(); ++i) {
+        sample.BeginElement(i);
         BinaryRegionComment comment;
         comment.type = BinaryRegionCommentType::VectorUnionValue;
         comment.index = i;
@@ -1311,7 +1474,7 @@ void BinaryAnnotator::BuildVector(
         }
 
         const std::string enum_type =
-            BuildUnion(union_offset, realized_type.value(), field);
+            VisitUnion(union_offset, realized_type.value(), field);
 
         comment.default_value = "(`" + enum_type + "`)";
         regions.push_back(MakeBinaryRegion(offset, sizeof(uint32_t),
@@ -1330,7 +1493,10 @@ void BinaryAnnotator::BuildVector(
 
         // TODO(dbaileychess): It might be nicer to user the
         // BinaryRegion.array_length field to indicate this.
+        VectorSample sample(regions, recording_, vector_length.value(),
+                            options_.max_vector_elements);
         for (size_t i = 0; i < vector_length.value(); ++i) {
+          sample.BeginElement(i);
           BinaryRegionComment vector_scalar_comment;
           vector_scalar_comment.type = BinaryRegionCommentType::VectorValue;
           vector_scalar_comment.index = i;
@@ -1416,52 +1582,165 @@ std::string BinaryAnnotator::BuildUnion(const uint64_t union_offset,
   return enum_val->name()->c_str();
 }
 
+void BinaryAnnotator::VisitTable(const uint64_t offset,
+                                 const BinarySectionType type,
+                                 const reflection::Object *const table) {
+  Pending item;
+  item.kind = Pending::Kind::Table;
+  item.offset = offset;
+  item.type = type;
+  item.object = table;
+  Visit(item);
+}
+
+void BinaryAnnotator::VisitString(const uint64_t offset,
+                                  const reflection::Object *const table,
+                                  const reflection::Field *const field) {
+  Pending item;
+  item.kind = Pending::Kind::String;
+  item.offset = offset;
+  item.object = table;
+  item.field = field;
+  Visit(item);
+}
+
+void BinaryAnnotator::VisitVector(const uint64_t offset,
+                                  const reflection::Object *const table,
+                                  const reflection::Field *const field,
+                                  const uint64_t parent_table_offset,
+                                  const VTable *const vtable) {
+  Pending item;
+  item.kind = Pending::Kind::Vector;
+  item.offset = offset;
+  item.object = table;
+  item.field = field;
+  item.parent_table_offset = parent_table_offset;
+  item.parent_vtable = vtable;
+  Visit(item);
+}
+
+std::string BinaryAnnotator::VisitUnion(const uint64_t offset,
+                                        const uint8_t realized_type,
+                                        const reflection::Field *const field) {
+  if (!streaming_) { return BuildUnion(offset, realized_type, field); }
+
+  const reflection::Enum *next_enum =
+      schema_->enums()->Get(field->type()->index());
+  const reflection::EnumVal *enum_val = next_enum->values()->Get(realized_type);
+  const reflection::Type *union_type = enum_val->union_type();
+
+  Pending item;
+  item.kind = Pending::Kind::Union;
+  item.offset = offset;
+  item.field = field;
+  item.realized_type = realized_type;
+  if (union_type->base_type() == reflection::BaseType::Obj &&
+      !schema_->objects()->Get(union_type->index())->is_struct()) {
+    // Only set for a union of a table, so Visit() looks for its vtable.
+    item.object = schema_->objects()->Get(union_type->index());
+  }
+  Visit(item);
+
+  return enum_val->name()->c_str();
+}
+
+void BinaryAnnotator::Visit(const Pending &item) {
+  if (!streaming_) {
+    Build(item);
+    return;
+  }
+
+  // A table builds its vtable first, which is usually just before it.
+  uint64_t key = item.offset;
+  if (item.kind == Pending::Kind::Table ||
+      (item.kind == Pending::Kind::Union && item.object != nullptr)) {
+    const auto vtable_soffset = ReadScalar<int32_t>(item.offset);
+    if (vtable_soffset.has_value()) {
+      key = (std::min)(key, item.offset - vtable_soffset.value());
+    }
+  }
+
+  // Found again, only build it once, and record it if any of the references
+  // to it is recorded.
+  auto range = pending_.equal_range(key);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second.kind == item.kind && it->second.offset == item.offset) {
+      it->second.recording = it->second.recording || recording_;
+      return;
+    }
+  }
+
+  Pending pending = item;
+  pending.recording = recording_;
+  pending_.insert(std::make_pair(key, pending));
+}
+
+void BinaryAnnotator::Build(const Pending &item) {
+  switch (item.kind) {
+    case Pending::Kind::Table:
+      BuildTable(item.offset, item.type, item.object);
+      break;
+    case Pending::Kind::String:
+      BuildString(item.offset, item.object, item.field);
+      break;
+    case Pending::Kind::Vector:
+      BuildVector(item.offset, item.object, item.field,
+                  item.parent_table_offset, item.parent_vtable->fields);
+      break;
+    case Pending::Kind::Union:
+      BuildUnion(item.offset, item.realized_type, item.field);
+      break;
+  }
+}
+
 void BinaryAnnotator::FixMissingRegions() {
-  std::vector<BinaryRegion> regions_to_insert;
   for (auto &current_section : sections_) {
-    BinarySection &section = current_section.second;
-    if (section.regions.empty()) {
-      // TODO(dbaileychess): is this possible?
-      continue;
-    }
+    FixMissingRegions(current_section.second);
+  }
+}
 
-    uint64_t offset = section.regions[0].offset + section.regions[0].length;
-    for (size_t i = 1; i < section.regions.size(); ++i) {
-      BinaryRegion &region = section.regions[i];
+void BinaryAnnotator::FixMissingRegions(BinarySection &section) {
+  if (section.regions.empty()) {
+    // TODO(dbaileychess): is this possible?
+    return;
+  }
 
-      const uint64_t next_offset = region.offset;
-      if (!IsValidOffset(next_offset)) {
-        // TODO(dbaileychess): figure out how we get into this situation.
-        continue;
-      }
+  std::vector<BinaryRegion> regions_to_insert;
+  uint64_t offset = section.regions[0].offset + section.regions[0].length;
+  for (size_t i = 1; i < section.regions.size(); ++i) {
+    BinaryRegion &region = section.regions[i];
+
+    const uint64_t next_offset = region.offset;
+    if (!IsValidOffset(next_offset)) {
+      // TODO(dbaileychess): figure out how we get into this situation.
+      continue;
+    }
 
-      if (offset < next_offset) {
-        const uint64_t padding_bytes = next_offset - offset;
+    if (offset < next_offset) {
+      const uint64_t padding_bytes = next_offset - offset;
 
-        BinaryRegionComment comment;
-        comment.type = BinaryRegionCommentType::Padding;
+      BinaryRegionComment comment;
+      comment.type = BinaryRegionCommentType::Padding;
 
-        if (IsNonZeroRegion(offset, padding_bytes, binary_)) {
-          SetError(comment, BinaryRegionStatus::WARN_NO_REFERENCES);
-          regions_to_insert.push_back(
-              MakeBinaryRegion(offset, padding_bytes, BinaryRegionType::Unknown,
-                               padding_bytes, 0, comment));
-        } else {
-          regions_to_insert.push_back(
-              MakeBinaryRegion(offset, padding_bytes, BinaryRegionType::Uint8,
-                               padding_bytes, 0, comment));
-        }
+      if (IsNonZeroRegion(offset, padding_bytes, binary_)) {
+        SetError(comment, BinaryRegionStatus::WARN_NO_REFERENCES);
+        regions_to_insert.push_back(
+            MakeBinaryRegion(offset, padding_bytes, BinaryRegionType::Unknown,
+                             padding_bytes, 0, comment));
+      } else {
+        regions_to_insert.push_back(
+            MakeBinaryRegion(offset, padding_bytes, BinaryRegionType::Uint8,
+                             padding_bytes, 0, comment));
       }
-      offset = next_offset + region.length;
     }
+    offset = next_offset + region.length;
+  }
 
-    if (!regions_to_insert.empty()) {
-      section.regions.insert(section.regions.end(), regions_to_insert.begin(),
-                             regions_to_insert.end());
-      std::stable_sort(section.regions.begin(), section.regions.end(),
-                       BinaryRegionSort);
-      regions_to_insert.clear();
-    }
+  if (!regions_to_insert.empty()) {
+    section.regions.insert(section.regions.end(), regions_to_insert.begin(),
+                           regions_to_insert.end());
+    std::stable_sort(section.regions.begin(), section.regions.end(),
+                     BinaryRegionSort);
   }
 }
 
@@ -1470,11 +1749,11 @@ void BinaryAnnotator::FixMissingSections() {
 
   std::vector<BinarySection> sections_to_insert;
 
-  for (auto &current_section : sections_) {
-    BinarySection &section = current_section.second;
-    const uint64_t section_start_offset = current_section.first;
-    const uint64_t section_end_offset =
-        section.regions.back().offset + section.regions.back().length;
+  // Walk the extents rather than the sections, so the gaps are the same
+  // whether or not the neighbouring sections were recorded.
+  for (const auto &extent : extents_) {
+    const uint64_t section_start_offset = extent.first;
+    const uint64_t section_end_offset = extent.second;
 
     if (offset < section_start_offset) {
       // We are at an offset that is less then the current section.
@@ -1499,21 +1778,52 @@ void BinaryAnnotator::FixMissingSections() {
   }
 }
 
-bool BinaryAnnotator::ContainsSection(const uint64_t offset) {
-  auto it = sections_.lower_bound(offset);
-  // If the section is found, check that it is exactly equal its offset.
-  if (it != sections_.end() && it->first == offset) { return true; }
+void BinaryAnnotator::FlushSections(const uint64_t end,
+                                    const SectionSink &sink) {
+  while (!extents_.empty() && extents_.begin()->first < end) {
+    std::pair<uint64_t, uint64_t> extent = *extents_.begin();
+    extents_.erase(extents_.begin());
+
+    FlushGap(extent.first, sink);
+
+    auto it = sections_.find(extent.first);
+    if (it != sections_.end()) {
+      FixMissingRegions(it->second);
+      extent.second = SectionEnd(it->first, it->second);
+      sink(it->first, it->second);
+      sections_.erase(it);
+    }
 
-  // If this was the first section, there are no other previous sections to
-  // check.
-  if (it == sections_.begin()) { return false; }
+    flushed_extent_ = extent;
+    gap_offset_ = extent.second + 1;
+  }
+}
+
+void BinaryAnnotator::FlushGap(const uint64_t next_offset,
+                               const SectionSink &sink) {
+  // The same gaps as FixMissingSections() finds.
+  if (gap_offset_ >= next_offset) { return; }
+  const uint64_t pad_bytes = next_offset - gap_offset_ + 1;
+  BinarySection section =
+      GenerateMissingSection(gap_offset_ - 1, pad_bytes, binary_);
+  if (IsInWindow(gap_offset_ - 1)) { sink(gap_offset_ - 1, section); }
+}
 
-  // Go back one section.
-  --it;
+bool BinaryAnnotator::ContainsSection(const uint64_t offset) {
+  auto it = extents_.lower_bound(offset);
+  // If the section is found, check that it is exactly equal its offset.
+  if (it != extents_.end() && it->first == offset) { return true; }
+
+  // If this was the first section, the previous one may have been handed
+  // over by AnnotateStreaming() already.
+  std::pair<uint64_t, uint64_t> previous = flushed_extent_;
+  if (it != extents_.begin()) {
+    // Go back one section.
+    previous = *--it;
+  }
 
   // And check that if the offset is covered by the section.
-  return offset >= it->first && offset < it->second.regions.back().offset +
-                                             it->second.regions.back().length;
+  return offset >= previous.first && offset < previous.second;
 }
 
 const reflection::Object *BinaryAnnotator::RootTable() const {
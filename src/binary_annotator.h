@@ -19,8 +19,10 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iomanip>
 #include <ios>
+#include <limits>
 #include <list>
 #include <map>
 #include <sstream>
@@ -136,6 +138,9 @@ enum class BinaryRegionCommentType {
   VectorTableValue,
   VectorStringValue,
   VectorUnionValue,
+  // A run of vector values left out of the annotation by sampling, `index`
+  // holds how many.
+  VectorValuesOmitted,
 };
 
 struct BinaryRegionComment {
@@ -248,32 +253,76 @@ inline static std::string ToString(const BinaryRegionType type) {
 
 class BinaryAnnotator {
  public:
+  // Limits on what Annotate() records, so that very large binaries can be
+  // annotated in pieces. Annotate() always walks the whole binary, but
+  // sections that aren't recorded are only tracked by their extent.
+  struct Options {
+    Options()
+        : window_begin(0),
+          window_end((std::numeric_limits<uint64_t>::max)()),
+          max_vector_elements(0) {}
+
+    // Only sections starting within [window_begin, window_end) are returned.
+    uint64_t window_begin;
+    uint64_t window_end;
+
+    // If non-zero, vectors with more elements than this only annotate an
+    // evenly spaced sample of this many elements, including the first and the
+    // last. Each run of elements left out becomes a single region, and
+    // sections only referenced from them are not recorded.
+    uint64_t max_vector_elements;
+  };
+
   explicit BinaryAnnotator(const uint8_t *const bfbs,
                            const uint64_t bfbs_length,
                            const uint8_t *const binary,
                            const uint64_t binary_length,
-                           const bool is_size_prefixed)
+                           const bool is_size_prefixed,
+                           const Options &options = Options())
       : bfbs_(bfbs),
         bfbs_length_(bfbs_length),
         schema_(reflection::GetSchema(bfbs)),
         root_table_(""),
         binary_(binary),
         binary_length_(binary_length),
-        is_size_prefixed_(is_size_prefixed) {}
+        is_size_prefixed_(is_size_prefixed),
+        options_(options) {}
 
   BinaryAnnotator(const reflection::Schema *schema,
                   const std::string &root_table, const uint8_t *binary,
-                  uint64_t binary_length, bool is_size_prefixed)
+                  uint64_t binary_length, bool is_size_prefixed,
+                  const Options &options = Options())
       : bfbs_(nullptr),
         bfbs_length_(0),
         schema_(schema),
         root_table_(root_table),
         binary_(binary),
         binary_length_(binary_length),
-        is_size_prefixed_(is_size_prefixed) {}
+        is_size_prefixed_(is_size_prefixed),
+        options_(options) {}
 
   std::map<uint64_t, BinarySection> Annotate();
 
+  // Receives the sections of AnnotateStreaming(), by their offsets. It may
+  // move from the section.
+  typedef std::function<void(uint64_t offset, BinarySection &section)>
+      SectionSink;
+
+  // Like Annotate(), but walks the binary once in offset order, and hands
+  // each section to `sink`, in order, as soon as no section before it can
+  // still be found. FlatBuffers offsets point forward, except those to
+  // vtables, so that is once no offset found but not walked yet points below
+  // it. Only those offsets, and the sections not handed over yet, are held in
+  // memory. The walk stops once it is past the window.
+  //
+  // A vtable shared by several table types is named after the types found
+  // before it is handed over, and its fields after the first of them, which
+  // can differ from Annotate().
+  void AnnotateStreaming(const SectionSink &sink);
+
+  const Options &options() const { return options_; }
+  void set_options(const Options &options) { options_ = options; }
+
  private:
   struct VTable {
     struct Entry {
@@ -290,6 +339,37 @@ class BinaryAnnotator {
     uint16_t table_size = 0;
   };
 
+  // A table, string, vector or union found through an offset, which
+  // AnnotateStreaming() builds once its walk gets there.
+  struct Pending {
+    enum class Kind { Table, String, Vector, Union };
+
+    Kind kind = Kind::Table;
+    uint64_t offset = 0;
+
+    // The section type of a table.
+    BinarySectionType type = BinarySectionType::Table;
+
+    // The type of a table or of a union of a table, or the table holding the
+    // field of a string or vector.
+    const reflection::Object *object = nullptr;
+
+    // The field of a string, vector or union.
+    const reflection::Field *field = nullptr;
+
+    // The table holding a vector, and its vtable.
+    uint64_t parent_table_offset = 0;
+    const VTable *parent_vtable = nullptr;
+
+    // The type of a union.
+    uint8_t realized_type = 0;
+
+    // Whether it was found while recording_.
+    bool recording = true;
+  };
+
+  bool CanAnnotate() const;
+
   uint64_t BuildHeader(uint64_t offset);
 
   // VTables can be shared across instances or even across objects. This
@@ -316,9 +396,37 @@ class BinaryAnnotator {
   std::string BuildUnion(uint64_t offset, uint8_t realized_type,
                          const reflection::Field *field);
 
+  // Build the table, string, vector or union at `offset`: right away for
+  // Annotate(), or by adding it to pending_ for AnnotateStreaming().
+  void VisitTable(uint64_t offset, BinarySectionType type,
+                  const reflection::Object *table);
+
+  void VisitString(uint64_t offset, const reflection::Object *table,
+                   const reflection::Field *field);
+
+  void VisitVector(uint64_t offset, const reflection::Object *table,
+                   const reflection::Field *field, uint64_t parent_table_offset,
+                   const VTable *vtable);
+
+  // Returns the name of the union type, like BuildUnion().
+  std::string VisitUnion(uint64_t offset, uint8_t realized_type,
+                         const reflection::Field *field);
+
+  void Visit(const Pending &item);
+  void Build(const Pending &item);
+
   void FixMissingRegions();
+  void FixMissingRegions(BinarySection &section);
   void FixMissingSections();
 
+  // Hands the sections starting before `end` over to `sink`, as
+  // FixMissingRegions() and FixMissingSections() would leave them.
+  void FlushSections(uint64_t end, const SectionSink &sink);
+
+  // Hands the padding, if any, between the last section handed over and
+  // `next_offset` over to `sink`.
+  void FlushGap(uint64_t next_offset, const SectionSink &sink);
+
   inline bool IsValidOffset(const uint64_t offset) const {
     return offset < binary_length_;
   }
@@ -348,9 +456,22 @@ class BinaryAnnotator {
 
   // Adds the provided `section` keyed by the `offset` it occurs at. If a
   // section is already added at that offset, it doesn't replace the existing
-  // one.
+  // one. Sections that aren't recorded (see Options) only keep their extent.
   void AddSection(const uint64_t offset, const BinarySection &section) {
-    sections_.insert(std::make_pair(offset, section));
+    extents_.insert(std::make_pair(offset, SectionEnd(offset, section)));
+    if (recording_ && IsInWindow(offset)) {
+      sections_.insert(std::make_pair(offset, section));
+    }
+  }
+
+  static uint64_t SectionEnd(const uint64_t offset,
+                             const BinarySection &section) {
+    if (section.regions.empty()) { return offset; }
+    return section.regions.back().offset + section.regions.back().length;
+  }
+
+  bool IsInWindow(const uint64_t offset) const {
+    return offset >= options_.window_begin && offset < options_.window_end;
   }
 
   bool IsInlineField(const reflection::Field *const field) {
@@ -415,11 +536,30 @@ class BinaryAnnotator {
   const uint64_t binary_length_;
   const bool is_size_prefixed_;
 
+  Options options_;
+
   // Map of binary offset to vtables, to dedupe vtables.
   std::map<uint64_t, std::list<VTable>> vtables_;
 
   // The annotated binary sections, index by their absolute offset.
   std::map<uint64_t, BinarySection> sections_;
+
+  // The end offset of every section found, recorded or not, index by their
+  // absolute offset.
+  std::map<uint64_t, uint64_t> extents_;
+
+  // False while walking vector elements left out by sampling.
+  bool recording_ = true;
+
+  // Set during AnnotateStreaming(), which keeps the items found but not built
+  // yet in pending_, by the lowest offset they build a section at.
+  bool streaming_ = false;
+  std::multimap<uint64_t, Pending> pending_;
+
+  // The extent of the last section AnnotateStreaming() handed over, which is
+  // no longer in extents_, and the end of it plus one.
+  std::pair<uint64_t, uint64_t> flushed_extent_;
+  uint64_t gap_offset_ = 0;
 };
 
 }  // namespace flatbuffers
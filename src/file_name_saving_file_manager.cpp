@@ -15,6 +15,7 @@
  */
 
 #include <fstream>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -30,6 +31,7 @@ class FileNameSavingFileManager : public FileManager {
   bool SaveFile(const std::string &absolute_file_name,
                 const std::string &content) override {
     (void)content;
+    std::lock_guard<std::mutex> lock(mutex_);
     auto pair = file_names_.insert(absolute_file_name);
     // pair.second indicates whether the insertion is
     // successful or not.
@@ -43,6 +45,7 @@ class FileNameSavingFileManager : public FileManager {
   }
 
  private:
+  std::mutex mutex_;
   std::set<std::string> file_names_;
 };
 
@@ -17,26 +17,34 @@
 #include "flatbuffers/flatc.h"
 
 #include <algorithm>
+#include <atomic>
+#include <iomanip>
 #include <limits>
 #include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 
 #include "annotated_binary_text_gen.h"
 #include "binary_annotator.h"
 #include "flatbuffers/code_generator.h"
+#include "flatbuffers/hash.h"
 #include "flatbuffers/idl.h"
 #include "flatbuffers/util.h"
+#include "parallel.h"
 
 namespace flatbuffers {
 
 static const char *FLATC_VERSION() { return FLATBUFFERS_VERSION(); }
 
-void FlatCompiler::ParseFile(
+// Parses `contents`, searching the directory of `filename` after the given
+// include directories.
+static bool ParseWithIncludes(
     flatbuffers::Parser &parser, const std::string &filename,
     const std::string &contents,
-    const std::vector<const char *> &include_directories) const {
+    const std::vector<const char *> &include_directories) {
   auto local_include_directory = flatbuffers::StripFileName(filename);
 
   std::vector<const char *> inc_directories;
@@ -45,7 +53,14 @@ void FlatCompiler::ParseFile(
   inc_directories.push_back(local_include_directory.c_str());
   inc_directories.push_back(nullptr);
 
-  if (!parser.Parse(contents.c_str(), &inc_directories[0], filename.c_str())) {
+  return parser.Parse(contents.c_str(), &inc_directories[0], filename.c_str());
+}
+
+void FlatCompiler::ParseFile(
+    flatbuffers::Parser &parser, const std::string &filename,
+    const std::string &contents,
+    const std::vector<const char *> &include_directories) const {
+  if (!ParseWithIncludes(parser, filename, contents, include_directories)) {
     Error(parser.error_, false, false);
   }
   if (!parser.error_.empty()) { Warn(parser.error_, false); }
@@ -66,6 +81,7 @@ void FlatCompiler::Warn(const std::string &warn, bool show_exe_name) const {
 
 void FlatCompiler::Error(const std::string &err, bool usage,
                          bool show_exe_name) const {
+  error_count_++;
   params_.error_fn(this, err, usage, show_exe_name);
 }
 
@@ -141,6 +157,9 @@ const static FlatCOption flatc_options[] = {
   { "", "cpp-str-flex-ctor", "",
     "Don't construct custom string types by passing std::string from "
     "Flatbuffers, but (char* + length)." },
+  { "", "cpp-arena", "",
+    "Generate an object API whose UnPack() allocates the whole object tree "
+    "from a std::pmr::memory_resource (requires --cpp-std c++17)." },
   { "", "cpp-field-case-style", "STYLE",
     "Generate C++ fields using selected case style. Supported STYLE values: * "
     "'unchanged' - leave unchanged (default) * 'upper' - schema snake_case "
@@ -154,6 +173,9 @@ const static FlatCOption flatc_options[] = {
     "When using C++17, generate extra code to provide compile-time (static) "
     "reflection of Flatbuffers types. Requires --cpp-std to be \"c++17\" or "
     "higher." },
+  { "", "cpp-struct-columns", "",
+    "Generate static gather_ and scatter_ helpers on structs, which copy a "
+    "scalar field of every struct in a vector to or from an array." },
   { "", "object-prefix", "PREFIX",
     "Customize class prefix for C++ object-based API." },
   { "", "object-suffix", "SUFFIX",
@@ -169,6 +191,19 @@ const static FlatCOption flatc_options[] = {
     "Allow binaries without file_identifier to be read. This may crash flatc "
     "given a mismatched schema." },
   { "", "size-prefixed", "", "Input binaries are size prefixed buffers." },
+  { "", "jobs", "N",
+    "Run code generators and convert data files (with -b or -t) on up to N "
+    "threads. Errors are still reported in input order." },
+  { "", "skip-unchanged", "",
+    "Leave generated files that already hold the generated contents "
+    "untouched, so their modification times do not change." },
+  { "", "output-manifest", "FILE",
+    "Write a JSON file to FILE listing the generated files, split into those "
+    "whose contents changed and those that did not." },
+  { "", "stamp-dir", "DIR",
+    "Write a stamp to DIR for each schema compiled, and skip a schema "
+    "entirely while its stamp shows that its options, its includes and its "
+    "outputs are unchanged. Schemas that changed are parsed in full." },
   { "", "proto-namespace-suffix", "SUFFIX",
     "Add this namespace to any flatbuffers generated from protobufs." },
   { "", "oneof-union", "", "Translate .proto oneofs to flatbuffer unions." },
@@ -241,6 +276,9 @@ const static FlatCOption flatc_options[] = {
   { "", "json-nested-bytes", "",
     "Allow a nested_flatbuffer field to be parsed as a vector of bytes "
     "in JSON, which is unsafe unless checked by a verifier afterwards." },
+  { "", "json-shortest-floats", "",
+    "Output floating point values in JSON with the fewest digits that parse "
+    "back to the same value, instead of a fixed precision." },
   { "", "ts-flat-files", "",
     "Generate a single typescript file per .fbs file. Implies "
     "ts_entry_points." },
@@ -249,6 +287,16 @@ const static FlatCOption flatc_options[] = {
   { "", "annotate-sparse-vectors", "", "Don't annotate every vector element." },
   { "", "annotate", "SCHEMA",
     "Annotate the provided BINARY_FILE with the specified SCHEMA file." },
+  { "", "annotate-stream", "SIZE",
+    "Annotate in a single walk in offset order, writing out the sections in "
+    "batches of SIZE bytes as they are done, to bound memory use on large "
+    "binaries." },
+  { "", "annotate-range", "BEGIN:END",
+    "Only annotate the sections starting in the byte range [BEGIN, END). "
+    "Either bound may be omitted." },
+  { "", "annotate-sample", "N",
+    "Only annotate N evenly spaced elements of longer vectors, including the "
+    "first and last." },
   { "", "no-leak-private-annotation", "",
     "Prevents multiple type of annotations within a Fbs SCHEMA file. "
     "Currently this is required to generate private types in Rust" },
@@ -399,38 +447,65 @@ void FlatCompiler::AnnotateBinaries(const uint8_t *binary_schema,
   const std::string &schema_filename = options.annotate_schema;
 
   for (const std::string &filename : options.filenames) {
-    std::string binary_contents;
-    if (!flatbuffers::LoadFile(filename.c_str(), true, &binary_contents)) {
+    // The annotator and text generator only read the binary, annotate it in
+    // place rather than loading a copy.
+    flatbuffers::MappedFile binary_contents;
+    if (!binary_contents.Open(filename.c_str())) {
       Warn("unable to load binary file: " + filename);
       continue;
     }
 
-    const uint8_t *binary =
-        reinterpret_cast<const uint8_t *>(binary_contents.c_str());
+    const uint8_t *binary = binary_contents.data();
     const size_t binary_size = binary_contents.size();
     const bool is_size_prefixed = options.opts.size_prefixed;
 
+    flatbuffers::BinaryAnnotator::Options annotator_opts;
+    annotator_opts.window_begin = options.annotate_begin;
+    annotator_opts.window_end = options.annotate_end;
+    annotator_opts.max_vector_elements = options.annotate_max_vector_elements;
+
     flatbuffers::BinaryAnnotator binary_annotator(
         binary_schema, binary_schema_size, binary, binary_size,
-        is_size_prefixed);
-
-    auto annotations = binary_annotator.Annotate();
+        is_size_prefixed, annotator_opts);
 
     flatbuffers::AnnotatedBinaryTextGenerator::Options text_gen_opts;
     text_gen_opts.include_vector_contents =
         options.annotate_include_vector_contents;
 
+    if (options.annotate_streaming) {
+      flatbuffers::AnnotatedBinaryTextGenerator text_generator(
+          text_gen_opts, binary, binary_size);
+      text_generator.GenerateStreaming(binary_annotator,
+                                       options.annotate_batch_size, filename,
+                                       schema_filename);
+      continue;
+    }
+
+    auto annotations = binary_annotator.Annotate();
+
     // TODO(dbaileychess): Right now we just support a single text-based
     // output of the annotated binary schema, which we generate here. We
     // could output the raw annotations instead and have third-party tools
     // use them to generate their own output.
     flatbuffers::AnnotatedBinaryTextGenerator text_generator(
-        text_gen_opts, annotations, binary, binary_size);
+        text_gen_opts, std::move(annotations), binary, binary_size);
 
     text_generator.Generate(filename, schema_filename);
   }
 }
 
+// `path` made absolute for the --stamp-dir key. Unlike AbsolutePath, this
+// doesn't depend on whether the path exists yet (e.g. an output directory).
+static std::string StampKeyPath(const std::string &path) {
+  const bool is_absolute =
+      !path.empty() && (path[0] == '/' || path[0] == '\\' ||
+                        (path.size() > 1 && path[1] == ':'));
+  if (is_absolute) return flatbuffers::PosixPath(path);
+  return flatbuffers::ConCatPathFileName(
+      flatbuffers::PosixPath(flatbuffers::AbsolutePath(".")),
+      flatbuffers::PosixPath(path));
+}
+
 FlatCOptions FlatCompiler::ParseFromCommandLineArguments(int argc,
                                                          const char **argv) {
   if (argc <= 1) { Error("Need to provide at least one argument."); }
@@ -446,6 +521,7 @@ FlatCOptions FlatCompiler::ParseFromCommandLineArguments(int argc,
     if (arg[0] == '-') {
       if (options.filenames.size() && arg[1] != '-')
         Error("invalid option location: " + arg, true);
+      const int option_begin = argi;
       if (arg == "-o") {
         if (++argi >= argc) Error("missing path following: " + arg, true);
         options.output_path = flatbuffers::ConCatPathFileName(
@@ -525,6 +601,8 @@ FlatCOptions FlatCompiler::ParseFromCommandLineArguments(int argc,
         opts.cpp_object_api_string_type = argv[argi];
       } else if (arg == "--cpp-str-flex-ctor") {
         opts.cpp_object_api_string_flexible_constructor = true;
+      } else if (arg == "--cpp-arena") {
+        opts.cpp_object_api_arena = true;
       } else if (arg == "--no-cpp-direct-copy") {
         opts.cpp_direct_copy = false;
       } else if (arg == "--cpp-field-case-style") {
@@ -572,6 +650,22 @@ FlatCOptions FlatCompiler::ParseFromCommandLineArguments(int argc,
         options.raw_binary = true;
       } else if (arg == "--size-prefixed") {
         opts.size_prefixed = true;
+      } else if (arg == "--jobs") {
+        if (++argi >= argc) Error("missing count following: " + arg, true);
+        if (!StringToNumber(argv[argi], &options.jobs) || options.jobs < 1)
+          Error("invalid number of jobs: " + std::string(argv[argi]), true);
+        continue;
+      } else if (arg == "--skip-unchanged") {
+        options.skip_unchanged = true;
+        continue;
+      } else if (arg == "--output-manifest") {
+        if (++argi >= argc) Error("missing path following: " + arg, true);
+        options.output_manifest = flatbuffers::PosixPath(argv[argi]);
+        continue;
+      } else if (arg == "--stamp-dir") {
+        if (++argi >= argc) Error("missing path following: " + arg, true);
+        options.stamp_dir = flatbuffers::PosixPath(argv[argi]);
+        continue;
       } else if (arg == "--") {  // Separator between text and binary inputs.
         options.binary_files_from = options.filenames.size();
       } else if (arg == "--proto-namespace-suffix") {
@@ -657,10 +751,14 @@ FlatCOptions FlatCompiler::ParseFromCommandLineArguments(int argc,
         opts.cpp_std = arg.substr(std::string("--cpp-std=").size());
       } else if (arg == "--cpp-static-reflection") {
         opts.cpp_static_reflection = true;
+      } else if (arg == "--cpp-struct-columns") {
+        opts.cpp_struct_columns = true;
       } else if (arg == "--cs-global-alias") {
         opts.cs_global_alias = true;
       } else if (arg == "--json-nested-bytes") {
         opts.json_nested_legacy_flatbuffers = true;
+      } else if (arg == "--json-shortest-floats") {
+        opts.json_shortest_floats = true;
       } else if (arg == "--ts-flat-files") {
         opts.ts_flat_files = true;
         opts.ts_entry_points = true;
@@ -695,6 +793,33 @@ FlatCOptions FlatCompiler::ParseFromCommandLineArguments(int argc,
       } else if (arg == "--annotate") {
         if (++argi >= argc) Error("missing path following: " + arg, true);
         options.annotate_schema = flatbuffers::PosixPath(argv[argi]);
+      } else if (arg == "--annotate-stream") {
+        if (++argi >= argc) Error("missing size following: " + arg, true);
+        if (!StringToNumber(argv[argi], &options.annotate_batch_size) ||
+            options.annotate_batch_size == 0)
+          Error("invalid batch size: " + std::string(argv[argi]), true);
+        options.annotate_streaming = true;
+      } else if (arg == "--annotate-range") {
+        if (++argi >= argc) Error("missing range following: " + arg, true);
+        const std::string range = argv[argi];
+        const size_t colon = range.find(':');
+        const std::string begin = range.substr(0, colon);
+        const std::string end =
+            colon == std::string::npos ? "" : range.substr(colon + 1);
+        if (colon == std::string::npos ||
+            (!begin.empty() &&
+             !StringToNumber(begin.c_str(), &options.annotate_begin)) ||
+            (!end.empty() &&
+             !StringToNumber(end.c_str(), &options.annotate_end)) ||
+            options.annotate_begin >= options.annotate_end)
+          Error("invalid range: " + range, true);
+        options.annotate_streaming = true;
+      } else if (arg == "--annotate-sample") {
+        if (++argi >= argc) Error("missing count following: " + arg, true);
+        if (!StringToNumber(argv[argi],
+                            &options.annotate_max_vector_elements) ||
+            options.annotate_max_vector_elements == 0)
+          Error("invalid sample size: " + std::string(argv[argi]), true);
       } else if (arg == "--file-names-only") {
         // TODO (khhn): Provide 2 implementation
         options.file_names_only = true;
@@ -750,6 +875,17 @@ FlatCOptions FlatCompiler::ParseFromCommandLineArguments(int argc,
         options.requires_bfbs = is_binary_schema;
         options.generators.push_back(std::move(code_generator));
       }
+      // Paths are made absolute, so that the same options given from
+      // another directory don't match.
+      const bool takes_path = arg == "-o" || arg == "-I" ||
+                              arg == "--bfbs-filenames" ||
+                              arg == "--conform" || arg == "--conform-includes";
+      for (int i = option_begin; i <= argi && i < argc; i++) {
+        options.stamp_key += takes_path && i > option_begin
+                                 ? StampKeyPath(argv[i])
+                                 : std::string(argv[i]);
+        options.stamp_key += '\n';
+      }
     } else {
       options.filenames.push_back(flatbuffers::PosixPath(argv[argi]));
     }
@@ -804,22 +940,612 @@ flatbuffers::Parser FlatCompiler::GetConformParser(
   return conform_parser;
 }
 
+// Whether the data files in `options` may be converted on several threads:
+// only the binary and text generators may run for them, and nothing else
+// may depend on the order in which they are processed.
+static bool CanConvertDataInParallel(const FlatCOptions &options) {
+  if (options.jobs <= 1 || options.print_make_rules || options.requires_bfbs ||
+      options.grpc_enabled || options.opts.use_flexbuffers) {
+    return false;
+  }
+  for (const auto &code_generator : options.generators) {
+    if (code_generator->SupportsBfbsGeneration()) return false;
+    if (code_generator->IsSchemaOnly()) continue;
+    if (code_generator->Language() != IDLOptions::kBinary &&
+        code_generator->Language() != IDLOptions::kJson) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Whether binary inputs have to be copied into the parser's builder. The text
+// generator reads them where they are mapped; other data file generators, and
+// make rules, read the builder.
+static bool NeedsBinaryInBuilder(const FlatCOptions &options) {
+  if (options.print_make_rules || options.opts.use_flexbuffers) return true;
+  for (const auto &code_generator : options.generators) {
+    if (code_generator->SupportsBfbsGeneration() ||
+        code_generator->IsSchemaOnly()) {
+      continue;
+    }
+    if (code_generator->Language() != IDLOptions::kJson) return true;
+  }
+  return false;
+}
+
+static bool IsDataFile(const FlatCOptions &options, size_t index) {
+  if (index >= options.binary_files_from) return true;
+  auto ext = flatbuffers::GetExtension(options.filenames[index]);
+  return ext != "fbs" && ext != "proto" && ext != reflection::SchemaExtension();
+}
+
+// Files sharing a base name would write to the same outputs, and only a
+// sequential conversion says which of them ends up there.
+static bool HasUniqueOutputNames(const FlatCOptions &options, size_t begin,
+                                 size_t end) {
+  std::set<std::string> filebases;
+  for (size_t i = begin; i < end; i++) {
+    auto filebase = flatbuffers::StripPath(
+        flatbuffers::StripExtension(options.filenames[i]));
+    if (!filebases.insert(filebase).second) return false;
+  }
+  return true;
+}
+
+namespace {
+
+// A file a generator saved while converting a data file, held back until the
+// files before it are known to have converted.
+struct DeferredOutput {
+  std::string name;
+  std::string contents;
+  bool binary;
+  // The error to report if writing the file fails.
+  std::string failure;
+};
+
+// What converting a single data file produced, so that it can be written and
+// reported in input order.
+struct DataFileResult {
+  std::string warning;
+  std::string error;
+  bool usage = true;
+  bool show_exe_name = true;
+  std::vector<DeferredOutput> outputs;
+  bool done = false;
+};
+
+}  // namespace
+
+// Where SaveFile puts the outputs of the data file being converted on this
+// thread, if any, and the save function to write them with in the end.
+static thread_local std::vector<DeferredOutput> *t_deferred_outputs = nullptr;
+static SaveFileFunction g_deferred_save_file = nullptr;
+
+static bool SaveDeferredFile(const char *name, const char *buf, size_t len,
+                             bool binary) {
+  if (!t_deferred_outputs) return g_deferred_save_file(name, buf, len, binary);
+  DeferredOutput output;
+  output.name = name;
+  output.contents.assign(buf, len);
+  output.binary = binary;
+  t_deferred_outputs->push_back(std::move(output));
+  return true;
+}
+
+// Loads a private copy of a schema, leaving the parser in the state that
+// GenerateCode leaves its own parser in after the schema file. The schema
+// already loaded once, so this can not fail.
+static std::unique_ptr<Parser> LoadSchemaCopy(const FlatCOptions &options,
+                                              const std::string &filename,
+                                              const std::string &contents,
+                                              const IDLOptions &opts) {
+  std::unique_ptr<Parser> parser(new Parser(opts));
+  if (flatbuffers::GetExtension(filename) == reflection::SchemaExtension()) {
+    parser->Deserialize(reinterpret_cast<const uint8_t *>(contents.c_str()),
+                        contents.size());
+  } else {
+    ParseWithIncludes(*parser, filename, contents,
+                      options.include_directories);
+  }
+  if (options.schema_binary || opts.binary_schema_gen_embed) {
+    parser->Serialize();
+  }
+  if (options.schema_binary) {
+    parser->file_extension_ = reflection::SchemaExtension();
+  }
+  if (!options.opts.root_type.empty()) {
+    parser->SetRootType(options.opts.root_type.c_str());
+  }
+  parser->MarkGenerated();
+  return parser;
+}
+
+// Converts data file `index` the same way the sequential loop in GenerateCode
+// does, recording the first problem in `result` rather than reporting it.
+// Returns false if `parser` may have been changed by the input, in which case
+// it should not be used for further files.
+static bool ConvertDataFile(const FlatCOptions &options, Parser &parser,
+                            size_t index, DataFileResult &result) {
+  const std::string &filename = options.filenames[index];
+  const bool is_binary = index >= options.binary_files_from;
+  const bool copy_binary = NeedsBinaryInBuilder(options);
+  // Binaries are mapped rather than loaded, so they're copied at most once,
+  // into the builder.
+  flatbuffers::MappedFile binary;
+  std::string contents;
+  if (is_binary ? !binary.Open(filename.c_str())
+                : !flatbuffers::LoadFile(filename.c_str(), true, &contents)) {
+    result.error = "unable to load file: " + filename;
+    return true;
+  }
+  if (is_binary) {
+    parser.builder_.Clear();
+    if (copy_binary) {
+      parser.builder_.PushFlatBuffer(binary.data(), binary.size());
+    }
+    if (!options.raw_binary) {
+      if (!parser.file_identifier_.length()) {
+        result.error =
+            "current schema has no file_identifier: cannot test if \"" +
+            filename +
+            "\" matches the schema, use --raw-binary to read this file"
+            " anyway.";
+        return true;
+      } else if (!flatbuffers::BufferHasIdentifier(
+                     binary.data(), parser.file_identifier_.c_str(),
+                     options.opts.size_prefixed)) {
+        result.error = "binary \"" + filename +
+                       "\" does not have expected file_identifier \"" +
+                       parser.file_identifier_ +
+                       "\", use --raw-binary to read this file anyway.";
+        return true;
+      }
+    }
+  } else {
+    if (contents.length() != strlen(contents.c_str())) {
+      result.error = "input file appears to be binary: " + filename;
+      return true;
+    }
+    if (!ParseWithIncludes(parser, filename, contents,
+                           options.include_directories)) {
+      result.error = parser.error_;
+      result.usage = false;
+      result.show_exe_name = false;
+      return false;
+    }
+    if (!parser.error_.empty()) result.warning = parser.error_;
+    if (!parser.builder_.GetSize()) {
+      result.error =
+          "input file is neither json nor a .fbs (schema) file: " + filename;
+      return false;
+    }
+  }
+
+  std::string filebase =
+      flatbuffers::StripPath(flatbuffers::StripExtension(filename));
+  for (const auto &code_generator : options.generators) {
+    if (code_generator->IsSchemaOnly()) continue;
+    const size_t outputs_before = result.outputs.size();
+    std::string status_detail;
+    bool ok;
+    if (code_generator->Language() == IDLOptions::kJson) {
+      // The text generator keeps its error detail in a member, which the
+      // workers would race on, so call what it wraps directly.
+      auto err = is_binary && !copy_binary
+                     ? GenTextFile(parser, binary.data(), binary.size(),
+                                   options.output_path, filebase)
+                     : GenTextFile(parser, options.output_path, filebase);
+      if (err) status_detail = " (" + std::string(err) + ")";
+      ok = !err;
+    } else {
+      ok = code_generator->GenerateCode(parser, options.output_path,
+                                        filebase) == CodeGenerator::Status::OK;
+      if (!ok) status_detail = code_generator->status_detail;
+    }
+    if (!ok) {
+      result.error = "Unable to generate " + code_generator->LanguageName() +
+                     " for " + filebase + status_detail;
+      return true;
+    }
+    for (size_t i = outputs_before; i < result.outputs.size(); i++) {
+      result.outputs[i].failure = "Unable to generate " +
+                                  code_generator->LanguageName() + " for " +
+                                  filebase;
+    }
+  }
+  return true;
+}
+
+void FlatCompiler::ConvertDataFilesInParallel(const FlatCOptions &options,
+                                              const SchemaSource &schema,
+                                              size_t begin, size_t end) {
+  const size_t count = end - begin;
+  const size_t workers =
+      std::min(count, static_cast<size_t>(std::max(options.jobs, 1)));
+  std::vector<DataFileResult> results(count);
+  std::atomic<size_t> next(0);
+  // Files from `end_index` on are not converted: a sequential run stops at
+  // the first file that fails, so only the files before it get written.
+  std::atomic<size_t> end_index(count);
+  const auto stop_after = [&](size_t i) {
+    size_t end_before = end_index;
+    while (i + 1 < end_before &&
+           !end_index.compare_exchange_weak(end_before, i + 1)) {}
+  };
+  // Outputs are written in input order as the files before them finish.
+  std::mutex commit_mutex;
+  size_t committed = 0;
+  const auto commit = [&](size_t i) {
+    std::lock_guard<std::mutex> lock(commit_mutex);
+    results[i].done = true;
+    while (committed < end_index && results[committed].done) {
+      DataFileResult &result = results[committed];
+      for (const auto &output : result.outputs) {
+        if (!result.error.empty()) break;
+        if (!g_deferred_save_file(output.name.c_str(), output.contents.c_str(),
+                                  output.contents.size(), output.binary)) {
+          result.error = output.failure;
+        }
+      }
+      result.outputs.clear();
+      if (!result.error.empty()) stop_after(committed);
+      committed++;
+    }
+  };
+
+  flatbuffers::EnsureDirExists(options.output_path);
+  g_deferred_save_file = SetSaveFileFunction(SaveDeferredFile);
+  // One task per worker, each with its own parser, pulling files in order.
+  ParallelFor(workers, static_cast<int>(workers), [&](size_t) {
+    auto parser =
+        LoadSchemaCopy(options, schema.filename, schema.contents, schema.opts);
+    for (size_t i = next++; i < end_index; i = next++) {
+      t_deferred_outputs = &results[i].outputs;
+      const bool parser_ok =
+          ConvertDataFile(options, *parser, begin + i, results[i]);
+      t_deferred_outputs = nullptr;
+      if (!results[i].error.empty()) stop_after(i);
+      commit(i);
+      if (!parser_ok) {
+        parser = LoadSchemaCopy(options, schema.filename, schema.contents,
+                                schema.opts);
+      }
+    }
+  });
+  SetSaveFileFunction(g_deferred_save_file);
+
+  for (size_t i = 0; i < end_index; i++) {
+    const DataFileResult &result = results[i];
+    if (!result.warning.empty()) Warn(result.warning, false);
+    if (!result.error.empty()) {
+      Error(result.error, result.usage, result.show_exe_name);
+    }
+  }
+}
+
+static uint64_t HashContents(const char *buf, size_t len) {
+  uint64_t hash = FnvTraits<uint64_t>::kOffsetBasis;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= static_cast<unsigned char>(buf[i]);
+    hash *= FnvTraits<uint64_t>::kFnvPrime;
+  }
+  return hash;
+}
+
+static uint64_t HashContents(const std::string &contents) {
+  return HashContents(contents.c_str(), contents.size());
+}
+
+static std::string HashToString(uint64_t hash) {
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return ss.str();
+}
+
+// Whether file `index` may be skipped when its --stamp-dir stamp is current.
+// Data files after it would need its parser, as would root file generation.
+static bool CanStampFile(const FlatCOptions &options, size_t index) {
+  if (options.stamp_dir.empty() || options.print_make_rules ||
+      !options.conform_to_schema.empty() || IsDataFile(options, index)) {
+    return false;
+  }
+  if (index + 1 < options.filenames.size() && IsDataFile(options, index + 1)) {
+    return false;
+  }
+  for (const auto &code_generator : options.generators) {
+    if (code_generator->SupportsRootFileGeneration()) return false;
+  }
+  return true;
+}
+
+static std::string StampKey(const FlatCOptions &options) {
+  return HashToString(HashContents(std::string(FLATC_VERSION()) + '\n' +
+                                   options.stamp_key));
+}
+
+static std::string StampPath(const FlatCOptions &options,
+                             const std::string &filename) {
+  return flatbuffers::ConCatPathFileName(
+      options.stamp_dir,
+      HashToString(HashContents(flatbuffers::AbsolutePath(filename))) +
+          ".stamp");
+}
+
+// The files the code generators wrote for a schema, with the hash of their
+// contents and whether they were written in binary mode.
+typedef std::map<std::string, std::pair<uint64_t, bool>> StampOutputs;
+
+// Where SaveFile records the outputs written on this thread while the
+// generators run for a schema that gets a --stamp-dir stamp.
+static thread_local StampOutputs *t_stamp_outputs = nullptr;
+
+// Outputs of write_stamp schemas that were skipped, for the manifest.
+static void TrackOutput(const std::string &name, bool changed);
+
+// A stamp is the key of the options, followed by a line for every file the
+// schema was parsed from ('i') and every file generated from it, in text ('t')
+// or binary ('b') mode. Each line holds the kind, the hash of the contents and
+// the absolute path of the file.
+static bool IsStampCurrent(const FlatCOptions &options,
+                           const std::string &filename) {
+  std::string entry;
+  if (!flatbuffers::LoadFile(StampPath(options, filename).c_str(), false,
+                             &entry)) {
+    return false;
+  }
+  std::stringstream lines(entry);
+  std::string line;
+  if (!std::getline(lines, line) || line != StampKey(options)) return false;
+  const std::string schema_path = flatbuffers::AbsolutePath(filename);
+  bool has_schema = false;
+  std::vector<std::string> outputs;
+  while (std::getline(lines, line)) {
+    auto space = line.find(' ', 2);
+    if (line.size() < 2 || line[1] != ' ' || space == std::string::npos) {
+      return false;
+    }
+    const char kind = line[0];
+    auto path = line.substr(space + 1);
+    std::string contents;
+    if (!flatbuffers::LoadFile(path.c_str(), kind != 't', &contents) ||
+        HashToString(HashContents(contents)) != line.substr(2, space - 2)) {
+      return false;
+    }
+    if (kind == 'i' && path == schema_path) has_schema = true;
+    if (kind != 'i') outputs.push_back(path);
+  }
+  if (!has_schema) return false;
+  for (const auto &output : outputs) TrackOutput(output, false);
+  return true;
+}
+
+static void WriteStamp(const FlatCOptions &options, const Parser &parser,
+                       const std::string &filename,
+                       const StampOutputs &outputs) {
+  std::string entry = StampKey(options) + '\n';
+  auto files = parser.GetIncludedFilesRecursive(filename);
+  for (const auto &path : files) {
+    std::string contents;
+    if (!flatbuffers::LoadFile(path.c_str(), true, &contents)) return;
+    entry += "i " + HashToString(HashContents(contents)) + ' ' +
+             flatbuffers::AbsolutePath(path) + '\n';
+  }
+  for (const auto &output : outputs) {
+    entry += std::string(output.second.second ? "b " : "t ") +
+             HashToString(output.second.first) + ' ' +
+             flatbuffers::AbsolutePath(output.first) + '\n';
+  }
+  flatbuffers::EnsureDirExists(options.stamp_dir);
+  flatbuffers::SaveFile(StampPath(options, filename).c_str(), entry, false);
+}
+
+void FlatCompiler::RunCodeGenerator(const FlatCOptions &options,
+                                    CodeGenerator &code_generator,
+                                    const Parser &parser,
+                                    const std::string &filebase, bool is_schema,
+                                    const uint8_t *bfbs_buffer,
+                                    int64_t bfbs_length,
+                                    Messages &messages) const {
+  // Prefer bfbs generators if present.
+  if (code_generator.SupportsBfbsGeneration()) {
+    CodeGenOptions code_gen_options;
+    code_gen_options.output_path = options.output_path;
+
+    const CodeGenerator::Status status = code_generator.GenerateCode(
+        bfbs_buffer, bfbs_length, code_gen_options);
+    if (status != CodeGenerator::Status::OK) {
+      messages.push_back(
+          { true, "Unable to generate " + code_generator.LanguageName() +
+                      " for " + filebase + code_generator.status_detail +
+                      " using bfbs generator." });
+    }
+  } else {
+    if ((!code_generator.IsSchemaOnly() || is_schema) &&
+        code_generator.GenerateCode(parser, options.output_path, filebase) !=
+            CodeGenerator::Status::OK) {
+      messages.push_back({ true, "Unable to generate " +
+                                     code_generator.LanguageName() + " for " +
+                                     filebase + code_generator.status_detail });
+    }
+  }
+}
+
+void FlatCompiler::RunGrpcGenerator(const FlatCOptions &options,
+                                    CodeGenerator &code_generator,
+                                    const Parser &parser,
+                                    const std::string &filebase,
+                                    Messages &messages) const {
+  const CodeGenerator::Status status =
+      code_generator.GenerateGrpcCode(parser, options.output_path, filebase);
+
+  if (status == CodeGenerator::Status::NOT_IMPLEMENTED) {
+    messages.push_back(
+        { false, "GRPC interface generator not implemented for " +
+                     code_generator.LanguageName() });
+  } else if (status == CodeGenerator::Status::ERROR) {
+    messages.push_back({ true, "Unable to generate GRPC interface for " +
+                                   code_generator.LanguageName() });
+  }
+}
+
+void FlatCompiler::Report(const Messages &messages) const {
+  for (const auto &message : messages) {
+    if (message.is_error) {
+      Error(message.text);
+    } else {
+      Warn(message.text);
+    }
+  }
+}
+
+void FlatCompiler::FinishFile(Parser &parser, const std::string &root_type) {
+  if (!root_type.empty()) {
+    if (!parser.SetRootType(root_type.c_str()))
+      Error("unknown root type: " + root_type);
+    else if (parser.root_struct_def_->fixed)
+      Error("root type must be a table");
+  }
+
+  // We do not want to generate code for the definitions in this file
+  // in any files coming up next.
+  parser.MarkGenerated();
+}
+
+void FlatCompiler::GenerateSchemasInParallel(
+    const FlatCOptions &options, const std::vector<CodeGenUnit> &units) {
+  // Generators only read the parser, so every (schema, generator) pair can
+  // run on its own. The exceptions are generators that handle data files
+  // (they keep error details in a member) and bfbs generators (they keep the
+  // loaded schema in members): those run over all schemas in order as a
+  // single task. Generators called for different schemas may write the same
+  // file (e.g. for shared includes with --gen-all); they then write the same
+  // contents.
+  struct Task {
+    size_t generator;
+    size_t unit_begin;
+    size_t unit_end;
+  };
+  const auto &generators = options.generators;
+  std::vector<Task> tasks;
+  for (size_t g = 0; g < generators.size(); g++) {
+    if (generators[g]->SupportsBfbsGeneration() ||
+        !generators[g]->IsSchemaOnly()) {
+      tasks.push_back({ g, 0, units.size() });
+    } else {
+      for (size_t u = 0; u < units.size(); u++) {
+        tasks.push_back({ g, u, u + 1 });
+      }
+    }
+  }
+
+  // Messages and outputs for each schema and generator, reported in input
+  // order.
+  std::vector<Messages> messages(units.size() * generators.size());
+  std::vector<StampOutputs> outputs(units.size() * generators.size());
+  flatbuffers::EnsureDirExists(options.output_path);
+  ParallelFor(tasks.size(), options.jobs, [&](size_t t) {
+    const Task &task = tasks[t];
+    CodeGenerator &code_generator = *generators[task.generator];
+    for (size_t u = task.unit_begin; u < task.unit_end; u++) {
+      const CodeGenUnit &unit = units[u];
+      const size_t index = u * generators.size() + task.generator;
+      Messages &unit_messages = messages[index];
+      t_stamp_outputs = unit.write_stamp ? &outputs[index] : nullptr;
+      RunCodeGenerator(options, code_generator, *unit.parser, unit.filebase,
+                       true, unit.bfbs_buffer, unit.bfbs_length,
+                       unit_messages);
+      if (options.grpc_enabled) {
+        RunGrpcGenerator(options, code_generator, *unit.parser, unit.filebase,
+                         unit_messages);
+      }
+      t_stamp_outputs = nullptr;
+    }
+  });
+
+  for (size_t u = 0; u < units.size(); u++) {
+    const size_t errors_before = error_count_;
+    StampOutputs unit_outputs;
+    for (size_t g = 0; g < generators.size(); g++) {
+      Report(messages[u * generators.size() + g]);
+      const auto &generator_outputs = outputs[u * generators.size() + g];
+      unit_outputs.insert(generator_outputs.begin(), generator_outputs.end());
+    }
+    FinishFile(*units[u].parser, units[u].root_type);
+    if (units[u].write_stamp && error_count_ == errors_before) {
+      WriteStamp(options, *units[u].parser, units[u].filename, unit_outputs);
+    }
+  }
+}
+
 std::unique_ptr<Parser> FlatCompiler::GenerateCode(const FlatCOptions &options,
                                                    Parser &conform_parser) {
   std::unique_ptr<Parser> parser =
       std::unique_ptr<Parser>(new Parser(options.opts));
+  const bool parallel_data = CanConvertDataInParallel(options);
+  const bool copy_binary = NeedsBinaryInBuilder(options);
+  SchemaSource schema;
+  const bool parallel_codegen = options.jobs > 1 && !options.print_make_rules;
+  // Schema files whose code generation is deferred, and the parsers of all
+  // but the last of them.
+  std::vector<CodeGenUnit> pending;
+  std::vector<std::unique_ptr<Parser>> pending_parsers;
+  const auto generate_pending = [&]() {
+    if (pending.empty()) return;
+    GenerateSchemasInParallel(options, pending);
+    pending.clear();
+    pending_parsers.clear();
+  };
+  // Errors end the run, so generate the code for the schemas before the
+  // failing file first, as a sequential run would have.
+  const auto fail = [&](const std::string &err, bool usage,
+                        bool show_exe_name) {
+    generate_pending();
+    Error(err, usage, show_exe_name);
+  };
 
   for (auto file_it = options.filenames.begin();
        file_it != options.filenames.end(); ++file_it) {
     IDLOptions opts = options.opts;
 
+    // Data files reuse the parser of the schema before them, so the code for
+    // that schema has to be generated first.
+    const size_t file_index =
+        static_cast<size_t>(file_it - options.filenames.begin());
+    if (IsDataFile(options, file_index)) generate_pending();
+
+    // Hand a run of data files following a schema to worker threads.
+    if (parallel_data && !schema.filename.empty() &&
+        IsDataFile(options, file_index)) {
+      size_t run_end = file_index + 1;
+      while (run_end < options.filenames.size() &&
+             IsDataFile(options, run_end)) {
+        run_end++;
+      }
+      if (run_end - file_index > 1 &&
+          HasUniqueOutputNames(options, file_index, run_end)) {
+        ConvertDataFilesInParallel(options, schema, file_index, run_end);
+        file_it += static_cast<std::ptrdiff_t>(run_end - file_index - 1);
+        continue;
+      }
+    }
+
     auto &filename = *file_it;
-    std::string contents;
-    if (!flatbuffers::LoadFile(filename.c_str(), true, &contents))
-      Error("unable to load file: " + filename);
+    const bool write_stamp = CanStampFile(options, file_index);
+    if (write_stamp && IsStampCurrent(options, filename)) continue;
+    const size_t errors_before = error_count_;
 
     bool is_binary = static_cast<size_t>(file_it - options.filenames.begin()) >=
                      options.binary_files_from;
+    // Binaries are mapped rather than loaded, so they're copied at most once,
+    // into the builder.
+    flatbuffers::MappedFile binary;
+    std::string contents;
+    if (is_binary ? !binary.Open(filename.c_str())
+                  : !flatbuffers::LoadFile(filename.c_str(), true, &contents))
+      fail("unable to load file: " + filename, true, true);
+
     auto ext = flatbuffers::GetExtension(filename);
     const bool is_schema = ext == "fbs" || ext == "proto";
     if (is_schema && opts.project_root.empty()) {
@@ -828,9 +1554,9 @@ std::unique_ptr<Parser> FlatCompiler::GenerateCode(const FlatCOptions &options,
     const bool is_binary_schema = ext == reflection::SchemaExtension();
     if (is_binary) {
       parser->builder_.Clear();
-      parser->builder_.PushFlatBuffer(
-          reinterpret_cast<const uint8_t *>(contents.c_str()),
-          contents.length());
+      if (copy_binary) {
+        parser->builder_.PushFlatBuffer(binary.data(), binary.size());
+      }
       if (!options.raw_binary) {
         // Generally reading binaries that do not correspond to the schema
         // will crash, and sadly there's no way around that when the binary
@@ -843,7 +1569,7 @@ std::unique_ptr<Parser> FlatCompiler::GenerateCode(const FlatCOptions &options,
                 "\" matches the schema, use --raw-binary to read this file"
                 " anyway.");
         } else if (!flatbuffers::BufferHasIdentifier(
-                       contents.c_str(), parser->file_identifier_.c_str(),
+                       binary.data(), parser->file_identifier_.c_str(),
                        opts.size_prefixed)) {
           Error("binary \"" + filename +
                 "\" does not have expected file_identifier \"" +
@@ -855,18 +1581,28 @@ std::unique_ptr<Parser> FlatCompiler::GenerateCode(const FlatCOptions &options,
       // Check if file contains 0 bytes.
       if (!opts.use_flexbuffers && !is_binary_schema &&
           contents.length() != strlen(contents.c_str())) {
-        Error("input file appears to be binary: " + filename, true);
+        fail("input file appears to be binary: " + filename, true, true);
       }
       if (is_schema || is_binary_schema) {
         // If we're processing multiple schemas, make sure to start each
         // one from scratch. If it depends on previous schemas it must do
         // so explicitly using an include.
+        if (!pending.empty()) pending_parsers.push_back(std::move(parser));
         parser.reset(new Parser(opts));
+        if (parallel_data) {
+          schema.filename = filename;
+          schema.contents = contents;
+          schema.opts = opts;
+        }
       }
       // Try to parse the file contents (binary schema/flexbuffer/textual
       // schema)
       if (is_binary_schema) {
-        LoadBinarySchema(*parser, filename, contents);
+        if (!parser->Deserialize(
+                reinterpret_cast<const uint8_t *>(contents.c_str()),
+                contents.size())) {
+          fail("failed to load binary schema: " + filename, false, false);
+        }
       } else if (opts.use_flexbuffers) {
         if (opts.lang_to_generate == IDLOptions::kJson) {
           auto data = reinterpret_cast<const uint8_t *>(contents.c_str());
@@ -880,7 +1616,11 @@ std::unique_ptr<Parser> FlatCompiler::GenerateCode(const FlatCOptions &options,
           ParseFile(*parser, filename, contents, options.include_directories);
         }
       } else {
-        ParseFile(*parser, filename, contents, options.include_directories);
+        if (!ParseWithIncludes(*parser, filename, contents,
+                               options.include_directories)) {
+          fail(parser->error_, false, false);
+        }
+        if (!parser->error_.empty()) Warn(parser->error_, false);
         if (!is_schema && !parser->builder_.GetSize()) {
           // If a file doesn't end in .fbs, it must be json/binary. Ensure we
           // didn't just parse a schema with a different extension.
@@ -892,7 +1632,7 @@ std::unique_ptr<Parser> FlatCompiler::GenerateCode(const FlatCOptions &options,
       if ((is_schema || is_binary_schema) &&
           !options.conform_to_schema.empty()) {
         auto err = parser->ConformTo(conform_parser);
-        if (!err.empty()) Error("schemas don\'t conform: " + err, false);
+        if (!err.empty()) fail("schemas don\'t conform: " + err, false, true);
       }
       if (options.schema_binary || opts.binary_schema_gen_embed) {
         parser->Serialize();
@@ -914,6 +1654,21 @@ std::unique_ptr<Parser> FlatCompiler::GenerateCode(const FlatCOptions &options,
       bfbs_length = parser->builder_.GetSize();
     }
 
+    if (parallel_codegen && (is_schema || is_binary_schema)) {
+      CodeGenUnit unit;
+      unit.parser = parser.get();
+      unit.filename = filename;
+      unit.filebase = filebase;
+      unit.root_type = opts.root_type;
+      unit.bfbs_buffer = bfbs_buffer;
+      unit.bfbs_length = bfbs_length;
+      unit.write_stamp = write_stamp && error_count_ == errors_before;
+      pending.push_back(unit);
+      continue;
+    }
+
+    StampOutputs outputs;
+    if (write_stamp) t_stamp_outputs = &outputs;
     for (const std::shared_ptr<CodeGenerator> &code_generator :
          options.generators) {
       if (options.print_make_rules) {
@@ -927,62 +1682,97 @@ std::unique_ptr<Parser> FlatCompiler::GenerateCode(const FlatCOptions &options,
           Error("Cannot generate make rule for " +
                 code_generator->LanguageName());
         }
-      } else {
+      } else if (is_binary && !copy_binary &&
+                 code_generator->Language() == IDLOptions::kJson) {
         flatbuffers::EnsureDirExists(options.output_path);
-
-        // Prefer bfbs generators if present.
-        if (code_generator->SupportsBfbsGeneration()) {
-          CodeGenOptions code_gen_options;
-          code_gen_options.output_path = options.output_path;
-
-          const CodeGenerator::Status status = code_generator->GenerateCode(
-              bfbs_buffer, bfbs_length, code_gen_options);
-          if (status != CodeGenerator::Status::OK) {
-            Error("Unable to generate " + code_generator->LanguageName() +
-                  " for " + filebase + code_generator->status_detail +
-                  " using bfbs generator.");
-          }
-        } else {
-          if ((!code_generator->IsSchemaOnly() ||
-               (is_schema || is_binary_schema)) &&
-              code_generator->GenerateCode(*parser, options.output_path,
-                                           filebase) !=
-                  CodeGenerator::Status::OK) {
-            Error("Unable to generate " + code_generator->LanguageName() +
-                  " for " + filebase + code_generator->status_detail);
-          }
+        auto err = GenTextFile(*parser, binary.data(), binary.size(),
+                               options.output_path, filebase);
+        if (err) {
+          Error("Unable to generate " + code_generator->LanguageName() +
+                " for " + filebase + " (" + err + ")");
         }
+      } else {
+        flatbuffers::EnsureDirExists(options.output_path);
+        Messages messages;
+        RunCodeGenerator(options, *code_generator, *parser, filebase,
+                         is_schema || is_binary_schema, bfbs_buffer,
+                         bfbs_length, messages);
+        Report(messages);
       }
 
       if (options.grpc_enabled) {
-        const CodeGenerator::Status status = code_generator->GenerateGrpcCode(
-            *parser, options.output_path, filebase);
-
-        if (status == CodeGenerator::Status::NOT_IMPLEMENTED) {
-          Warn("GRPC interface generator not implemented for " +
-               code_generator->LanguageName());
-        } else if (status == CodeGenerator::Status::ERROR) {
-          Error("Unable to generate GRPC interface for " +
-                code_generator->LanguageName());
-        }
+        Messages messages;
+        RunGrpcGenerator(options, *code_generator, *parser, filebase,
+                         messages);
+        Report(messages);
       }
     }
 
-    if (!opts.root_type.empty()) {
-      if (!parser->SetRootType(opts.root_type.c_str()))
-        Error("unknown root type: " + opts.root_type);
-      else if (parser->root_struct_def_->fixed)
-        Error("root type must be a table");
-    }
+    t_stamp_outputs = nullptr;
 
-    // We do not want to generate code for the definitions in this file
-    // in any files coming up next.
-    parser->MarkGenerated();
+    FinishFile(*parser, opts.root_type);
+    if (write_stamp && error_count_ == errors_before) {
+      WriteStamp(options, *parser, filename, outputs);
+    }
   }
 
+  generate_pending();
   return parser;
 }
 
+// Files written through SaveFile while --skip-unchanged, --output-manifest or
+// --stamp-dir is in effect, and whether each one's contents changed.
+// Generators may be running on several threads (--jobs).
+static std::mutex g_outputs_mutex;
+static std::map<std::string, bool> g_outputs;
+static bool g_skip_unchanged = false;
+static SaveFileFunction g_save_file_function = nullptr;
+
+static bool SaveTrackedFile(const char *name, const char *buf, size_t len,
+                            bool binary) {
+  // Compare with what is there even when not skipping, so the manifest can
+  // tell which outputs changed; an unchanged file is then written regardless.
+  bool changed = true;
+  bool ok = SaveFileIfChanged(name, buf, len, binary, &changed);
+  if (ok && !changed && !g_skip_unchanged) {
+    ok = g_save_file_function(name, buf, len, binary);
+  }
+  if (!ok) return false;
+  if (t_stamp_outputs) {
+    (*t_stamp_outputs)[name] = std::make_pair(HashContents(buf, len), binary);
+  }
+  TrackOutput(name, changed);
+  return true;
+}
+
+static void TrackOutput(const std::string &name, bool changed) {
+  std::lock_guard<std::mutex> lock(g_outputs_mutex);
+  // A file written more than once changed if any of the writes changed it.
+  g_outputs[name] |= changed;
+}
+
+static std::string OutputManifest(const FlatCOptions &options) {
+  // Stamps are bookkeeping rather than outputs.
+  const std::string stamp_prefix =
+      options.stamp_dir.empty()
+          ? std::string()
+          : flatbuffers::ConCatPathFileName(options.stamp_dir, "");
+  std::string lists[2];
+  for (const auto &output : g_outputs) {
+    if (!stamp_prefix.empty() && output.first.rfind(stamp_prefix, 0) == 0) {
+      continue;
+    }
+    std::string &list = lists[output.second ? 0 : 1];
+    list += list.empty() ? "\n" : ",\n";
+    list += "    ";
+    EscapeString(output.first.c_str(), output.first.size(), &list, true,
+                 false);
+  }
+  return "{\n  \"changed\": [" + lists[0] + (lists[0].empty() ? "" : "\n  ") +
+         "],\n  \"unchanged\": [" + lists[1] +
+         (lists[1].empty() ? "" : "\n  ") + "]\n}\n";
+}
+
 int FlatCompiler::Compile(const FlatCOptions &options) {
   // TODO(derekbailey): change to std::optional<Parser>
   Parser conform_parser = GetConformParser(options);
@@ -1042,6 +1832,15 @@ int FlatCompiler::Compile(const FlatCOptions &options) {
     return -1;
   }
 
+  const bool track_outputs = options.skip_unchanged ||
+                             !options.output_manifest.empty() ||
+                             !options.stamp_dir.empty();
+  if (track_outputs) {
+    g_outputs.clear();
+    g_skip_unchanged = options.skip_unchanged;
+    g_save_file_function = SetSaveFileFunction(SaveTrackedFile);
+  }
+
   std::unique_ptr<Parser> parser = GenerateCode(options, conform_parser);
 
   for (const auto &code_generator : options.generators) {
@@ -1050,6 +1849,16 @@ int FlatCompiler::Compile(const FlatCOptions &options) {
     }
   }
 
+  if (track_outputs) {
+    SetSaveFileFunction(g_save_file_function);
+    if (!options.output_manifest.empty() &&
+        !flatbuffers::SaveFile(options.output_manifest.c_str(),
+                               OutputManifest(options), false)) {
+      Error("unable to write output manifest: " + options.output_manifest,
+            false);
+    }
+  }
+
   return 0;
 }
 
@@ -442,6 +442,9 @@ class CppGenerator : public BaseGenerator {
     if (opts_.gen_nullable) { code_ += "#pragma clang system_header\n\n"; }
 
     code_ += "#include \"flatbuffers/flatbuffers.h\"";
+    if (opts_.cpp_object_api_arena) {
+      code_ += "#include \"flatbuffers/native_arena.h\"";
+    }
     if (parser_.uses_flexbuffers_) {
       code_ += "#include \"flatbuffers/flexbuffers.h\"";
       code_ += "#include \"flatbuffers/flex_flat_util.h\"";
@@ -465,6 +468,9 @@ class CppGenerator : public BaseGenerator {
         if (!struct_def->fixed) {
           code_ += "struct " + Name(*struct_def) + "Builder;";
         }
+        if (ColumnarRowTable(*struct_def)) {
+          code_ += "struct " + Name(*struct_def) + "Row;";
+        }
         if (opts_.generate_object_based_api) {
           auto nativeName = NativeName(Name(*struct_def), struct_def, opts_);
 
@@ -594,6 +600,14 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
+      // A buffer that is already known to be valid.
+      code_ += "inline \\";
+      code_ += "const {{CPP_NAME}} *{{NULLABLE_EXT}}Get{{STRUCT_NAME}}(";
+      code_ += "    const ::flatbuffers::TrustedBuffer<{{CPP_NAME}}> &buf) {";
+      code_ += "  return ::flatbuffers::GetRoot(buf);";
+      code_ += "}";
+      code_ += "";
+
       code_ += "inline \\";
       code_ +=
           "const {{CPP_NAME}} "
@@ -673,6 +687,14 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
+      code_ += "inline ::flatbuffers::TrustedBuffer<{{CPP_NAME}}> "
+               "Trust{{STRUCT_NAME}}Buffer(";
+      code_ += "    ::flatbuffers::DetachedBuffer &&buf) {";
+      code_ += "  return ::flatbuffers::TrustedBuffer<{{CPP_NAME}}>::Verify(";
+      code_ += "      std::move(buf), {{ID}});";
+      code_ += "}";
+      code_ += "";
+
       if (parser_.file_extension_.length()) {
         // Return the extension
         code_ += "inline const char *{{STRUCT_NAME}}Extension() {";
@@ -702,6 +724,14 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
+      code_ += "inline ::flatbuffers::TrustedBuffer<{{CPP_NAME}}> "
+               "FinishAndRelease{{STRUCT_NAME}}Buffer(";
+      code_ += "    " + GetBuilder() + " &fbb,";
+      code_ += "    ::flatbuffers::Offset<{{CPP_NAME}}> root) {";
+      code_ += "  return fbb.FinishAndRelease(root, {{ID}});";
+      code_ += "}";
+      code_ += "";
+
       if (opts_.generate_object_based_api) {
         // A convenient root unpack function.
         auto native_name = WrapNativeNameInNameSpace(struct_def, opts_);
@@ -710,21 +740,45 @@ class CppGenerator : public BaseGenerator {
         code_.SetValue("UNPACK_TYPE",
                        GenTypeNativePtr(native_name, nullptr, true));
 
-        code_ += "inline {{UNPACK_RETURN}} UnPack{{STRUCT_NAME}}(";
-        code_ += "    const void *buf,";
-        code_ +=
-            "    const ::flatbuffers::resolver_function_t *res = nullptr) {";
-        code_ += "  return {{UNPACK_TYPE}}\\";
-        code_ += "(Get{{STRUCT_NAME}}(buf)->UnPack(res));";
-        code_ += "}";
-        code_ += "";
+        if (IsArenaPtr(nullptr)) {
+          GenArenaRootUnPack(native_name, "");
+          GenArenaRootUnPack(native_name, "SizePrefixed");
+        } else {
+          code_ += "inline {{UNPACK_RETURN}} UnPack{{STRUCT_NAME}}(";
+          code_ += "    const void *buf,";
+          code_ +=
+              "    const ::flatbuffers::resolver_function_t *res = nullptr) {";
+          code_ += "  return {{UNPACK_TYPE}}\\";
+          code_ += "(Get{{STRUCT_NAME}}(buf)->UnPack(res));";
+          code_ += "}";
+          code_ += "";
 
-        code_ += "inline {{UNPACK_RETURN}} UnPackSizePrefixed{{STRUCT_NAME}}(";
-        code_ += "    const void *buf,";
+          code_ +=
+              "inline {{UNPACK_RETURN}} UnPackSizePrefixed{{STRUCT_NAME}}(";
+          code_ += "    const void *buf,";
+          code_ +=
+              "    const ::flatbuffers::resolver_function_t *res = nullptr) {";
+          code_ += "  return {{UNPACK_TYPE}}\\";
+          code_ += "(GetSizePrefixed{{STRUCT_NAME}}(buf)->UnPack(res));";
+          code_ += "}";
+          code_ += "";
+        }
+
+        // Pack into caller memory, see ::flatbuffers::PackInto().
+        code_.SetValue("NATIVE_NAME", native_name);
+        code_.SetValue("PACK_INTO_BUILDER",
+                       needs_64_bit_builder_ ? ", " + GetBuilder() : "");
+        code_ +=
+            "inline ::flatbuffers::span<uint8_t> Pack{{STRUCT_NAME}}Into(";
+        code_ += "    ::flatbuffers::span<uint8_t> buf,";
+        code_ += "    const {{NATIVE_NAME}} &_o,";
         code_ +=
-            "    const ::flatbuffers::resolver_function_t *res = nullptr) {";
-        code_ += "  return {{UNPACK_TYPE}}\\";
-        code_ += "(GetSizePrefixed{{STRUCT_NAME}}(buf)->UnPack(res));";
+            "    const ::flatbuffers::rehasher_function_t *_rehasher = "
+            "nullptr) {";
+        code_ +=
+            "  return ::flatbuffers::PackInto<{{CPP_NAME}}"
+            "{{PACK_INTO_BUILDER}}>(";
+        code_ += "      buf, _o, {{ID}}, _rehasher);";
         code_ += "}";
         code_ += "";
       }
@@ -915,6 +969,50 @@ class CppGenerator : public BaseGenerator {
     return ptr_type == "naked" ? "" : ".get()";
   }
 
+  // Returns true if `field` (or the root object if null) is held by the
+  // arena_ptr of --cpp-arena, so it can be allocated from the UnPack() arena.
+  bool IsArenaPtr(const FieldDef *field) {
+    if (!opts_.cpp_object_api_arena) return false;
+    const auto &ptr_type = PtrType(field);
+    return (ptr_type == "default_ptr_type" ? opts_.cpp_object_api_pointer_type
+                                           : ptr_type) ==
+           "::flatbuffers::arena_ptr";
+  }
+
+  // Returns true if the object API member for `field` takes its allocator
+  // from the enclosing object in --cpp-arena mode.
+  bool IsArenaMember(const FieldDef &field) {
+    const auto &type = field.value.type;
+    if (!opts_.cpp_object_api_arena || field.deprecated ||
+        type.base_type == BASE_TYPE_UTYPE ||
+        (IsVector(type) && type.element == BASE_TYPE_UTYPE) ||
+        field.attributes.Lookup("cpp_type")) {
+      return false;
+    }
+    return GenTypeNative(type, false, field).compare(0, 10, "std::pmr::") == 0;
+  }
+
+  std::string NativeVector(const std::string &type_name) {
+    return (opts_.cpp_object_api_arena ? "std::pmr::vector<" : "std::vector<") +
+           type_name + ">";
+  }
+
+  void GenArenaRootUnPack(const std::string &native_name,
+                          const std::string &prefix) {
+    code_.SetValue("PREFIX", prefix);
+    code_.SetValue("ROOT_NATIVE_NAME", native_name);
+    code_ += "inline {{UNPACK_RETURN}} UnPack{{PREFIX}}{{STRUCT_NAME}}(";
+    code_ += "    const void *buf,";
+    code_ += "    const ::flatbuffers::resolver_function_t *res = nullptr,";
+    code_ += "    std::pmr::memory_resource *arena = nullptr) {";
+    code_ +=
+        "  return {{UNPACK_TYPE}}(Get{{PREFIX}}{{STRUCT_NAME}}(buf)->UnPack("
+        "res, arena),";
+    code_ += "      ::flatbuffers::ArenaDeleter<{{ROOT_NATIVE_NAME}}>(arena));";
+    code_ += "}";
+    code_ += "";
+  }
+
   std::string GenOptionalNull() { return "::flatbuffers::nullopt"; }
 
   std::string GenOptionalDecl(const Type &type) {
@@ -937,7 +1035,7 @@ class CppGenerator : public BaseGenerator {
           return "std::vector<" + type_name + "," +
                  native_custom_alloc->constant + "<" + type_name + ">>";
         } else {
-          return "std::vector<" + type_name + ">";
+          return NativeVector(type_name);
         }
       }
       case BASE_TYPE_STRUCT: {
@@ -1086,6 +1184,12 @@ class CppGenerator : public BaseGenerator {
            " type, const ::flatbuffers::resolver_function_t *resolver)";
   }
 
+  std::string UnionUnPackToSignature(const EnumDef &enum_def, bool inclass) {
+    return "void " + (inclass ? "" : Name(enum_def) + "Union::") +
+           "UnPackTo(const void *obj, const ::flatbuffers::resolver_function_t "
+           "*resolver)";
+  }
+
   std::string UnionPackSignature(const EnumDef &enum_def, bool inclass) {
     return "::flatbuffers::Offset<void> " +
            (inclass ? "" : Name(enum_def) + "Union::") + "Pack(" +
@@ -1113,12 +1217,25 @@ class CppGenerator : public BaseGenerator {
            (inclass ? " = nullptr" : "") + ")";
   }
 
+  std::string TablePackedSizeSignature(const StructDef &struct_def,
+                                       bool inclass, const IDLOptions &opts) {
+    return std::string(inclass ? "static " : "") + "size_t " +
+           (inclass ? "" : Name(struct_def) + "::") + "PackedSize(const " +
+           NativeName(Name(struct_def), &struct_def, opts) + " &_o)";
+  }
+
+  std::string UnionPackedSizeSignature(const EnumDef &enum_def, bool inclass) {
+    return "size_t " + (inclass ? "" : Name(enum_def) + "Union::") +
+           "PackedSize() const";
+  }
+
   std::string TableUnPackSignature(const StructDef &struct_def, bool inclass,
                                    const IDLOptions &opts) {
     return NativeName(Name(struct_def), &struct_def, opts) + " *" +
            (inclass ? "" : Name(struct_def) + "::") +
            "UnPack(const ::flatbuffers::resolver_function_t *_resolver" +
-           (inclass ? " = nullptr" : "") + ") const";
+           (inclass ? " = nullptr" : "") + ArenaParam(inclass, opts) +
+           ") const";
   }
 
   std::string TableUnPackToSignature(const StructDef &struct_def, bool inclass,
@@ -1126,7 +1243,14 @@ class CppGenerator : public BaseGenerator {
     return "void " + (inclass ? "" : Name(struct_def) + "::") + "UnPackTo(" +
            NativeName(Name(struct_def), &struct_def, opts) + " *" +
            "_o, const ::flatbuffers::resolver_function_t *_resolver" +
-           (inclass ? " = nullptr" : "") + ") const";
+           (inclass ? " = nullptr" : "") + ArenaParam(inclass, opts) +
+           ") const";
+  }
+
+  std::string ArenaParam(bool inclass, const IDLOptions &opts) {
+    if (!opts.cpp_object_api_arena) return "";
+    return std::string(", std::pmr::memory_resource *_arena") +
+           (inclass ? " = nullptr" : "");
   }
 
   void GenMiniReflectPre(const StructDef *struct_def) {
@@ -1340,6 +1464,7 @@ class CppGenerator : public BaseGenerator {
     code_ += "";
     GenEnumArray(enum_def);
     GenEnumStringTable(enum_def);
+    if (opts_.cpp_static_reflection) { GenEnumStaticReflection(enum_def); }
 
     // Generate type traits for unions to map from a type to union enum value.
     if (enum_def.is_union && !enum_def.uses_multiple_type_instances) {
@@ -1431,7 +1556,9 @@ class CppGenerator : public BaseGenerator {
       code_ += "";
     }
     code_ += "  " + UnionUnPackSignature(enum_def, true) + ";";
+    code_ += "  " + UnionUnPackToSignature(enum_def, true) + ";";
     code_ += "  " + UnionPackSignature(enum_def, true) + ";";
+    code_ += "  " + UnionPackedSizeSignature(enum_def, true) + ";";
     code_ += "";
 
     for (const auto ev : enum_def.Vals()) {
@@ -1581,6 +1708,41 @@ class CppGenerator : public BaseGenerator {
     }
   }
 
+  // Overloads found through ADL by the compile-time iteration in
+  // minireflect.h, so it can name enum values and dispatch on union types
+  // without a TypeTable:
+  //
+  //   inline const char *EnumName(Color e) { return EnumNameColor(e); }
+  //
+  //   template<typename F> bool VisitUnion(Any type, const void *obj, F &&f) {
+  //     switch (type) {
+  //       case Any_Monster: f(static_cast<const Monster *>(obj)); return true;
+  //       default: return false;
+  //     }
+  //   }
+  void GenEnumStaticReflection(const EnumDef &enum_def) {
+    code_ += "inline const char *EnumName({{ENUM_NAME}} e) {";
+    code_ += "  return EnumName{{ENUM_NAME}}(e);";
+    code_ += "}";
+    code_ += "";
+    if (!enum_def.is_union) return;
+    code_ += "template<typename F>";
+    code_ += "bool VisitUnion({{ENUM_NAME}} type, const void *obj, F &&f) {";
+    code_ += "  switch (type) {";
+    for (const auto ev : enum_def.Vals()) {
+      if (ev->IsZero()) continue;
+      code_.SetValue("LABEL", GetEnumValUse(enum_def, *ev));
+      code_.SetValue("TYPE", GetUnionElement(*ev, false, opts_));
+      code_ += "    case {{LABEL}}:";
+      code_ += "      f(static_cast<const {{TYPE}} *>(obj));";
+      code_ += "      return true;";
+    }
+    code_ += "    default: return false;";
+    code_ += "  }";
+    code_ += "}";
+    code_ += "";
+  }
+
   void GenUnionPost(const EnumDef &enum_def) {
     // Generate a verifier function for this union that can be called by the
     // table verifier functions. It uses a switch case to select a specific
@@ -1677,6 +1839,44 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
+      // Union UnPackTo(), which unpacks into the existing value of the same
+      // type, so unpacking same-shaped buffers reuses it.
+      code_ += "inline " + UnionUnPackToSignature(enum_def, false) + " {";
+      code_ += "  if (!value) {";
+      code_ += "    value = UnPack(obj, type, resolver);";
+      code_ += "    return;";
+      code_ += "  }";
+      code_ += "  switch (type) {";
+      for (const auto &ev : enum_def.Vals()) {
+        if (ev->IsZero()) { continue; }
+        code_.SetValue("LABEL", GetEnumValUse(enum_def, *ev));
+        code_.SetValue("TYPE", GetUnionElement(*ev, false, opts_));
+        code_.SetValue("NATIVE_TYPE", GetUnionElement(*ev, true, opts_));
+        code_ += "    case {{LABEL}}: {";
+        code_ += "      auto ptr = reinterpret_cast<const {{TYPE}} *>(obj);";
+        if (ev->union_type.base_type == BASE_TYPE_STRUCT) {
+          if (ev->union_type.struct_def->fixed) {
+            code_ += "      *reinterpret_cast<{{TYPE}} *>(value) = *ptr;";
+          } else {
+            code_ +=
+                "      ptr->UnPackTo(reinterpret_cast<{{NATIVE_TYPE}} *>"
+                "(value), resolver);";
+          }
+        } else if (IsString(ev->union_type)) {
+          code_ +=
+              "      reinterpret_cast<std::string *>(value)->assign("
+              "ptr->c_str(), ptr->size());";
+        } else {
+          FLATBUFFERS_ASSERT(false);
+        }
+        code_ += "      break;";
+        code_ += "    }";
+      }
+      code_ += "    default: break;";
+      code_ += "  }";
+      code_ += "}";
+      code_ += "";
+
       code_ += "inline " + UnionPackSignature(enum_def, false) + " {";
       code_ += "  (void)_rehasher;";
       code_ += "  switch (type) {";
@@ -1709,6 +1909,40 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
+      code_ += "inline " + UnionPackedSizeSignature(enum_def, false) + " {";
+      code_ += "  switch (type) {";
+      for (const auto &ev : enum_def.Vals()) {
+        if (ev->IsZero()) { continue; }
+        code_.SetValue("LABEL", GetEnumValUse(enum_def, *ev));
+        code_.SetValue("TYPE", GetUnionElement(*ev, false, opts_));
+        code_.SetValue("NATIVE_TYPE", GetUnionElement(*ev, true, opts_));
+        code_ += "    case {{LABEL}}: {";
+        if (ev->union_type.base_type == BASE_TYPE_STRUCT) {
+          const auto &struct_def = *ev->union_type.struct_def;
+          if (struct_def.fixed) {
+            code_ += "      return " +
+                     NumToString(struct_def.bytesize + struct_def.minalign -
+                                 1) +
+                     ";";
+          } else {
+            code_ +=
+                "      return {{TYPE}}::PackedSize("
+                "*reinterpret_cast<const {{NATIVE_TYPE}} *>(value));";
+          }
+        } else if (IsString(ev->union_type)) {
+          code_ +=
+              "      return ::flatbuffers::PackedStringSize("
+              "reinterpret_cast<const std::string *>(value)->length());";
+        } else {
+          FLATBUFFERS_ASSERT(false);
+        }
+        code_ += "    }";
+      }
+      code_ += "    default: return 0;";
+      code_ += "  }";
+      code_ += "}";
+      code_ += "";
+
       // Union copy constructor
       code_ +=
           "inline {{ENUM_NAME}}Union::{{ENUM_NAME}}Union(const "
@@ -1960,7 +2194,7 @@ class CppGenerator : public BaseGenerator {
     // the exception of types that need a copy/move ctors and assignment
     // operators.
     if (opts_.g_cpp_std >= cpp::CPP_STD_11) {
-      if (NeedsCopyCtorAssignOp(struct_def)) {
+      if (NeedsCopyCtorAssignOp(struct_def) || opts_.cpp_object_api_arena) {
         code_ += "  {{NATIVE_NAME}}() = default;";
       }
       return;
@@ -2008,6 +2242,37 @@ class CppGenerator : public BaseGenerator {
     code_ += "  }";
   }
 
+  // Generate the allocator-extended constructors of --cpp-arena, which make
+  // the object allocator-aware: ArenaNew() and std::pmr containers of it pass
+  // their memory resource on to its string and vector members.
+  void GenArenaConstructors(const StructDef &struct_def) {
+    if (!opts_.cpp_object_api_arena) return;
+    std::string initializer_list;
+    for (const auto &field : struct_def.fields.vec) {
+      if (!IsArenaMember(*field)) continue;
+      if (!initializer_list.empty()) { initializer_list += ",\n        "; }
+      initializer_list += Name(*field) + "(_alloc)";
+    }
+    if (!initializer_list.empty()) {
+      initializer_list = "\n      : " + initializer_list;
+    }
+    code_.SetValue("NATIVE_NAME",
+                   NativeName(Name(struct_def), &struct_def, opts_));
+    code_.SetValue("INIT_LIST", initializer_list);
+    code_.SetValue("ALLOC_PARAM", initializer_list.empty() ? "" : "_alloc");
+    code_ += "  typedef std::pmr::polymorphic_allocator<char> allocator_type;";
+    code_ +=
+        "  explicit {{NATIVE_NAME}}(const allocator_type &{{ALLOC_PARAM}})"
+        "{{INIT_LIST}} {}";
+    code_ +=
+        "  {{NATIVE_NAME}}(const {{NATIVE_NAME}} &o, const allocator_type "
+        "&_alloc)";
+    code_ += "      : {{NATIVE_NAME}}(_alloc) { *this = o; }";
+    code_ +=
+        "  {{NATIVE_NAME}}({{NATIVE_NAME}} &&o, const allocator_type &_alloc)";
+    code_ += "      : {{NATIVE_NAME}}(_alloc) { *this = std::move(o); }";
+  }
+
   // Generate the >= C++11 copy/move constructor and assignment operator
   // declarations if required. Tables that are default-copyable do not get
   // user-provided copy/move constructors and assignment operators so they
@@ -2100,7 +2365,13 @@ class CppGenerator : public BaseGenerator {
         if (!swaps.empty()) { swaps += "\n  "; }
         CodeWriter cw;
         cw.SetValue("FIELD", Name(*field));
-        cw += "std::swap({{FIELD}}, o.{{FIELD}});\\";
+        // Swapping std::pmr containers with different memory resources is
+        // undefined, while moving into one copies if needed.
+        if (opts_.cpp_object_api_arena) {
+          cw += "{{FIELD}} = std::move(o.{{FIELD}});\\";
+        } else {
+          cw += "std::swap({{FIELD}}, o.{{FIELD}});\\";
+        }
         swaps += cw.ToString();
       }
     }
@@ -2232,6 +2503,7 @@ class CppGenerator : public BaseGenerator {
     for (const auto field : struct_def.fields.vec) { GenMember(*field); }
     GenOperatorNewDelete(struct_def);
     GenDefaultConstructor(struct_def);
+    GenArenaConstructors(struct_def);
     GenCopyMoveCtorAndAssigOpDecls(struct_def);
     code_ += "};";
     code_ += "";
@@ -2688,6 +2960,39 @@ class CppGenerator : public BaseGenerator {
     code_ += "\n  };";
   }
 
+  // Sample for Vec3 (byte offsets), tables use their vtable offsets instead:
+  //
+  //   static constexpr std::array<::flatbuffers::voffset_t, 3> field_offsets =
+  //   {
+  //     0,
+  //     4,
+  //     8
+  //   };
+  //
+  void GenFieldOffsets(const StructDef &struct_def) {
+    code_ += "  static constexpr std::array<\\";
+    code_ += "::flatbuffers::voffset_t, fields_number> field_offsets = {\\";
+    if (struct_def.fields.vec.empty()) {
+      code_ += "};";
+      return;
+    }
+    code_ += "";
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated) {
+        // Deprecated fields won't be accessible.
+        continue;
+      }
+      code_.SetValue("FIELD_OFFSET",
+                     struct_def.fixed ? NumToString(field.value.offset)
+                                      : "type::" + GenFieldOffsetName(field));
+      code_ += "    {{FIELD_OFFSET}}\\";
+      if (it + 1 != struct_def.fields.vec.end()) { code_ += ","; }
+    }
+    code_ += "\n  };";
+  }
+
   void GenFieldsNumber(const StructDef &struct_def) {
     const auto non_deprecated_field_count = std::count_if(
         struct_def.fields.vec.begin(), struct_def.fields.vec.end(),
@@ -2715,6 +3020,7 @@ class CppGenerator : public BaseGenerator {
           "\"{{FULLY_QUALIFIED_NAME}}\";";
       GenFieldsNumber(struct_def);
       GenFieldNames(struct_def);
+      GenFieldOffsets(struct_def);
       GenFieldTypeHelper(struct_def);
     }
     code_ += "};";
@@ -2883,10 +3189,41 @@ class CppGenerator : public BaseGenerator {
 
     // Generate a verifier function that can check a buffer from an untrusted
     // source will never cause reads outside the buffer.
+    // Optional scalars and structs are stored inline, and are checked together
+    // by VerifyInlineFields() when there are several of them.
+    std::vector<const FieldDef *> inline_fields;
+    for (const auto &field : struct_def.fields.vec) {
+      if (!field->deprecated && !field->IsRequired() &&
+          (IsScalar(field->value.type.base_type) ||
+           IsStruct(field->value.type))) {
+        inline_fields.push_back(field);
+      }
+    }
+    if (inline_fields.size() < 2) inline_fields.clear();
+
     code_ += "  bool Verify(::flatbuffers::Verifier &verifier) const {";
+    if (!inline_fields.empty()) {
+      code_ +=
+          "    static const ::flatbuffers::InlineField inline_fields_[] = {";
+      for (const auto field : inline_fields) {
+        const auto &type = field->value.type;
+        code_.SetValue("OFFSET", GenFieldOffsetName(*field));
+        code_.SetValue("SIZE", NumToString(InlineSize(type)));
+        code_.SetValue("ALIGN", NumToString(InlineAlignment(type)));
+        code_ += "      { {{OFFSET}}, {{SIZE}}, {{ALIGN}} },";
+      }
+      code_ += "    };";
+    }
     code_ += "    return VerifyTableStart(verifier)\\";
+    if (!inline_fields.empty()) {
+      code_ += " &&\n           VerifyInlineFields(verifier, inline_fields_)\\";
+    }
     for (const auto &field : struct_def.fields.vec) {
       if (field->deprecated) { continue; }
+      if (std::find(inline_fields.begin(), inline_fields.end(), field) !=
+          inline_fields.end()) {
+        continue;
+      }
       GenVerifyCall(*field, " &&\n           ");
     }
 
@@ -2898,8 +3235,12 @@ class CppGenerator : public BaseGenerator {
       code_ += "  " + TableUnPackSignature(struct_def, true, opts_) + ";";
       code_ += "  " + TableUnPackToSignature(struct_def, true, opts_) + ";";
       code_ += "  " + TablePackSignature(struct_def, true, opts_) + ";";
+      code_ += "  " + TablePackedSizeSignature(struct_def, true, opts_) + ";";
     }
 
+    const auto columnar_row = ColumnarRowTable(struct_def);
+    if (columnar_row) { GenColumnarRowDecls(struct_def); }
+
     code_ += "};";  // End of table.
     code_ += "";
 
@@ -2938,6 +3279,8 @@ class CppGenerator : public BaseGenerator {
       }
     }
 
+    if (columnar_row) { GenColumnarRowView(struct_def, *columnar_row); }
+
     GenBuilders(struct_def);
 
     if (opts_.generate_object_based_api) {
@@ -2946,6 +3289,160 @@ class CppGenerator : public BaseGenerator {
       code_ += TableCreateSignature(struct_def, true, opts_) + ";";
       code_ += "";
     }
+
+    if (columnar_row) { GenColumnarFromRows(struct_def, *columnar_row); }
+  }
+
+  // The table a `columnar` companion table was made from, see
+  // Parser::ResolveColumnarFields().
+  const StructDef *ColumnarRowTable(const StructDef &struct_def) const {
+    const auto made_from = struct_def.attributes.Lookup("columnar");
+    if (!made_from || struct_def.fixed) return nullptr;
+    return parser_.structs_.Lookup(made_from->constant);
+  }
+
+  // Generate the row access of a columnar companion table, of the form:
+  // uoffset_t num_rows() const;
+  // NameRow row(uoffset_t _i) const;
+  void GenColumnarRowDecls(const StructDef &struct_def) {
+    code_ += "  /// The number of rows, the length of the longest column.";
+    code_ += "  ::flatbuffers::uoffset_t num_rows() const {";
+    code_ += "    ::flatbuffers::uoffset_t _n = 0;";
+    for (const auto &field : struct_def.fields.vec) {
+      code_.SetValue("FIELD_NAME", Name(*field));
+      code_ +=
+          "    if ({{FIELD_NAME}}() && {{FIELD_NAME}}()->size() > _n) "
+          "_n = {{FIELD_NAME}}()->size();";
+    }
+    code_ += "    return _n;";
+    code_ += "  }";
+    code_ +=
+        "  inline {{STRUCT_NAME}}Row row(::flatbuffers::uoffset_t _i) const;";
+  }
+
+  // Generate a view of one row of a columnar companion table, with the
+  // accessors of the table it was made from. Cells past the end of a shorter
+  // or absent column read as the field's default, as do strings and structs
+  // their presence column marks as absent.
+  void GenColumnarRowView(const StructDef &struct_def,
+                          const StructDef &row_def) {
+    code_ += "/// A row of {{STRUCT_NAME}}, read like a " + Name(row_def) + ".";
+    code_ += "struct {{STRUCT_NAME}}Row {";
+    code_ += "  {{STRUCT_NAME}}Row(const {{STRUCT_NAME}} *_columns, "
+             "::flatbuffers::uoffset_t _i)";
+    code_ += "      : columns_(_columns), i_(_i) {}";
+    for (const auto &field : struct_def.fields.vec) {
+      const auto row_field = row_def.fields.Lookup(field->name);
+      if (!row_field) continue;  // A presence column.
+      const auto &type = row_field->value.type;
+      const auto is_scalar = IsScalar(type.base_type);
+      code_.SetValue("FIELD_NAME", Name(*field));
+      code_.SetValue("FIELD_TYPE", GenTypeGet(type, " ", "const ", " *", true));
+      code_.SetValue("FIELD_VALUE",
+                     GenUnderlyingCast(*row_field, true, "_column->Get(i_)"));
+      code_.SetValue("FIELD_DEFAULT", is_scalar
+                                          ? GetDefaultScalarValue(*row_field,
+                                                                  false)
+                                          : "nullptr");
+      GenComment(row_field->doc_comment, "  ");
+      code_ += "  {{FIELD_TYPE}}{{FIELD_NAME}}() const {";
+      code_ += "    const auto _column = columns_->{{FIELD_NAME}}();";
+      code_ += "    if (!_column || i_ >= _column->size()) "
+               "return {{FIELD_DEFAULT}};";
+      const auto present = struct_def.fields.Lookup(field->name + "_present");
+      if (present) {
+        code_.SetValue("PRESENT_NAME", Name(*present));
+        code_ += "    const auto _present = columns_->{{PRESENT_NAME}}();";
+        code_ += "    if (_present && i_ < _present->size() && "
+                 "!_present->Get(i_)) return nullptr;";
+      }
+      code_ += "    return {{FIELD_VALUE}};";
+      code_ += "  }";
+    }
+    code_ += " private:";
+    code_ += "  const {{STRUCT_NAME}} *columns_;";
+    code_ += "  ::flatbuffers::uoffset_t i_;";
+    code_ += "};";
+    code_ += "";
+    code_ += "inline {{STRUCT_NAME}}Row {{STRUCT_NAME}}::row(";
+    code_ += "    ::flatbuffers::uoffset_t _i) const {";
+    code_ += "  return {{STRUCT_NAME}}Row(this, _i);";
+    code_ += "}";
+    code_ += "";
+  }
+
+  // Generate CreateXFromRows(), which transposes a vector of the table a
+  // columnar companion table was made from into its columns. A presence
+  // column ends at the last row without the field, and is left out when
+  // there is none.
+  void GenColumnarFromRows(const StructDef &struct_def,
+                           const StructDef &row_def) {
+    code_.SetValue("ROW_NAME", WrapInNameSpace(row_def));
+    code_ += "inline ::flatbuffers::Offset<{{STRUCT_NAME}}> "
+             "Create{{STRUCT_NAME}}FromRows(";
+    code_ += "    " + GetBuilder() + " &_fbb,";
+    code_ += "    const ::flatbuffers::Vector<::flatbuffers::Offset<"
+             "{{ROW_NAME}}>> *_rows) {";
+    code_ += "  const size_t _n = _rows ? _rows->size() : 0;";
+    code_ += "  struct _VectorArgs { " + GetBuilder() +
+             " *__fbb; const ::flatbuffers::Vector<::flatbuffers::Offset<"
+             "{{ROW_NAME}}>> *__rows; } _va = { &_fbb, _rows }; (void)_va;";
+    for (const auto &field : struct_def.fields.vec) {
+      const auto row_field = row_def.fields.Lookup(field->name);
+      code_.SetValue("FIELD_NAME", Name(*field));
+      if (!row_field) {
+        // The presence column of the string or struct field before it.
+        const auto present_suffix = std::string("_present");
+        const auto of = row_def.fields.Lookup(field->name.substr(
+            0, field->name.size() - present_suffix.size()));
+        FLATBUFFERS_ASSERT(of);
+        code_.SetValue("OF_NAME", Name(*of));
+        code_ += "  ::flatbuffers::Offset<::flatbuffers::Vector<uint8_t>> "
+                 "{{FIELD_NAME}}__;";
+        code_ += "  for (size_t _end = _n; _end > 0; _end--) {";
+        code_ += "    if (_rows->Get(static_cast<::flatbuffers::uoffset_t>"
+                 "(_end - 1))->{{OF_NAME}}()) continue;";
+        code_ += "    {{FIELD_NAME}}__ = _fbb.CreateVector<uint8_t>(_end,";
+        code_ += "        [](size_t i, _VectorArgs *__va) { return "
+                 "static_cast<uint8_t>(__va->__rows->Get(static_cast<"
+                 "::flatbuffers::uoffset_t>(i))->{{OF_NAME}}() != nullptr); "
+                 "}, &_va);";
+        code_ += "    break;";
+        code_ += "  }";
+        continue;
+      }
+      const auto &type = row_field->value.type;
+      const auto row = "__va->__rows->Get(static_cast<::flatbuffers::uoffset_t>"
+                       "(i))->" + Name(*row_field) + "()";
+      if (IsStruct(type)) {
+        code_.SetValue("TYPE", WrapInNameSpace(*type.struct_def));
+        code_ += "  auto {{FIELD_NAME}}__ = "
+                 "_fbb.CreateVectorOfStructs<{{TYPE}}>(_n,";
+        code_ += "      [](size_t i, {{TYPE}} *__s, _VectorArgs *__va) { "
+                 "const auto __p = " + row + "; *__s = __p ? *__p : "
+                 "{{TYPE}}(); }, &_va);";
+      } else if (IsString(type)) {
+        code_ += "  auto {{FIELD_NAME}}__ = _fbb.CreateVector<"
+                 "::flatbuffers::Offset<::flatbuffers::String>>(_n,";
+        code_ += "      [](size_t i, _VectorArgs *__va) { const auto __p = " +
+                 row + "; return __p ? __va->__fbb->CreateString(__p) : "
+                 "__va->__fbb->CreateString(\"\"); }, &_va);";
+      } else {
+        code_.SetValue("TYPE", GenTypeBasic(type, false));
+        code_ += "  auto {{FIELD_NAME}}__ = _fbb.CreateVector<{{TYPE}}>(_n,";
+        code_ += "      [](size_t i, _VectorArgs *__va) { return " +
+                 GenUnderlyingCast(*row_field, false, row) + "; }, &_va);";
+      }
+    }
+    code_ += "  return Create{{STRUCT_NAME}}(";
+    code_ += "      _fbb\\";
+    for (const auto &field : struct_def.fields.vec) {
+      code_.SetValue("FIELD_NAME", Name(*field));
+      code_ += ",\n      {{FIELD_NAME}}__\\";
+    }
+    code_ += ");";
+    code_ += "}";
+    code_ += "";
   }
 
   // Generate code to force vector alignment. Return empty string for vector
@@ -2970,6 +3467,90 @@ class CppGenerator : public BaseGenerator {
     return "";
   }
 
+  // Generates the body of CreateX() for a `fixed_layout` table. All its
+  // fields are always present, so the table object is laid out here, by
+  // decreasing alignment after the vtable offset, and stored field by field
+  // with a precomputed vtable.
+  void GenFixedLayoutCreate(const StructDef &struct_def) {
+    std::vector<const FieldDef *> fields;
+    for (const auto &field : struct_def.fields.vec) {
+      if (!field->deprecated) { fields.push_back(field); }
+    }
+    const auto field_align = [](const FieldDef *field) {
+      const auto &type = field->value.type;
+      return IsScalar(type.base_type) || IsStruct(type) ? InlineAlignment(type)
+                                                        : sizeof(uoffset_t);
+    };
+    std::stable_sort(fields.begin(), fields.end(),
+                     [&](const FieldDef *a, const FieldDef *b) {
+                       return field_align(a) > field_align(b);
+                     });
+
+    size_t object_size = sizeof(soffset_t);
+    size_t alignment = sizeof(soffset_t);
+    voffset_t vtable_size = FieldIndexToOffset(0);
+    std::vector<size_t> positions;
+    // The last padding, which later (less aligned) fields may fill.
+    size_t gap = 0;
+    size_t gap_end = 0;
+    for (const auto field : fields) {
+      const auto &type = field->value.type;
+      const size_t align = field_align(field);
+      const size_t size = IsScalar(type.base_type) || IsStruct(type)
+                              ? InlineSize(type)
+                              : sizeof(uoffset_t);
+      size_t pos = (gap + align - 1) & ~(align - 1);
+      if (pos + size <= gap_end) {
+        gap = pos + size;
+      } else {
+        pos = (object_size + align - 1) & ~(align - 1);
+        if (pos > object_size) {
+          gap = object_size;
+          gap_end = pos;
+        }
+        object_size = pos + size;
+      }
+      positions.push_back(pos);
+      alignment = (std::max)(alignment, align);
+      vtable_size = (std::max)(
+          vtable_size,
+          static_cast<voffset_t>(field->value.offset + sizeof(voffset_t)));
+    }
+
+    std::vector<size_t> vtable(vtable_size / sizeof(voffset_t), 0);
+    vtable[0] = vtable_size;
+    vtable[1] = object_size;
+    for (size_t i = 0; i < fields.size(); i++) {
+      vtable[fields[i]->value.offset / sizeof(voffset_t)] = positions[i];
+    }
+    std::string vtable_init;
+    for (const auto entry : vtable) {
+      vtable_init += (vtable_init.empty() ? "" : ", ") + NumToString(entry);
+    }
+
+    code_ += "  static const ::flatbuffers::voffset_t vtable_[] = { " +
+             vtable_init + " };";
+    code_ += "  const auto start_ = _fbb.StartFixedTable(" +
+             NumToString(object_size) + ", " + NumToString(alignment) + ");";
+    for (size_t i = 0; i < fields.size(); i++) {
+      const auto &field = *fields[i];
+      const auto &type = field.value.type;
+      const auto args = "(start_, " + NumToString(positions[i]) + ", ";
+      if (IsScalar(type.base_type)) {
+        code_ += "  _fbb.SetFixedField<" +
+                 GenTypeWire(type, "", false, false) + ">" + args +
+                 GenUnderlyingCast(field, false, Name(field)) + ");";
+      } else if (IsStruct(type)) {
+        code_ += "  _fbb.SetFixedStruct" + args + Name(field) + ");";
+      } else {
+        code_ += "  _fbb.SetFixedOffset" + args + Name(field) + ");";
+      }
+    }
+    code_ +=
+        "  return ::flatbuffers::Offset<{{STRUCT_NAME}}>("
+        "_fbb.EndFixedTable(start_, vtable_));";
+  }
+
   void GenBuilders(const StructDef &struct_def) {
     code_.SetValue("STRUCT_NAME", Name(struct_def));
 
@@ -3060,26 +3641,31 @@ class CppGenerator : public BaseGenerator {
     }
     code_ += ") {";
 
-    code_ += "  {{STRUCT_NAME}}Builder builder_(_fbb);";
-    for (size_t size = struct_def.sortbysize ? sizeof(largest_scalar_t) : 1;
-         size; size /= 2) {
-      for (auto it = struct_def.fields.vec.rbegin();
-           it != struct_def.fields.vec.rend(); ++it) {
-        const auto &field = **it;
-        if (!field.deprecated && (!struct_def.sortbysize ||
-                                  size == SizeOf(field.value.type.base_type))) {
-          code_.SetValue("FIELD_NAME", Name(field));
-          if (field.IsScalarOptional()) {
-            code_ +=
-                "  if({{FIELD_NAME}}) { "
-                "builder_.add_{{FIELD_NAME}}(*{{FIELD_NAME}}); }";
-          } else {
-            code_ += "  builder_.add_{{FIELD_NAME}}({{FIELD_NAME}});";
+    if (struct_def.attributes.Lookup("fixed_layout")) {
+      GenFixedLayoutCreate(struct_def);
+    } else {
+      code_ += "  {{STRUCT_NAME}}Builder builder_(_fbb);";
+      for (size_t size = struct_def.sortbysize ? sizeof(largest_scalar_t) : 1;
+           size; size /= 2) {
+        for (auto it = struct_def.fields.vec.rbegin();
+             it != struct_def.fields.vec.rend(); ++it) {
+          const auto &field = **it;
+          if (!field.deprecated &&
+              (!struct_def.sortbysize ||
+               size == SizeOf(field.value.type.base_type))) {
+            code_.SetValue("FIELD_NAME", Name(field));
+            if (field.IsScalarOptional()) {
+              code_ +=
+                  "  if({{FIELD_NAME}}) { "
+                  "builder_.add_{{FIELD_NAME}}(*{{FIELD_NAME}}); }";
+            } else {
+              code_ += "  builder_.add_{{FIELD_NAME}}({{FIELD_NAME}});";
+            }
           }
         }
       }
+      code_ += "  return builder_.Finish();";
     }
-    code_ += "  return builder_.Finish();";
     code_ += "}";
     code_ += "";
 
@@ -3220,11 +3806,20 @@ class CppGenerator : public BaseGenerator {
             return unpack_call;
           } else if (invector || afield.native_inline) {
             return "*" + val;
+          } else if (IsArenaPtr(&afield)) {
+            return "::flatbuffers::ArenaNew<" +
+                   WrapInNameSpace(*type.struct_def) + ">(_arena, *" + val +
+                   ")";
           } else {
             const auto name = WrapInNameSpace(*type.struct_def);
             const auto ptype = GenTypeNativePtr(name, &afield, true);
             return ptype + "(new " + name + "(*" + val + "))";
           }
+        } else if (IsArenaPtr(&afield) && !afield.native_inline) {
+          const auto nn = WrapNativeNameInNameSpace(*type.struct_def, opts_);
+          return GenTypeNativePtr(nn, &afield, true) + "(" + val +
+                 "->UnPack(_resolver, _arena), ::flatbuffers::ArenaDeleter<" +
+                 nn + ">(_arena))";
         } else {
           std::string ptype = afield.native_inline ? "*" : "";
           ptype += GenTypeNativePtr(
@@ -3246,6 +3841,38 @@ class CppGenerator : public BaseGenerator {
     }
   }
 
+  // The arguments passed on to UnPackTo() when unpacking into an existing
+  // object held by `field`.
+  std::string UnPackArgs(const FieldDef &field) {
+    return IsArenaPtr(&field) ? "_resolver, _arena" : "_resolver";
+  }
+
+  // Standard strings and native_inline tables (in vectors) are unpacked into
+  // the existing `out` in place, which reuses its storage when unpacking into
+  // the same object again, and keeps using its memory resource in
+  // --cpp-arena mode. Returns the statement doing so, or "" for other types.
+  std::string GenUnpackInPlace(const FieldDef &field, const Type &type,
+                               const std::string &val, const std::string &out) {
+    if (type.base_type == BASE_TYPE_STRING &&
+        (NativeString(&field) == "std::string" ||
+         NativeString(&field) == "std::pmr::string")) {
+      return out + ".assign(" + val + "->c_str(), " + val + "->size());";
+    } else if (IsTable(type) && field.native_inline) {
+      return val + "->UnPackTo(&" + out + ", _resolver" +
+             (opts_.cpp_object_api_arena ? ", _arena" : "") + ");";
+    }
+    return "";
+  }
+
+  // Returns true if the object API holds `field`, a struct, through a smart
+  // pointer whose struct can be assigned to instead of allocating a new one.
+  bool IsReusableStructPtr(const FieldDef &field) {
+    const auto &type = field.value.type;
+    return IsStruct(type) && !field.native_inline &&
+           !type.struct_def->attributes.Lookup("native_type") &&
+           PtrType(&field) != "naked";
+  }
+
   std::string GenUnpackFieldStatement(const FieldDef &field,
                                       const FieldDef *union_field) {
     std::string code;
@@ -3265,8 +3892,8 @@ class CppGenerator : public BaseGenerator {
           //  - enum types because they have to be explicitly static_cast.
           //  - vectors of bool, since they are a template specialization.
           //  - multiple-byte types due to endianness.
-          code +=
-              "std::copy(_e->begin(), _e->end(), _o->" + name + ".begin()); }";
+          code += "std::copy(_e->begin(), _e->end(), _o->" + name +
+                  ".begin()); } else { " + vector_field + ".resize(0); }";
         } else {
           std::string indexing;
           if (field.value.type.enum_def) {
@@ -3318,16 +3945,30 @@ class CppGenerator : public BaseGenerator {
             }
           } else {
             const bool is_pointer = IsVectorOfPointers(field);
+            const auto elem = "_o->" + name + "[_i]" + access;
             if (is_pointer) {
               code += "if(_o->" + name + "[_i]" + ") { ";
-              code += indexing + "->UnPackTo(_o->" + name +
-                      "[_i].get(), _resolver);";
+              code += indexing + "->UnPackTo(_o->" + name + "[_i].get(), " +
+                      UnPackArgs(field) + ");";
               code += " } else { ";
             }
-            code += "_o->" + name + "[_i]" + access + " = ";
-            code += GenUnpackVal(field.value.type.VectorType(), indexing, true,
-                                 field);
-            code += "; ";
+            const auto in_place = GenUnpackInPlace(
+                field, field.value.type.VectorType(), indexing, elem);
+            if (field.value.type.element == BASE_TYPE_UTYPE) {
+              // Keep the union value if its type is unchanged, so the union
+              // vector below can unpack into it.
+              code += "if (" + elem + " != " + indexing + ") { _o->" + name +
+                      "[_i].Reset(); " + elem + " = " + indexing + "; } ";
+            } else if (field.value.type.element == BASE_TYPE_UNION) {
+              code += "_o->" + name + "[_i].UnPackTo(_e->Get(_i), _resolver); ";
+            } else if (!in_place.empty()) {
+              code += in_place + " ";
+            } else {
+              code += elem + " = ";
+              code += GenUnpackVal(field.value.type.VectorType(), indexing,
+                                   true, field);
+              code += "; ";
+            }
             if (is_pointer) { code += "} "; }
           }
           code += "} } else { " + vector_field + ".resize(0); }";
@@ -3337,17 +3978,20 @@ class CppGenerator : public BaseGenerator {
       case BASE_TYPE_UTYPE: {
         FLATBUFFERS_ASSERT(union_field->value.type.base_type ==
                            BASE_TYPE_UNION);
-        // Generate code that sets the union type, of the form:
-        //   _o->field.type = _e;
-        code += "_o->" + union_field->name + ".type = _e;";
+        // Generate code that sets the union type, keeping the value if the
+        // type is unchanged so it can be reused, of the form:
+        //   if (_o->field.type != _e) {
+        //     _o->field.Reset(); _o->field.type = _e;
+        //   }
+        const auto out_field = "_o->" + union_field->name;
+        code += "if (" + out_field + ".type != _e) { " + out_field +
+                ".Reset(); " + out_field + ".type = _e; }";
         break;
       }
       case BASE_TYPE_UNION: {
         // Generate code that sets the union value, of the form:
-        //   _o->field.value = Union::Unpack(_e, field_type(), resolver);
-        code += "_o->" + Name(field) + ".value = ";
-        code += GenUnionUnpackVal(field, "", "");
-        code += ";";
+        //   _o->field.UnPackTo(_e, resolver);
+        code += "_o->" + Name(field) + ".UnPackTo(_e, _resolver);";
         break;
       }
       default: {
@@ -3375,20 +4019,29 @@ class CppGenerator : public BaseGenerator {
         } else {
           // Generate code for assigning the value, of the form:
           //  _o->field = value;
-          const bool is_pointer = IsPointer(field);
-
+          // Tables and structs held by pointer, and strings, are unpacked into
+          // the existing ones if any, and reset or cleared if absent.
           const std::string out_field = "_o->" + Name(field);
-
-          if (is_pointer) {
+          const auto in_place =
+              GenUnpackInPlace(field, field.value.type, "_e", out_field);
+          if (IsPointer(field) || IsReusableStructPtr(field)) {
             code += "{ if(" + out_field + ") { ";
-            code += "_e->UnPackTo(" + out_field + ".get(), _resolver);";
+            if (IsPointer(field)) {
+              code += "_e->UnPackTo(" + out_field + ".get(), " +
+                      UnPackArgs(field) + ");";
+            } else {
+              code += "*" + out_field + " = *_e;";
+            }
             code += " } else { ";
-          }
-          code += out_field + " = ";
-          code += GenUnpackVal(field.value.type, "_e", false, field) + ";";
-          if (is_pointer) {
+            code += out_field + " = ";
+            code += GenUnpackVal(field.value.type, "_e", false, field) + ";";
             code += " } } else if (" + out_field + ") { " + out_field +
                     ".reset(); }";
+          } else if (!in_place.empty()) {
+            code += "{ " + in_place + " } else { " + out_field + ".clear(); }";
+          } else {
+            code += out_field + " = ";
+            code += GenUnpackVal(field.value.type, "_e", false, field) + ";";
           }
         }
         break;
@@ -3630,6 +4283,115 @@ class CppGenerator : public BaseGenerator {
     return code;
   }
 
+  // Returns the code adding the PackedSize() of each element of vector
+  // `value` to `_s`.
+  std::string GenPackedSizeLoop(const std::string &value,
+                                const std::string &elem_size) {
+    return "  for (size_t _i = 0; _i < " + value + ".size(); _i++) _s += " +
+           elem_size + ";";
+  }
+
+  // Generates X::PackedSize(), an upper bound of the bytes packing an object
+  // into a builder takes, so Pack() can make room for all of it at once.
+  void GenPackedSize(const StructDef &struct_def) {
+    size_t num_fields = 0;
+    size_t field_bytes = 0;
+    std::vector<std::string> lines;
+    for (const auto &field : struct_def.fields.vec) {
+      if (field->deprecated) { continue; }
+      const auto &type = field->value.type;
+      const bool is_offset = !IsScalar(type.base_type) && !IsStruct(type);
+      size_t size = InlineSize(type);
+      size_t align = InlineAlignment(type);
+      if (is_offset) {
+        size = align = field->offset64 || type.base_type == BASE_TYPE_VECTOR64
+                           ? sizeof(uoffset64_t)
+                           : sizeof(uoffset_t);
+      }
+      num_fields++;
+      field_bytes += size + align - 1;
+
+      const auto value = "_o." + Name(*field);
+      switch (type.base_type) {
+        case BASE_TYPE_STRING: {
+          lines.push_back("  _s += ::flatbuffers::PackedStringSize(" + value +
+                          ".length());");
+          break;
+        }
+        case BASE_TYPE_UNION: {
+          lines.push_back("  _s += " + value + ".PackedSize();");
+          break;
+        }
+        case BASE_TYPE_STRUCT: {
+          if (IsStruct(type)) { break; }
+          const auto packed_size =
+              WrapInNameSpace(*type.struct_def) + "::PackedSize(";
+          if (field->native_inline) {
+            lines.push_back("  _s += " + packed_size + value + ");");
+          } else {
+            lines.push_back("  if (" + value + ") _s += " + packed_size + "*" +
+                            value + GenPtrGet(*field) + ");");
+          }
+          break;
+        }
+        case BASE_TYPE_VECTOR64:
+        case BASE_TYPE_VECTOR: {
+          const auto vector_type = type.VectorType();
+          if (vector_type.base_type == BASE_TYPE_UTYPE) {
+            // The object holds the types in the union vector.
+            const auto union_value = "_o." + StripUnionType(Name(*field));
+            lines.push_back("  _s += ::flatbuffers::PackedVectorSize(" +
+                            union_value + ".size(), 1, 1);");
+            break;
+          }
+          if (IsString(vector_type) || IsTable(vector_type) ||
+              IsUnion(vector_type)) {
+            lines.push_back("  _s += ::flatbuffers::PackedOffsetVectorSize(" +
+                            value + ".size());");
+            const auto elem = value + "[_i]";
+            if (IsString(vector_type)) {
+              lines.push_back(GenPackedSizeLoop(
+                  value,
+                  "::flatbuffers::PackedStringSize(" + elem + ".length())"));
+            } else if (IsUnion(vector_type)) {
+              lines.push_back(GenPackedSizeLoop(value, elem + ".PackedSize()"));
+            } else {
+              lines.push_back(GenPackedSizeLoop(
+                  value, WrapInNameSpace(*vector_type.struct_def) +
+                             "::PackedSize(" +
+                             (field->native_inline
+                                  ? elem
+                                  : "*" + elem + GenPtrGet(*field)) +
+                             ")"));
+            }
+            break;
+          }
+          const auto *force_align = field->attributes.Lookup("force_align");
+          const size_t align =
+              (std::max)(InlineAlignment(vector_type),
+                         force_align ? static_cast<size_t>(atoi(
+                                           force_align->constant.c_str()))
+                                     : size_t(1));
+          lines.push_back("  _s += ::flatbuffers::PackedVectorSize(" + value +
+                          ".size(), " + NumToString(InlineSize(vector_type)) +
+                          ", " + NumToString(align) + ");");
+          break;
+        }
+        default: break;
+      }
+    }
+
+    code_ += "inline " + TablePackedSizeSignature(struct_def, false, opts_) +
+             " {";
+    code_ += "  (void)_o;";
+    code_ += "  size_t _s = ::flatbuffers::PackedTableSize(" +
+             NumToString(num_fields) + ", " + NumToString(field_bytes) + ");";
+    for (const auto &line : lines) { code_ += line; }
+    code_ += "  return _s;";
+    code_ += "}";
+    code_ += "";
+  }
+
   // Generate code for tables that needs to come after the regular definition.
   void GenTablePost(const StructDef &struct_def) {
     if (opts_.generate_object_based_api) { GenNativeTablePost(struct_def); }
@@ -3646,7 +4408,10 @@ class CppGenerator : public BaseGenerator {
       code_ +=
           "inline " + TableUnPackSignature(struct_def, false, opts_) + " {";
 
-      if (opts_.g_cpp_std == cpp::CPP_STD_X0) {
+      if (opts_.cpp_object_api_arena) {
+        code_ +=
+            "  auto _o = ::flatbuffers::ArenaNew<{{NATIVE_NAME}}>(_arena);";
+      } else if (opts_.g_cpp_std == cpp::CPP_STD_X0) {
         auto native_name = WrapNativeNameInNameSpace(struct_def, parser_.opts);
         code_.SetValue("POINTER_TYPE",
                        GenTypeNativePtr(native_name, nullptr, false));
@@ -3659,7 +4424,9 @@ class CppGenerator : public BaseGenerator {
       } else {
         code_ += "  auto _o = std::make_unique<{{NATIVE_NAME}}>();";
       }
-      code_ += "  UnPackTo(_o.get(), _resolver);";
+      code_ += opts_.cpp_object_api_arena
+                   ? "  UnPackTo(_o.get(), _resolver, _arena);"
+                   : "  UnPackTo(_o.get(), _resolver);";
       code_ += "  return _o.release();";
       code_ += "}";
       code_ += "";
@@ -3667,6 +4434,7 @@ class CppGenerator : public BaseGenerator {
           "inline " + TableUnPackToSignature(struct_def, false, opts_) + " {";
       code_ += "  (void)_o;";
       code_ += "  (void)_resolver;";
+      if (opts_.cpp_object_api_arena) { code_ += "  (void)_arena;"; }
 
       for (auto it = struct_def.fields.vec.begin();
            it != struct_def.fields.vec.end(); ++it) {
@@ -3689,13 +4457,17 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
-      // Generate the X::Pack member function that simply calls the global
-      // CreateX function.
+      // Generate the X::Pack member function that calls the global CreateX
+      // function, after growing the buffer once to fit the whole object.
       code_ += "inline " + TablePackSignature(struct_def, false, opts_) + " {";
+      code_ +=
+          "  _fbb.Reserve(::flatbuffers::PackedBufferSize(PackedSize(*_o)));";
       code_ += "  return Create{{STRUCT_NAME}}(_fbb, _o, _rehasher);";
       code_ += "}";
       code_ += "";
 
+      GenPackedSize(struct_def);
+
       // Generate a CreateX method that works with an unpacked C++ object.
       code_ +=
           "inline " + TableCreateSignature(struct_def, false, opts_) + " {";
@@ -3928,6 +4700,35 @@ class CppGenerator : public BaseGenerator {
     code_ += "  }";
   }
 
+  // Generate struct-of-arrays helpers for each scalar field, of the form:
+  // static size_t gather_name(const Vector<const T *> *, span<type>);
+  // static size_t scatter_name(span<const type>, span<T>);
+  void GenStructColumnAccessors(const StructDef &struct_def) {
+    code_.SetValue("STRUCT_NAME", Name(struct_def));
+    for (const auto &field : struct_def.fields.vec) {
+      const auto &type = field->value.type;
+      if (!IsScalar(type.base_type)) continue;
+      code_.SetValue("FIELD_NAME", Name(*field));
+      code_.SetValue("COLUMN_TYPE", GenTypeBasic(type, true));
+      code_.SetValue("WIRE_TYPE", GenTypeBasic(type, false));
+      code_.SetValue("FIELD_OFFSET", NumToString(field->value.offset));
+
+      code_ += "  static size_t gather_{{FIELD_NAME}}(";
+      code_ += "      const ::flatbuffers::Vector<const {{STRUCT_NAME}} *> "
+               "*_structs,";
+      code_ += "      ::flatbuffers::span<{{COLUMN_TYPE}}> _column) {";
+      code_ += "    return ::flatbuffers::GatherStructField<{{WIRE_TYPE}}>(";
+      code_ += "        _structs, {{FIELD_OFFSET}}, _column);";
+      code_ += "  }";
+      code_ += "  static size_t scatter_{{FIELD_NAME}}(";
+      code_ += "      ::flatbuffers::span<const {{COLUMN_TYPE}}> _column,";
+      code_ += "      ::flatbuffers::span<{{STRUCT_NAME}}> _structs) {";
+      code_ += "    return ::flatbuffers::ScatterStructField<{{WIRE_TYPE}}>(";
+      code_ += "        _column, {{FIELD_OFFSET}}, _structs);";
+      code_ += "  }";
+    }
+  }
+
   // Generate an accessor struct with constructor for a flatbuffers struct.
   void GenStruct(const StructDef &struct_def) {
     // Generate an accessor struct, with private variables of the form:
@@ -4047,6 +4848,7 @@ class CppGenerator : public BaseGenerator {
       // Generate a comparison function for this field if it is a key.
       if (field->key) { GenKeyFieldMethods(*field); }
     }
+    if (opts_.cpp_struct_columns) GenStructColumnAccessors(struct_def);
     code_.SetValue("NATIVE_NAME", Name(struct_def));
     GenOperatorNewDelete(struct_def);
 
@@ -4141,6 +4943,22 @@ static bool GenerateCPP(const Parser &parser, const std::string &path,
     return false;
   }
 
+  if (opts.cpp_object_api_arena) {
+    if (opts.g_cpp_std < cpp::CPP_STD_17) {
+      LogCompilerError(
+          "--cpp-arena requires using --cpp-std at \"C++17\" or higher.");
+      return false;
+    }
+    // Hold sub-objects in pointers that know which resource they came from,
+    // and make strings allocator-aware, unless asked for other types.
+    if (opts.cpp_object_api_pointer_type == "std::unique_ptr") {
+      opts.cpp_object_api_pointer_type = "::flatbuffers::arena_ptr";
+    }
+    if (opts.cpp_object_api_string_type.empty()) {
+      opts.cpp_object_api_string_type = "std::pmr::string";
+    }
+  }
+
   cpp::CppGenerator generator(parser, path, file_name, opts);
   return generator.generate();
 }
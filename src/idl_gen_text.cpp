@@ -18,6 +18,7 @@
 #include "idl_gen_text.h"
 
 #include <algorithm>
+#include <clocale>
 
 #include "flatbuffers/base.h"
 #include "flatbuffers/code_generator.h"
@@ -96,10 +97,70 @@ struct JsonPrinter {
       // print as numeric value
     }
 
-    text += NumToString(val);
+    AppendNumber(val);
     return;
   }
 
+  // Number formatting that appends straight into `text`, instead of building
+  // a temporary std::string per value through NumToString.
+  template<typename T> void AppendNumber(T val) { AppendInteger(val, &text); }
+
+  void AppendNumber(float val) { AppendFloat(val, 6); }
+
+  void AppendNumber(double val) { AppendFloat(val, 12); }
+
+  // Floats print exactly like FloatToString(val, precision) by default. With
+  // `json_shortest_floats` they instead use the fewest significant digits that
+  // parse back to the same value.
+  template<typename T> void AppendFloat(T val, int precision) {
+    if (!opts.json_shortest_floats || !std::isfinite(val)) {
+      flatbuffers::AppendFloat(val, precision, &text);
+      return;
+    }
+    char buf[64];
+    const int len = FormatShortest(val, buf, sizeof(buf));
+    if (len <= 0 || len >= static_cast<int>(sizeof(buf))) {
+      text += FloatToString(val, precision);
+      return;
+    }
+    // snprintf follows the C locale, the output must not.
+    if (decimal_point != '.') std::replace(buf, buf + len, decimal_point, '.');
+    text.append(buf, static_cast<size_t>(len));
+  }
+
+  static int FormatShortest(float val, char *buf, size_t size) {
+    // Any decimal with 6 significant digits survives a trip through float, so
+    // start there and stop at 9, which always round-trips.
+    int len = -1;
+    for (int digits = 6; digits <= 9; digits++) {
+      len = snprintf(buf, size, "%.*g", digits, static_cast<double>(val));
+      if (digits == 9 || strtof(buf, nullptr) == val) break;
+    }
+    return AddFractionMarker(buf, len, size);
+  }
+
+  static int FormatShortest(double val, char *buf, size_t size) {
+    int len = -1;
+    for (int digits = 15; digits <= 17; digits++) {
+      len = snprintf(buf, size, "%.*g", digits, val);
+      if (digits == 17 || strtod(buf, nullptr) == val) break;
+    }
+    return AddFractionMarker(buf, len, size);
+  }
+
+  // "%g" prints whole numbers without a fraction, append ".0" so the value
+  // reads back as a float, like the fixed precision output does.
+  static int AddFractionMarker(char *buf, int len, size_t size) {
+    if (len <= 0 || static_cast<size_t>(len) + 2 >= size) return len;
+    for (int i = 0; i < len; i++) {
+      if (!is_digit(buf[i]) && buf[i] != '-') return len;
+    }
+    buf[len++] = '.';
+    buf[len++] = '0';
+    buf[len] = 0;
+    return len;
+  }
+
   void AddComma() {
     if (!opts.protobuf_ascii_alike) text += ',';
   }
@@ -136,7 +197,29 @@ struct JsonPrinter {
     const auto elem_indent = indent + Indent();
     text += '[';
     AddNewLine();
-    for (SizeT i = 0; i < size; i++) {
+    if (!is_struct && executor && num_chunks > 1 &&
+        size >= min_parallel_elements) {
+      auto err = PrintElementsParallel(c, size, type, elem_indent, prev_val);
+      if (err) return err;
+    } else {
+      auto err =
+          PrintElements(c, SizeT(0), size, type, elem_indent, prev_val);
+      if (err) return err;
+    }
+    AddNewLine();
+    AddIndent(indent);
+    text += ']';
+    return nullptr;
+  }
+
+  // Print elements [begin, end) of a vector of non-scalar values, each
+  // preceded by the separator that a full loop from 0 would put before it.
+  template<typename Container, typename SizeT>
+  const char *PrintElements(const Container &c, SizeT begin, SizeT end,
+                            const Type &type, int elem_indent,
+                            const uint8_t *prev_val) {
+    const auto is_struct = IsStruct(type);
+    for (SizeT i = begin; i < end; i++) {
       if (i) {
         AddComma();
         AddNewLine();
@@ -149,9 +232,35 @@ struct JsonPrinter {
                              static_cast<soffset_t>(i));
       if (err) return err;
     }
-    AddNewLine();
-    AddIndent(indent);
-    text += ']';
+    return nullptr;
+  }
+
+  // Splits a large vector of tables (or unions / strings) into chunks, renders
+  // each into its own buffer through the executor, and appends them in order.
+  // Chunks print their elements without an executor, so nested vectors don't
+  // fan out further.
+  template<typename Container, typename SizeT>
+  const char *PrintElementsParallel(const Container &c, SizeT size,
+                                    const Type &type, int elem_indent,
+                                    const uint8_t *prev_val) {
+    const auto chunks = static_cast<SizeT>(std::min<size_t>(num_chunks, size));
+    std::vector<std::string> chunk_text(chunks);
+    std::vector<const char *> chunk_err(chunks, nullptr);
+    (*executor)(chunks, [&](size_t chunk) {
+      const auto begin = static_cast<SizeT>(size * chunk / chunks);
+      const auto end = static_cast<SizeT>(size * (chunk + 1) / chunks);
+      JsonPrinter printer(opts, chunk_text[chunk]);
+      chunk_err[chunk] =
+          printer.PrintElements(c, begin, end, type, elem_indent, prev_val);
+    });
+    size_t total = 0;
+    for (auto &chunk : chunk_text) total += chunk.size();
+    text.reserve(text.size() + total);
+    for (SizeT chunk = 0; chunk < chunks; chunk++) {
+      // Report the first error in output order, like the serial loop would.
+      if (chunk_err[chunk]) return chunk_err[chunk];
+      text += chunk_text[chunk];
+    }
     return nullptr;
   }
 
@@ -364,19 +473,37 @@ struct JsonPrinter {
     return nullptr;
   }
 
-  JsonPrinter(const Parser &parser, std::string &dest)
-      : opts(parser.opts), text(dest) {
+  JsonPrinter(const IDLOptions &options, std::string &dest,
+              const TextExecutor *text_executor = nullptr,
+              size_t chunk_count = 0, size_t min_parallel = 0)
+      : opts(options),
+        text(dest),
+        decimal_point('.'),
+        executor(text_executor),
+        num_chunks(chunk_count),
+        min_parallel_elements(min_parallel) {
     text.reserve(1024);  // Reduce amount of inevitable reallocs.
+    auto lc = localeconv();
+    if (lc && lc->decimal_point && lc->decimal_point[0] &&
+        !lc->decimal_point[1]) {
+      decimal_point = lc->decimal_point[0];
+    }
   }
 
   const IDLOptions &opts;
   std::string &text;
+  char decimal_point;
+  const TextExecutor *executor;
+  size_t num_chunks;
+  size_t min_parallel_elements;
 };
 
-static const char *GenerateTextImpl(const Parser &parser, const Table *table,
-                                    const StructDef &struct_def,
-                                    std::string *_text) {
-  JsonPrinter printer(parser, *_text);
+static const char *GenerateTextImpl(
+    const Parser &parser, const Table *table, const StructDef &struct_def,
+    std::string *_text, const TextExecutor *executor = nullptr,
+    size_t num_chunks = 0, size_t min_parallel_elements = 0) {
+  JsonPrinter printer(parser.opts, *_text, executor, num_chunks,
+                      min_parallel_elements);
   auto err = printer.GenStruct(struct_def, table, 0);
   if (err) return err;
   printer.AddNewLine();
@@ -415,6 +542,18 @@ const char *GenText(const Parser &parser, const void *flatbuffer,
   return GenerateTextImpl(parser, root, *parser.root_struct_def_, _text);
 }
 
+// Generate a text representation of a flatbuffer in JSON format, rendering
+// large vectors of tables in chunks through `executor`.
+const char *GenTextParallel(const Parser &parser, const void *flatbuffer,
+                            std::string *_text, const TextExecutor &executor,
+                            size_t num_chunks, size_t min_parallel_elements) {
+  FLATBUFFERS_ASSERT(parser.root_struct_def_);  // call SetRootType()
+  auto root = parser.opts.size_prefixed ? GetSizePrefixedRoot<Table>(flatbuffer)
+                                        : GetRoot<Table>(flatbuffer);
+  return GenerateTextImpl(parser, root, *parser.root_struct_def_, _text,
+                          &executor, num_chunks, min_parallel_elements);
+}
+
 static std::string TextFileName(const std::string &path,
                                 const std::string &file_name) {
   return path + file_name + ".json";
@@ -436,9 +575,17 @@ const char *GenTextFile(const Parser &parser, const std::string &path,
                ? nullptr
                : "SaveFile failed";
   }
-  if (!parser.builder_.GetSize() || !parser.root_struct_def_) return nullptr;
+  if (!parser.builder_.GetSize()) return nullptr;
+  return GenTextFile(parser, parser.builder_.GetBufferPointer(),
+                     parser.builder_.GetSize(), path, file_name);
+}
+
+const char *GenTextFile(const Parser &parser, const void *flatbuffer,
+                        size_t size, const std::string &path,
+                        const std::string &file_name) {
+  if (!size || !parser.root_struct_def_) return nullptr;
   std::string text;
-  auto err = GenText(parser, parser.builder_.GetBufferPointer(), &text);
+  auto err = GenText(parser, flatbuffer, &text);
   if (err) return err;
   return flatbuffers::SaveFile(TextFileName(path, file_name).c_str(), text,
                                false)
@@ -0,0 +1,917 @@
+/*
+ * Copyright 2024 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Fast path for Parser::ParseJson, see JsonTableParser in idl.h.
+// Every function here returns false on anything it isn't sure it handles
+// exactly like idl_parser.cpp, which then gets to parse (and report errors
+// for) the document instead.
+
+#include <cmath>
+#include <cstring>
+
+#include "flatbuffers/base.h"
+#include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/idl.h"
+#include "flatbuffers/util.h"
+
+namespace flatbuffers {
+
+static bool IsIdentStart(char c) { return is_alpha(c) || c == '_'; }
+
+static bool IsIdentChar(char c) { return IsIdentStart(c) || is_digit(c); }
+
+static bool Equals(const char *s, size_t len, const char *literal) {
+  return strlen(literal) == len && memcmp(s, literal, len) == 0;
+}
+
+// Scalars are kept as the bits of their C++ type while a table is parsed.
+template<typename T> static uint64_t ToBits(T val) {
+  uint64_t bits = 0;
+  memcpy(&bits, &val, sizeof(T));
+  return bits;
+}
+
+template<typename T> static T FromBits(uint64_t bits) {
+  T val;
+  memcpy(&val, &bits, sizeof(T));
+  return val;
+}
+
+// Returns the end of the JSON number starting at `p`, or nullptr if there is
+// none. Hex, inf, nan and friends are left to idl_parser.cpp.
+static const char *ScanNumber(const char *p) {
+  if (*p == '-') p++;
+  if (!is_digit(*p)) return nullptr;
+  while (is_digit(*p)) p++;
+  if (*p == '.') {
+    if (!is_digit(*++p)) return nullptr;
+    while (is_digit(*p)) p++;
+  }
+  if (*p == 'e' || *p == 'E') {
+    p++;
+    if (*p == '+' || *p == '-') p++;
+    if (!is_digit(*p)) return nullptr;
+    while (is_digit(*p)) p++;
+  }
+  return p;
+}
+
+// Exact conversion of a decimal integer below 10^18, false where
+// StringToNumber has to decide (-0.0, out of range).
+template<typename T>
+static bool IntegerToNumber(uint64_t u, bool neg, T *val,
+                            bool_constant<true>) {
+  if (neg && !u) return false;
+  *val = neg ? -static_cast<T>(u) : static_cast<T>(u);
+  return true;
+}
+
+template<typename T>
+static bool IntegerToNumber(uint64_t u, bool neg, T *val,
+                            bool_constant<false>) {
+  if (neg && u && flatbuffers::is_unsigned<T>::value) return false;
+  const int64_t i = neg ? -static_cast<int64_t>(u) : static_cast<int64_t>(u);
+  if (i < static_cast<int64_t>(flatbuffers::numeric_limits<T>::lowest()) ||
+      (i > 0 && static_cast<uint64_t>(i) >
+                    static_cast<uint64_t>(
+                        (flatbuffers::numeric_limits<T>::max)()))) {
+    return false;
+  }
+  *val = static_cast<T>(i);
+  return true;
+}
+
+template<typename T> static void NormalizeNaN(T *val, bool_constant<true>) {
+  *val = (*val != *val) ? std::fabs(*val) : *val;
+}
+
+template<typename T> static void NormalizeNaN(T *, bool_constant<false>) {}
+
+// Same result as atot() in idl_parser.cpp for the numbers ScanNumber accepts.
+template<typename T>
+static bool TextToNumber(const char *text, size_t len, T *val) {
+  typedef bool_constant<flatbuffers::is_floating_point<T>::value> is_float;
+  const bool neg = len && *text == '-';
+  const char *p = text + neg;
+  const char *const end = text + len;
+  if (p < end && end - p <= 18) {
+    uint64_t u = 0;
+    for (; p < end && is_digit(*p); p++) u = u * 10 + (*p - '0');
+    if (p == end && IntegerToNumber(u, neg, val, is_float())) return true;
+  }
+  char buf[64];
+  if (len >= sizeof(buf)) return false;
+  memcpy(buf, text, len);
+  buf[len] = '\0';
+  if (!StringToNumber(buf, val)) return false;
+  NormalizeNaN(val, is_float());
+  return true;
+}
+
+static bool TextToScalar(BaseType type, const char *text, size_t len,
+                         uint64_t *bits) {
+  switch (type) {
+    // clang-format off
+    #define FLATBUFFERS_TD(ENUM, IDLTYPE, CTYPE, ...) \
+      case BASE_TYPE_ ## ENUM: { \
+        CTYPE val; \
+        if (!TextToNumber(text, len, &val)) return false; \
+        *bits = ToBits(val); \
+        return true; \
+      }
+      FLATBUFFERS_GEN_TYPES_SCALAR(FLATBUFFERS_TD)
+    #undef FLATBUFFERS_TD
+    // clang-format on
+    default: return false;
+  }
+}
+
+// Stores a scalar the way it appears in a buffer.
+static void WriteScalarBits(BaseType type, uint64_t bits, uint8_t *dest) {
+  switch (type) {
+    // clang-format off
+    #define FLATBUFFERS_TD(ENUM, IDLTYPE, CTYPE, ...) \
+      case BASE_TYPE_ ## ENUM: \
+        WriteScalar(dest, FromBits<CTYPE>(bits)); \
+        break;
+      FLATBUFFERS_GEN_TYPES_SCALAR(FLATBUFFERS_TD)
+    #undef FLATBUFFERS_TD
+    // clang-format on
+    default: FLATBUFFERS_ASSERT(0);
+  }
+}
+
+static uint32_t HashName(uint32_t seed, const char *name, size_t len) {
+  uint32_t hash = 2166136261u ^ (seed * 0x9E3779B9u);
+  for (size_t i = 0; i < len; i++) {
+    hash ^= static_cast<uint8_t>(name[i]);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+JsonTableParser::JsonTableParser(Parser &parser)
+    : parser_(parser), cursor_(nullptr), depth_(0), used_fallback_(false) {}
+
+bool JsonTableParser::Parse(const char *json, const char *json_filename) {
+  used_fallback_ = false;
+  if (parser_.root_struct_def_ && !parser_.opts.protobuf_ascii_alike) {
+    parser_.builder_.Clear();
+    fields_.clear();
+    scratch_.clear();
+    depth_ = parser_.parse_depth_counter_;
+    if (ParseDocument(json)) {
+      parser_.file_being_parsed_ = json_filename ? json_filename : "";
+      parser_.error_.clear();
+      return true;
+    }
+  }
+  used_fallback_ = true;
+  return parser_.ParseJson(json, json_filename);
+}
+
+JsonTableParser::TableInfo *JsonTableParser::GetTableInfo(
+    const StructDef &struct_def) {
+  auto it = tables_.find(&struct_def);
+  if (it != tables_.end()) return &it->second;
+  // Registered before looking at the fields, so recursive types terminate.
+  auto &info = tables_[&struct_def];
+  info.struct_def = &struct_def;
+  info.seed = 0;
+  info.mask = 0;
+  info.supported = true;
+  const auto &fields = struct_def.fields.vec;
+  if (struct_def.fixed && fields.size() > 64) {
+    info.supported = false;
+    return &info;
+  }
+
+  std::vector<FieldSlot> slots;
+  for (size_t i = 0; i < fields.size(); i++) {
+    const FieldDef &field = *fields[i];
+    const Type &type = field.value.type;
+    FieldSlot slot = {};
+    slot.field = &field;
+    slot.index = i;
+    auto hash = field.attributes.Lookup("hash");
+    if (hash) slot.hash = hash->constant.c_str();
+    slot.supported = !field.flexbuffer && !field.nested_flatbuffer &&
+                     !field.offset64 && type.base_type != BASE_TYPE_VECTOR64 &&
+                     (type.base_type != BASE_TYPE_ARRAY || struct_def.fixed);
+    if (type.struct_def && (type.base_type == BASE_TYPE_STRUCT ||
+                            type.element == BASE_TYPE_STRUCT)) {
+      slot.child = GetTableInfo(*type.struct_def);
+    }
+    if (type.base_type == BASE_TYPE_VECTOR) {
+      if (type.element == BASE_TYPE_UNION) slot.supported = false;
+      auto force_align = field.attributes.Lookup("force_align");
+      if (force_align &&
+          (!StringToNumber(force_align->constant.c_str(), &slot.force_align) ||
+           !VerifyAlignmentRequirements(slot.force_align))) {
+        slot.supported = false;
+      }
+    }
+    if (IsScalar(type.base_type) && !field.IsScalarOptional()) {
+      const auto &constant = field.value.constant;
+      if (!TextToScalar(type.base_type, constant.c_str(), constant.size(),
+                        &slot.default_bits)) {
+        slot.supported = false;
+      }
+    }
+    if (field.IsRequired()) info.required.push_back(&field);
+    slots.push_back(slot);
+  }
+
+  // Find a seed that gives every field name its own slot.
+  uint32_t size = 8;
+  while (size < 2 * slots.size()) size *= 2;
+  for (;;) {
+    for (uint32_t seed = 0; seed < 32; seed++) {
+      std::vector<FieldSlot> table(size);
+      bool collision = false;
+      for (auto s = slots.begin(); s != slots.end() && !collision; ++s) {
+        const auto &name = s->field->name;
+        auto &entry = table[HashName(seed, name.c_str(), name.size()) &
+                            (size - 1)];
+        collision = entry.field != nullptr;
+        entry = *s;
+      }
+      if (!collision) {
+        info.slots.swap(table);
+        info.seed = seed;
+        info.mask = size - 1;
+        return &info;
+      }
+    }
+    if (size >= (1u << 16)) break;
+    size *= 2;
+  }
+  info.supported = false;
+  return &info;
+}
+
+const JsonTableParser::FieldSlot *JsonTableParser::LookupField(
+    const TableInfo &info, const char *name, size_t len) const {
+  const auto &slot = info.slots[HashName(info.seed, name, len) & info.mask];
+  if (slot.field && slot.field->name.size() == len &&
+      memcmp(slot.field->name.c_str(), name, len) == 0) {
+    return &slot;
+  }
+  return nullptr;
+}
+
+bool JsonTableParser::ParseDocument(const char *json) {
+  cursor_ = json;
+  if (static_cast<unsigned char>(*cursor_) == 0xef) {
+    if (static_cast<unsigned char>(cursor_[1]) != 0xbb ||
+        static_cast<unsigned char>(cursor_[2]) != 0xbf) {
+      return false;
+    }
+    cursor_ += 3;
+  }
+  if (!SkipWhitespace() || *cursor_ != '{') return false;
+  uoffset_t root;
+  if (!ParseTable(*GetTableInfo(*parser_.root_struct_def_), &root)) {
+    return false;
+  }
+  if (parser_.opts.require_json_eof && (!SkipWhitespace() || *cursor_)) {
+    return false;
+  }
+  const auto &file_identifier = parser_.file_identifier_;
+  const char *id = file_identifier.length() ? file_identifier.c_str() : nullptr;
+  if (parser_.opts.size_prefixed) {
+    parser_.builder_.FinishSizePrefixed(Offset<Table>(root), id);
+  } else {
+    parser_.builder_.Finish(Offset<Table>(root), id);
+  }
+  return true;
+}
+
+bool JsonTableParser::SkipWhitespace() {
+  for (;;) {
+    switch (*cursor_) {
+      case ' ':
+      case '\t':
+      case '\r':
+      case '\n': cursor_++; break;
+      case '/':
+        if (cursor_[1] == '/') {
+          // Documentation comments have placement rules, leave them be.
+          if (cursor_[2] == '/') return false;
+          cursor_ += 2;
+          while (*cursor_ && *cursor_ != '\n' && *cursor_ != '\r') cursor_++;
+        } else if (cursor_[1] == '*') {
+          auto end = strstr(cursor_ + 2, "*/");
+          if (!end) return false;
+          cursor_ = end + 2;
+        } else {
+          return false;
+        }
+        break;
+      default: return true;
+    }
+  }
+}
+
+// Strings without escapes are returned in place, others are decoded into
+// `string_`.
+bool JsonTableParser::ReadString(const char **str, size_t *len) {
+  const char quote = *cursor_;
+  if (quote != '\"' && quote != '\'') return false;
+  const char *const start = ++cursor_;
+  bool non_ascii = false;
+  for (;; cursor_++) {
+    const auto c = static_cast<unsigned char>(*cursor_);
+    if (c == quote || c == '\\') break;
+    if (c < ' ') return false;
+    non_ascii |= c >= 0x80;
+  }
+  if (*cursor_ == quote) {
+    *str = start;
+    *len = static_cast<size_t>(cursor_ - start);
+    cursor_++;
+    if (non_ascii && !parser_.opts.allow_non_utf8) {
+      for (const char *s = start; s < start + *len;) {
+        if (FromUTF8(&s) < 0) return false;
+      }
+    }
+    return true;
+  }
+
+  string_.assign(start, cursor_);
+  while (*cursor_ != quote) {
+    const char c = *cursor_++;
+    if (c != '\\') {
+      if (c < ' ' && static_cast<signed char>(c) >= 0) return false;
+      string_ += c;
+      continue;
+    }
+    switch (*cursor_++) {
+      case 'n': string_ += '\n'; break;
+      case 't': string_ += '\t'; break;
+      case 'r': string_ += '\r'; break;
+      case 'b': string_ += '\b'; break;
+      case 'f': string_ += '\f'; break;
+      case '\"': string_ += '\"'; break;
+      case '\'': string_ += '\''; break;
+      case '\\': string_ += '\\'; break;
+      case '/': string_ += '/'; break;
+      case 'u': {
+        uint32_t code_point = 0;
+        for (int pair = 0;; pair++) {
+          uint32_t unit = 0;
+          for (int i = 0; i < 4; i++, cursor_++) {
+            const char h = *cursor_;
+            if (!is_xdigit(h)) return false;
+            unit = unit * 16 + static_cast<uint32_t>(
+                                   is_digit(h) ? h - '0'
+                                               : (h | 0x20) - 'a' + 10);
+          }
+          if (pair == 0 && unit >= 0xD800 && unit <= 0xDBFF) {
+            // A high surrogate has to be followed by a low one.
+            if (cursor_[0] != '\\' || cursor_[1] != 'u') return false;
+            cursor_ += 2;
+            code_point = unit;
+            continue;
+          }
+          if (unit >= 0xDC00 && unit <= 0xDFFF) {
+            if (pair == 0) return false;
+            code_point =
+                0x10000 + ((code_point & 0x03FF) << 10) + (unit & 0x03FF);
+          } else {
+            if (pair == 1) return false;
+            code_point = unit;
+          }
+          break;
+        }
+        ToUTF8(code_point, &string_);
+        break;
+      }
+      default: return false;  // Including \x, which isn't JSON.
+    }
+  }
+  cursor_++;
+  if (!parser_.opts.allow_non_utf8) {
+    const char *s = string_.c_str();
+    while (s < string_.c_str() + string_.size()) {
+      if (FromUTF8(&s) < 0) return false;
+    }
+  }
+  *str = string_.c_str();
+  *len = string_.size();
+  return true;
+}
+
+bool JsonTableParser::ReadName(const char **name, size_t *len) {
+  if (*cursor_ == '\"' || *cursor_ == '\'') return ReadString(name, len);
+  if (parser_.opts.strict_json || !IsIdentStart(*cursor_)) return false;
+  *name = cursor_;
+  while (IsIdentChar(*cursor_)) cursor_++;
+  *len = static_cast<size_t>(cursor_ - *name);
+  return true;
+}
+
+// Mirrors Parser::ParseTableDelimiters for objects: calls `body` with each
+// field name, the cursor on its value. `count` is maintained by `body`.
+template<typename F> bool JsonTableParser::ParseObject(size_t &count, F body) {
+  if (*cursor_ != '{') return false;
+  cursor_++;
+  for (;;) {
+    if (!SkipWhitespace()) return false;
+    if ((!parser_.opts.strict_json || !count) && *cursor_ == '}') break;
+    const char *name;
+    size_t len;
+    if (!ReadName(&name, &len) || !SkipWhitespace() || *cursor_ != ':') {
+      return false;
+    }
+    cursor_++;
+    if (!SkipWhitespace() || !body(name, len) || !SkipWhitespace()) {
+      return false;
+    }
+    if (*cursor_ == '}') break;
+    if (*cursor_ != ',') return false;
+    cursor_++;
+  }
+  cursor_++;
+  return true;
+}
+
+// Mirrors Parser::ParseVectorDelimiters.
+template<typename F> bool JsonTableParser::ParseList(size_t &count, F body) {
+  if (*cursor_ != '[') return false;
+  cursor_++;
+  for (;;) {
+    if (!SkipWhitespace()) return false;
+    if ((!parser_.opts.strict_json || !count) && *cursor_ == ']') break;
+    if (!body()) return false;
+    count++;
+    if (!SkipWhitespace()) return false;
+    if (*cursor_ == ']') break;
+    if (*cursor_ != ',') return false;
+    cursor_++;
+  }
+  cursor_++;
+  return true;
+}
+
+// Accepts what Parser::ParseSingleValue accepts for the common cases:
+// numbers, true/false, null and (quoted) enum identifiers.
+bool JsonTableParser::ParseScalar(const Type &type, const char *hash,
+                                  uint64_t *bits, bool *is_null) {
+  *is_null = false;
+  const auto base_type = type.base_type;
+  const char c = *cursor_;
+  if (c == '-' || is_digit(c)) {
+    auto end = ScanNumber(cursor_);
+    if (!end) return false;
+    auto start = cursor_;
+    cursor_ = end;
+    return TextToScalar(base_type, start, static_cast<size_t>(end - start),
+                        bits);
+  }
+
+  const bool quoted = c == '\"' || c == '\'';
+  if (hash && (quoted || IsIdentStart(c)) &&
+      (base_type == BASE_TYPE_INT || base_type == BASE_TYPE_UINT ||
+       base_type == BASE_TYPE_LONG || base_type == BASE_TYPE_ULONG)) {
+    return ParseHash(base_type, hash, bits);
+  }
+
+  const char *text = cursor_ + 1;
+  const char *end = text;
+  if (quoted) {
+    // Only trivial ASCII is allowed in a quoted scalar.
+    while (*end != c) {
+      if (*end < ' ' || *end > '~' || *end == '\\') return false;
+      end++;
+    }
+    cursor_ = end + 1;
+  } else if (IsIdentStart(c)) {
+    text = cursor_;
+    while (IsIdentChar(*end)) end++;
+    if (*end == '(') return false;  // A conversion function.
+    cursor_ = end;
+  } else {
+    return false;
+  }
+  const auto len = static_cast<size_t>(end - text);
+
+  if (base_type == BASE_TYPE_BOOL &&
+      (Equals(text, len, "true") || Equals(text, len, "false"))) {
+    *bits = ToBits(*text == 't');
+    return true;
+  }
+  if (Equals(text, len, "null")) {
+    *is_null = true;
+    return true;
+  }
+  if (IsInteger(base_type) && base_type != BASE_TYPE_BOOL &&
+      IsIdentStart(*text)) {
+    // Space separated bit_flags and qualified names are left out.
+    if (!type.enum_def || memchr(text, ' ', len)) return false;
+    auto enum_val = type.enum_def->Lookup(std::string(text, len));
+    if (!enum_val) return false;
+    const auto u64 = enum_val->GetAsUInt64();
+    const auto number =
+        IsUnsigned(type.enum_def->underlying_type.base_type)
+            ? NumToString(u64)
+            : NumToString(static_cast<int64_t>(u64));
+    return TextToScalar(base_type, number.c_str(), number.size(), bits);
+  }
+  if (!quoted) return false;
+  auto last = end;
+  while (last > text && last[-1] == ' ') last--;
+  return ScanNumber(text) == last && last > text &&
+         TextToScalar(base_type, text, static_cast<size_t>(last - text),
+                      bits);
+}
+
+// Mirrors Parser::ParseHash.
+bool JsonTableParser::ParseHash(BaseType type, const char *hash,
+                                uint64_t *bits) {
+  const char *text = cursor_;
+  size_t len;
+  if (IsIdentStart(*cursor_)) {
+    while (IsIdentChar(*cursor_)) cursor_++;
+    len = static_cast<size_t>(cursor_ - text);
+  } else if (!ReadString(&text, &len)) {
+    return false;
+  }
+  // Hashed up to the first '\0', like ParseHash does.
+  const std::string value(text, len);
+  switch (type) {
+    case BASE_TYPE_INT:
+      *bits = ToBits(static_cast<int32_t>(
+          FindHashFunction32(hash)(value.c_str())));
+      return true;
+    case BASE_TYPE_UINT:
+      *bits = ToBits(FindHashFunction32(hash)(value.c_str()));
+      return true;
+    case BASE_TYPE_LONG:
+      *bits = ToBits(static_cast<int64_t>(
+          FindHashFunction64(hash)(value.c_str())));
+      return true;
+    case BASE_TYPE_ULONG:
+      *bits = ToBits(FindHashFunction64(hash)(value.c_str()));
+      return true;
+    default: return false;
+  }
+}
+
+bool JsonTableParser::ParseString(bool shared, uoffset_t *off) {
+  const char *str;
+  size_t len;
+  if (!ReadString(&str, &len)) return false;
+  auto &builder = parser_.builder_;
+  *off = shared ? builder.CreateSharedString(str, len).o
+                : builder.CreateString(str, len).o;
+  return true;
+}
+
+bool JsonTableParser::ParseField(const FieldSlot &slot, size_t fields_mark,
+                                 size_t &fieldn) {
+  if (!slot.supported) return false;
+  const FieldDef &field = *slot.field;
+  const Type &type = field.value.type;
+  if (!IsScalar(type.base_type) && strncmp(cursor_, "null", 4) == 0 &&
+      !IsIdentChar(cursor_[4])) {
+    cursor_ += 4;  // Ignore this field.
+    return true;
+  }
+
+  ParsedField parsed = { &slot, 0, false };
+  uoffset_t off = 0;
+  switch (type.base_type) {
+    case BASE_TYPE_STRING:
+      if (!ParseString(field.shared, &off)) return false;
+      parsed.value = off;
+      break;
+    case BASE_TYPE_STRUCT:
+      if (type.struct_def->fixed) {
+        const auto pos = scratch_.size();
+        scratch_.resize(pos + type.struct_def->bytesize, 0);
+        if (!ParseStruct(*slot.child, scratch_.data() + pos)) return false;
+        parsed.value = pos;
+      } else {
+        if (!ParseTable(*slot.child, &off)) return false;
+        parsed.value = off;
+      }
+      break;
+    case BASE_TYPE_VECTOR:
+      if (!ParseVector(slot, &off)) return false;
+      parsed.value = off;
+      break;
+    case BASE_TYPE_UNION:
+      if (!ParseUnion(field, fields_mark, &off)) return false;
+      parsed.value = off;
+      break;
+    default:
+      if (!IsScalar(type.base_type) ||
+          !ParseScalar(type, slot.hash, &parsed.value, &parsed.is_null) ||
+          (parsed.is_null && !field.IsScalarOptional())) {
+        return false;
+      }
+      break;
+  }
+
+  // Keep the fields sorted by offset, like Parser::ParseTable.
+  auto pos = fields_.size();
+  for (; pos > fields_mark; pos--) {
+    const FieldDef *existing = fields_[pos - 1].slot->field;
+    if (existing == &field) return false;  // Set more than once.
+    if (existing->value.offset < field.value.offset) break;
+  }
+  fields_.insert(fields_.begin() + static_cast<std::ptrdiff_t>(pos), parsed);
+  fieldn++;
+  return true;
+}
+
+bool JsonTableParser::ParseTable(const TableInfo &info, uoffset_t *off) {
+  if (!info.supported || depth_ >= FLATBUFFERS_MAX_PARSING_DEPTH) return false;
+  depth_++;
+  const auto fields_mark = fields_.size();
+  const auto scratch_mark = scratch_.size();
+  size_t fieldn = 0;
+  auto ok = ParseObject(fieldn, [&](const char *name, size_t len) {
+    if (Equals(name, len, "$schema")) return ReadString(&name, &len);
+    auto slot = LookupField(info, name, len);
+    if (!slot) {
+      return parser_.opts.skip_unexpected_fields_in_json && SkipValue();
+    }
+    return ParseField(*slot, fields_mark, fieldn);
+  });
+  if (!ok) return false;
+
+  for (auto it = info.required.begin(); it != info.required.end(); ++it) {
+    auto pf = fields_.begin() + static_cast<std::ptrdiff_t>(fields_mark);
+    while (pf != fields_.end() && pf->slot->field != *it) ++pf;
+    if (pf == fields_.end()) return false;
+  }
+
+  // Serialize exactly like Parser::ParseTable.
+  const StructDef &struct_def = *info.struct_def;
+  auto &builder = parser_.builder_;
+  const auto start = builder.StartTable();
+  for (size_t size = struct_def.sortbysize ? sizeof(largest_scalar_t) : 1; size;
+       size /= 2) {
+    for (auto i = fields_.size(); i > fields_mark; i--) {
+      const auto &parsed = fields_[i - 1];
+      const FieldDef &field = *parsed.slot->field;
+      const auto base_type = field.value.type.base_type;
+      const auto voffset = field.value.offset;
+      if (struct_def.sortbysize && size != SizeOf(base_type)) continue;
+      builder.Pad(field.padding);
+      switch (base_type) {
+        // clang-format off
+        #define FLATBUFFERS_TD(ENUM, IDLTYPE, CTYPE, ...) \
+          case BASE_TYPE_ ## ENUM: \
+            if (!field.IsScalarOptional()) { \
+              builder.AddElement(voffset, FromBits<CTYPE>(parsed.value), \
+                                 FromBits<CTYPE>(parsed.slot->default_bits)); \
+            } else if (!parsed.is_null) { \
+              builder.AddElement(voffset, FromBits<CTYPE>(parsed.value)); \
+            } \
+            break;
+          FLATBUFFERS_GEN_TYPES_SCALAR(FLATBUFFERS_TD)
+        #undef FLATBUFFERS_TD
+        // clang-format on
+        case BASE_TYPE_STRUCT:
+          if (field.value.type.struct_def->fixed) {
+            const auto &fixed = *field.value.type.struct_def;
+            builder.Align(fixed.minalign);
+            builder.PushBytes(scratch_.data() + parsed.value, fixed.bytesize);
+            builder.AddStructOffset(voffset, builder.GetSize());
+            break;
+          }
+          FLATBUFFERS_FALLTHROUGH();
+        default:
+          builder.AddOffset(
+              voffset, Offset<void>(static_cast<uoffset_t>(parsed.value)));
+          break;
+      }
+    }
+  }
+  *off = builder.EndTable(start);
+  fields_.resize(fields_mark);
+  scratch_.resize(scratch_mark);
+  depth_--;
+  return true;
+}
+
+// Writes the struct straight into `dest`, which must be zeroed.
+bool JsonTableParser::ParseStruct(const TableInfo &info, uint8_t *dest) {
+  if (!info.supported || depth_ >= FLATBUFFERS_MAX_PARSING_DEPTH) return false;
+  depth_++;
+  uint64_t seen = 0;
+  size_t fieldn = 0;
+  auto ok = ParseObject(fieldn, [&](const char *name, size_t len) {
+    if (Equals(name, len, "$schema")) return ReadString(&name, &len);
+    auto slot = LookupField(info, name, len);
+    if (!slot) {
+      return parser_.opts.skip_unexpected_fields_in_json && SkipValue();
+    }
+    const auto bit = uint64_t(1) << slot->index;
+    if (!slot->supported || (seen & bit)) return false;
+    const Type &type = slot->field->value.type;
+    uint8_t *field_dest = dest + slot->field->value.offset;
+    if (type.base_type == BASE_TYPE_STRUCT) {
+      if (!ParseStruct(*slot->child, field_dest)) return false;
+    } else if (type.base_type == BASE_TYPE_ARRAY) {
+      if (!ParseArray(*slot, field_dest)) return false;
+    } else {
+      uint64_t bits;
+      bool is_null;
+      if (!ParseScalar(type, slot->hash, &bits, &is_null) || is_null) {
+        return false;
+      }
+      WriteScalarBits(type.base_type, bits, field_dest);
+    }
+    seen |= bit;
+    fieldn++;
+    return true;
+  });
+  if (!ok || fieldn != info.struct_def->fields.vec.size()) return false;
+  // Parser::ParseTable assembles structs in the builder and pops them again,
+  // which leaves the builder aligned. Do the same, or the layout of
+  // everything that follows would differ.
+  parser_.builder_.Align(info.struct_def->minalign);
+  depth_--;
+  return true;
+}
+
+bool JsonTableParser::ParseArray(const FieldSlot &slot, uint8_t *dest) {
+  const Type &type = slot.field->value.type;
+  const Type elem = type.VectorType();
+  const size_t elem_size = InlineSize(elem);
+  size_t count = 0;
+  auto ok = ParseList(count, [&]() {
+    if (count >= type.fixed_length) return false;
+    uint8_t *elem_dest = dest + count * elem_size;
+    if (IsStruct(elem)) return ParseStruct(*slot.child, elem_dest);
+    uint64_t bits;
+    bool is_null;
+    if (!ParseScalar(elem, nullptr, &bits, &is_null) || is_null) return false;
+    WriteScalarBits(elem.base_type, bits, elem_dest);
+    return true;
+  });
+  return ok && count == type.fixed_length;
+}
+
+// Elements are collected in `scratch_` (scalars and structs as they appear in
+// the buffer, others as offsets), then written to the builder in one go.
+bool JsonTableParser::ParseVector(const FieldSlot &slot, uoffset_t *off) {
+  const Type elem = slot.field->value.type.VectorType();
+  const auto scratch_mark = scratch_.size();
+  const bool is_scalar = IsScalar(elem.base_type);
+  const bool is_struct = IsStruct(elem);
+  const size_t elem_size = is_scalar   ? SizeOf(elem.base_type)
+                           : is_struct ? elem.struct_def->bytesize
+                                       : sizeof(uoffset_t);
+  size_t count = 0;
+  auto ok = ParseList(count, [&]() {
+    uoffset_t elem_off = 0;
+    if (is_scalar) {
+      uint64_t bits;
+      bool is_null;
+      if (!ParseScalar(elem, slot.hash, &bits, &is_null) || is_null) {
+        return false;
+      }
+      scratch_.resize(scratch_.size() + elem_size);
+      WriteScalarBits(elem.base_type, bits,
+                      scratch_.data() + scratch_.size() - elem_size);
+      return true;
+    } else if (is_struct) {
+      scratch_.resize(scratch_.size() + elem_size, 0);
+      return ParseStruct(*slot.child,
+                         scratch_.data() + scratch_.size() - elem_size);
+    } else if (elem.base_type == BASE_TYPE_STRING) {
+      if (!ParseString(slot.field->shared, &elem_off)) return false;
+    } else if (elem.base_type == BASE_TYPE_STRUCT) {
+      if (!ParseTable(*slot.child, &elem_off)) return false;
+    } else {
+      return false;
+    }
+    const auto pos = scratch_.size();
+    scratch_.resize(pos + sizeof(uoffset_t));
+    memcpy(scratch_.data() + pos, &elem_off, sizeof(uoffset_t));
+    return true;
+  });
+  if (!ok) return false;
+
+  auto &builder = parser_.builder_;
+  const uint8_t *elems = scratch_.data() + scratch_mark;
+  const size_t alignment = InlineAlignment(elem);
+  const size_t len = count * InlineSize(elem) / alignment;
+  if (slot.force_align > 1) {
+    builder.ForceVectorAlignment(len, alignment, slot.force_align);
+  }
+  builder.StartVector(len, alignment, alignment);
+  if (is_scalar) {
+    if (count) builder.PushBytes(elems, count * elem_size);
+  } else {
+    for (auto i = count; i > 0; i--) {
+      const uint8_t *e = elems + (i - 1) * elem_size;
+      if (is_struct) {
+        builder.Align(elem.struct_def->minalign);
+        builder.PushBytes(e, elem_size);
+      } else {
+        uoffset_t elem_off;
+        memcpy(&elem_off, e, sizeof(uoffset_t));
+        builder.PushElement(Offset<void>(elem_off));
+      }
+    }
+  }
+  builder.ClearOffsets();
+  *off = builder.EndVector(count);
+  scratch_.resize(scratch_mark);
+
+  if (elem.base_type == BASE_TYPE_STRUCT && elem.struct_def->has_key) {
+    parser_.SortVectorByKey(elem);
+  }
+  return true;
+}
+
+// Only handles union values whose type field was already seen.
+bool JsonTableParser::ParseUnion(const FieldDef &field, size_t fields_mark,
+                                 uoffset_t *off) {
+  const EnumDef *enum_def = field.value.type.enum_def;
+  const ParsedField *type_field = nullptr;
+  for (auto i = fields_.size(); i > fields_mark && !type_field; i--) {
+    const Type &type = fields_[i - 1].slot->field->value.type;
+    if (type.enum_def == enum_def && type.base_type == BASE_TYPE_UTYPE) {
+      type_field = &fields_[i - 1];
+    }
+  }
+  if (!type_field) return false;
+  auto enum_val =
+      enum_def->ReverseLookup(FromBits<uint8_t>(type_field->value), true);
+  if (!enum_val) return false;
+  const Type &union_type = enum_val->union_type;
+  if (union_type.base_type == BASE_TYPE_STRING) {
+    return ParseString(field.shared, off);
+  }
+  if (union_type.base_type != BASE_TYPE_STRUCT) return false;
+  const TableInfo &info = *GetTableInfo(*union_type.struct_def);
+  if (!union_type.struct_def->fixed) return ParseTable(info, off);
+  // All union values are offsets, so a struct gets written out on its own.
+  const auto pos = scratch_.size();
+  const auto bytesize = union_type.struct_def->bytesize;
+  scratch_.resize(pos + bytesize, 0);
+  if (!ParseStruct(info, scratch_.data() + pos)) return false;
+  auto &builder = parser_.builder_;
+  builder.Align(union_type.struct_def->minalign);
+  builder.PushBytes(scratch_.data() + pos, bytesize);
+  *off = builder.GetSize();
+  scratch_.resize(pos);
+  return true;
+}
+
+// Mirrors Parser::SkipAnyJsonValue.
+bool JsonTableParser::SkipValue() {
+  if (depth_ >= FLATBUFFERS_MAX_PARSING_DEPTH) return false;
+  depth_++;
+  size_t count = 0;
+  const char c = *cursor_;
+  if (c == '{') {
+    if (!ParseObject(count, [&](const char *, size_t) {
+          count++;
+          return SkipValue();
+        })) {
+      return false;
+    }
+  } else if (c == '[') {
+    if (!ParseList(count, [&]() { return SkipValue(); })) return false;
+  } else if (c == '\"' || c == '\'') {
+    const char *str;
+    size_t len;
+    if (!ReadString(&str, &len)) return false;
+  } else if (c == '-' || is_digit(c)) {
+    cursor_ = ScanNumber(cursor_);
+    if (!cursor_) return false;
+  } else {
+    const char *start = cursor_;
+    while (IsIdentChar(*cursor_)) cursor_++;
+    const auto len = static_cast<size_t>(cursor_ - start);
+    if (!Equals(start, len, "true") && !Equals(start, len, "false") &&
+        !Equals(start, len, "null") && !Equals(start, len, "inf")) {
+      return false;
+    }
+  }
+  depth_--;
+  return true;
+}
+
+}  // namespace flatbuffers
@@ -63,9 +63,8 @@ static_assert(BASE_TYPE_VECTOR64 ==
 #define NEXT() ECHECK(Next())
 #define EXPECT(tok) ECHECK(Expect(tok))
 
-static bool ValidateUTF8(const std::string &str) {
-  const char *s = &str[0];
-  const char *const sEnd = s + str.length();
+static bool ValidateUTF8(const char *s, size_t size) {
+  const char *const sEnd = s + size;
   while (s < sEnd) {
     if (FromUTF8(&s) < 0) { return false; }
   }
@@ -140,12 +139,12 @@ template<typename T>
 static T *LookupTableByName(const SymbolTable<T> &table,
                             const std::string &name,
                             const Namespace &current_namespace,
-                            size_t skip_top) {
+                            size_t skip_top, std::string &full_name) {
   const auto &components = current_namespace.components;
-  if (table.dict.empty()) return nullptr;
+  if (table.empty()) return nullptr;
   if (components.size() < skip_top) return nullptr;
   const auto N = components.size() - skip_top;
-  std::string full_name;
+  full_name.clear();
   for (size_t i = 0; i < N; i++) {
     full_name += components[i];
     full_name += '.';
@@ -448,7 +447,8 @@ std::string Namespace::GetFullyQualifiedName(const std::string &name,
 }
 
 std::string Parser::TokenToStringId(int t) const {
-  return t == kTokenIdentifier ? attribute_ : TokenToString(t);
+  return t == kTokenIdentifier ? std::string(TokenText(), TokenSize())
+                               : TokenToString(t);
 }
 
 // Parses exactly nibbles worth of hex digits into a number, or error.
@@ -480,7 +480,9 @@ CheckedError Parser::Next() {
   doc_comment_.clear();
   prev_cursor_ = cursor_;
   bool seen_newline = cursor_ == source_;
-  attribute_.clear();
+  token_start_ = cursor_;
+  token_size_ = 0;
+  attribute_set_ = false;
   attr_is_trivial_ascii_string_ = true;
   for (;;) {
     char c = *cursor_++;
@@ -512,12 +514,20 @@ CheckedError Parser::Next() {
       case '\"':
       case '\'': {
         int unicode_high_surrogate = -1;
+        // The contents are only copied, and decoded, into attribute_ from the
+        // first escape sequence on.
+        const char *start = cursor_;
+        bool escaped = false;
 
         while (*cursor_ != c) {
           if (*cursor_ < ' ' && static_cast<signed char>(*cursor_) >= 0)
             return Error("illegal character in string constant");
           if (*cursor_ == '\\') {
             attr_is_trivial_ascii_string_ = false;  // has escape sequence
+            if (!escaped) {
+              attribute_.assign(start, cursor_);
+              escaped = true;
+            }
             cursor_++;
             if (unicode_high_surrogate != -1 && *cursor_ != 'u') {
               return Error(
@@ -605,19 +615,32 @@ CheckedError Parser::Next() {
               return Error(
                   "illegal Unicode sequence (unpaired high surrogate)");
             }
-            // reset if non-printable
-            attr_is_trivial_ascii_string_ &=
-                check_ascii_range(*cursor_, ' ', '~');
-
-            attribute_ += *cursor_++;
+            // Skip the whole run of plain characters up to the next quote,
+            // escape or control character at once.
+            const char *run = cursor_;
+            while (*cursor_ != c && *cursor_ != '\\' &&
+                   (*cursor_ >= ' ' ||
+                    static_cast<signed char>(*cursor_) < 0)) {
+              // reset if non-printable
+              attr_is_trivial_ascii_string_ &=
+                  check_ascii_range(*cursor_, ' ', '~');
+              cursor_++;
+            }
+            if (escaped) attribute_.append(run, cursor_);
           }
         }
         if (unicode_high_surrogate != -1) {
           return Error("illegal Unicode sequence (unpaired high surrogate)");
         }
+        if (escaped) {
+          attribute_set_ = true;
+        } else {
+          token_start_ = start;
+          token_size_ = static_cast<size_t>(cursor_ - start);
+        }
         cursor_++;
         if (!attr_is_trivial_ascii_string_ && !opts.allow_non_utf8 &&
-            !ValidateUTF8(attribute_)) {
+            !ValidateUTF8(TokenText(), TokenSize())) {
           return Error("illegal UTF-8 sequence");
         }
         token_ = kTokenStringConstant;
@@ -651,7 +674,8 @@ CheckedError Parser::Next() {
           // Collect all chars of an identifier:
           const char *start = cursor_ - 1;
           while (IsIdentifierStart(*cursor_) || is_digit(*cursor_)) cursor_++;
-          attribute_.append(start, cursor_);
+          token_start_ = start;
+          token_size_ = static_cast<size_t>(cursor_ - start);
           token_ = kTokenIdentifier;
           return NoError();
         }
@@ -661,7 +685,8 @@ CheckedError Parser::Next() {
           // Check for +/-inf which is considered a float constant.
           if (strncmp(cursor_, "inf", 3) == 0 &&
               !(IsIdentifierStart(cursor_[3]) || is_digit(cursor_[3]))) {
-            attribute_.assign(cursor_ - 1, cursor_ + 3);
+            token_start_ = cursor_ - 1;
+            token_size_ = 4;
             token_ = kTokenFloatConstant;
             cursor_ += 3;
             return NoError();
@@ -716,7 +741,8 @@ CheckedError Parser::Next() {
           }
           // Finalize.
           if ((dot_lvl >= 0) && (cursor_ > start_digits)) {
-            attribute_.append(start, cursor_);
+            token_start_ = start;
+            token_size_ = static_cast<size_t>(cursor_ - start);
             token_ = dot_lvl ? kTokenIntegerConstant : kTokenFloatConstant;
             return NoError();
           } else {
@@ -736,7 +762,8 @@ CheckedError Parser::Next() {
 bool Parser::Is(int t) const { return t == token_; }
 
 bool Parser::IsIdent(const char *id) const {
-  return token_ == kTokenIdentifier && attribute_ == id;
+  return token_ == kTokenIdentifier && strlen(id) == TokenSize() &&
+         !strncmp(TokenText(), id, TokenSize());
 }
 
 // Expect a given token to be next, consume it, or error if not present.
@@ -753,8 +780,8 @@ CheckedError Parser::ParseNamespacing(std::string *id, std::string *last) {
   while (Is('.')) {
     NEXT();
     *id += ".";
-    *id += attribute_;
-    if (last) *last = attribute_;
+    *id += Attribute();
+    if (last) *last = Attribute();
     EXPECT(kTokenIdentifier);
   }
   return NoError();
@@ -762,7 +789,7 @@ CheckedError Parser::ParseNamespacing(std::string *id, std::string *last) {
 
 EnumDef *Parser::LookupEnum(const std::string &id) {
   // Search thru parent namespaces.
-  return LookupTableByName(enums_, id, *current_namespace_, 0);
+  return LookupTableByName(enums_, id, *current_namespace_, 0, lookup_name_);
 }
 
 StructDef *Parser::LookupStruct(const std::string &id) const {
@@ -773,13 +800,14 @@ StructDef *Parser::LookupStruct(const std::string &id) const {
 
 StructDef *Parser::LookupStructThruParentNamespaces(
     const std::string &id) const {
-  auto sd = LookupTableByName(structs_, id, *current_namespace_, 1);
+  auto sd =
+      LookupTableByName(structs_, id, *current_namespace_, 1, lookup_name_);
   if (sd) sd->refcount++;
   return sd;
 }
 
 CheckedError Parser::ParseTypeIdent(Type &type) {
-  std::string id = attribute_;
+  std::string id = Attribute();
   EXPECT(kTokenIdentifier);
   ECHECK(ParseNamespacing(&id, nullptr));
   auto enum_def = LookupEnum(id);
@@ -852,7 +880,7 @@ CheckedError Parser::ParseType(Type &type) {
         return Error("length of fixed-length array must be an integer value");
       }
       uint16_t fixed_length = 0;
-      bool check = StringToNumber(attribute_.c_str(), &fixed_length);
+      bool check = StringToNumber(Attribute().c_str(), &fixed_length);
       if (!check || fixed_length < 1) {
         return Error(
             "length of fixed-length array must be positive and fit to "
@@ -897,7 +925,7 @@ CheckedError Parser::AddField(StructDef &struct_def, const std::string &name,
 }
 
 CheckedError Parser::ParseField(StructDef &struct_def) {
-  std::string name = attribute_;
+  std::string name = Attribute();
 
   if (LookupCreateStruct(name, false, false))
     return Error("field name can not be the same as table/struct name");
@@ -1288,13 +1316,16 @@ CheckedError Parser::ParseField(StructDef &struct_def) {
 }
 
 CheckedError Parser::ParseString(Value &val, bool use_string_pooling) {
-  auto s = attribute_;
-  EXPECT(kTokenStringConstant);
+  if (!Is(kTokenStringConstant)) return Expect(kTokenStringConstant);
+  // Serialize straight from the token, before the lexer moves on.
   if (use_string_pooling) {
-    val.constant = NumToString(builder_.CreateSharedString(s).o);
+    val.constant = NumToString(
+        builder_.CreateSharedString(TokenText(), TokenSize()).o);
   } else {
-    val.constant = NumToString(builder_.CreateString(s).o);
+    val.constant =
+        NumToString(builder_.CreateString(TokenText(), TokenSize()).o);
   }
+  NEXT();
   return NoError();
 }
 
@@ -1350,7 +1381,7 @@ CheckedError Parser::ParseAnyValue(Value &val, FieldDef *field,
         auto backup = *static_cast<ParserState *>(this);
         ECHECK(SkipAnyJsonValue());  // The table.
         ECHECK(ParseComma());
-        auto next_name = attribute_;
+        auto next_name = Attribute();
         if (Is(kTokenStringConstant)) {
           NEXT();
         } else {
@@ -1470,7 +1501,7 @@ CheckedError Parser::ParseTableDelimiters(size_t &fieldn,
       }
       name = struct_def->fields.vec[fieldn]->name;
     } else {
-      name = attribute_;
+      name.assign(TokenText(), TokenSize());
       if (Is(kTokenStringConstant)) {
         NEXT();
       } else {
@@ -1758,64 +1789,70 @@ CheckedError Parser::ParseVector(const Type &vector_type, uoffset_t *ovalue,
   }
 
   if (type.base_type == BASE_TYPE_STRUCT && type.struct_def->has_key) {
-    // We should sort this vector. Find the key first.
-    const FieldDef *key = nullptr;
-    for (auto it = type.struct_def->fields.vec.begin();
-         it != type.struct_def->fields.vec.end(); ++it) {
-      if ((*it)->key) {
-        key = (*it);
-        break;
-      }
+    SortVectorByKey(type);
+  }
+  return NoError();
+}
+
+// Sorts the vector of keyed tables or structs that was just built, so it can
+// be searched with LookupByKey.
+void Parser::SortVectorByKey(const Type &type) {
+  // We should sort this vector. Find the key first.
+  const FieldDef *key = nullptr;
+  for (auto it = type.struct_def->fields.vec.begin();
+       it != type.struct_def->fields.vec.end(); ++it) {
+    if ((*it)->key) {
+      key = (*it);
+      break;
     }
-    FLATBUFFERS_ASSERT(key);
-    // Now sort it.
-    // We can't use std::sort because for structs the size is not known at
-    // compile time, and for tables our iterators dereference offsets, so can't
-    // be used to swap elements.
-    // And we can't use C qsort either, since that would force use to use
-    // globals, making parsing thread-unsafe.
-    // So for now, we use SimpleQsort above.
-    // TODO: replace with something better, preferably not recursive.
-
-    if (type.struct_def->fixed) {
-      const voffset_t offset = key->value.offset;
-      const size_t struct_size = type.struct_def->bytesize;
-      auto v =
-          reinterpret_cast<VectorOfAny *>(builder_.GetCurrentBufferPointer());
-      SimpleQsort<uint8_t>(
-          v->Data(), v->Data() + v->size() * type.struct_def->bytesize,
-          type.struct_def->bytesize,
-          [offset, key](const uint8_t *a, const uint8_t *b) -> bool {
-            return CompareSerializedScalars(a + offset, b + offset, *key);
+  }
+  FLATBUFFERS_ASSERT(key);
+  // Now sort it.
+  // We can't use std::sort because for structs the size is not known at
+  // compile time, and for tables our iterators dereference offsets, so can't
+  // be used to swap elements.
+  // And we can't use C qsort either, since that would force use to use
+  // globals, making parsing thread-unsafe.
+  // So for now, we use SimpleQsort above.
+  // TODO: replace with something better, preferably not recursive.
+
+  if (type.struct_def->fixed) {
+    const voffset_t offset = key->value.offset;
+    const size_t struct_size = type.struct_def->bytesize;
+    auto v =
+        reinterpret_cast<VectorOfAny *>(builder_.GetCurrentBufferPointer());
+    SimpleQsort<uint8_t>(
+        v->Data(), v->Data() + v->size() * type.struct_def->bytesize,
+        type.struct_def->bytesize,
+        [offset, key](const uint8_t *a, const uint8_t *b) -> bool {
+          return CompareSerializedScalars(a + offset, b + offset, *key);
+        },
+        [struct_size](uint8_t *a, uint8_t *b) {
+          // FIXME: faster?
+          for (size_t i = 0; i < struct_size; i++) { std::swap(a[i], b[i]); }
+        });
+  } else {
+    auto v = reinterpret_cast<Vector<Offset<Table>> *>(
+        builder_.GetCurrentBufferPointer());
+    // Here also can't use std::sort. We do have an iterator type for it,
+    // but it is non-standard as it will dereference the offsets, and thus
+    // can't be used to swap elements.
+    if (key->value.type.base_type == BASE_TYPE_STRING) {
+      SimpleQsort<Offset<Table>>(
+          v->data(), v->data() + v->size(), 1,
+          [key](const Offset<Table> *_a, const Offset<Table> *_b) -> bool {
+            return CompareTablesByStringKey(_a, _b, *key);
           },
-          [struct_size](uint8_t *a, uint8_t *b) {
-            // FIXME: faster?
-            for (size_t i = 0; i < struct_size; i++) { std::swap(a[i], b[i]); }
-          });
+          SwapSerializedTables);
     } else {
-      auto v = reinterpret_cast<Vector<Offset<Table>> *>(
-          builder_.GetCurrentBufferPointer());
-      // Here also can't use std::sort. We do have an iterator type for it,
-      // but it is non-standard as it will dereference the offsets, and thus
-      // can't be used to swap elements.
-      if (key->value.type.base_type == BASE_TYPE_STRING) {
-        SimpleQsort<Offset<Table>>(
-            v->data(), v->data() + v->size(), 1,
-            [key](const Offset<Table> *_a, const Offset<Table> *_b) -> bool {
-              return CompareTablesByStringKey(_a, _b, *key);
-            },
-            SwapSerializedTables);
-      } else {
-        SimpleQsort<Offset<Table>>(
-            v->data(), v->data() + v->size(), 1,
-            [key](const Offset<Table> *_a, const Offset<Table> *_b) -> bool {
-              return CompareTablesByScalarKey(_a, _b, *key);
-            },
-            SwapSerializedTables);
-      }
+      SimpleQsort<Offset<Table>>(
+          v->data(), v->data() + v->size(), 1,
+          [key](const Offset<Table> *_a, const Offset<Table> *_b) -> bool {
+            return CompareTablesByScalarKey(_a, _b, *key);
+          },
+          SwapSerializedTables);
     }
   }
-  return NoError();
 }
 
 CheckedError Parser::ParseArray(Value &array) {
@@ -1894,8 +1931,7 @@ CheckedError Parser::ParseNestedFlatbuffer(Value &val, FieldDef *field,
 
     // Clean nested_parser to avoid deleting the elements in
     // the SymbolTables on destruction
-    nested_parser.enums_.dict.clear();
-    nested_parser.enums_.vec.clear();
+    nested_parser.enums_.Release();
 
     if (!ok) { ECHECK(Error(nested_parser.error_)); }
     // Force alignment for nested flatbuffer
@@ -1914,7 +1950,7 @@ CheckedError Parser::ParseMetaData(SymbolTable<Value> *attributes) {
   if (Is('(')) {
     NEXT();
     for (;;) {
-      auto name = attribute_;
+      auto name = Attribute();
       if (false == (Is(kTokenIdentifier) || Is(kTokenStringConstant)))
         return Error("attribute name must be either identifier or string: " +
                      name);
@@ -1943,11 +1979,12 @@ CheckedError Parser::ParseEnumFromString(const Type &type,
   const auto base_type =
       type.enum_def ? type.enum_def->underlying_type.base_type : type.base_type;
   if (!IsInteger(base_type)) return Error("not a valid value for this field");
+  const std::string &words = Attribute();
   uint64_t u64 = 0;
   for (size_t pos = 0; pos != std::string::npos;) {
-    const auto delim = attribute_.find_first_of(' ', pos);
+    const auto delim = words.find_first_of(' ', pos);
     const auto last = (std::string::npos == delim);
-    auto word = attribute_.substr(pos, !last ? delim - pos : std::string::npos);
+    auto word = words.substr(pos, !last ? delim - pos : std::string::npos);
     pos = !last ? delim + 1 : std::string::npos;
     const EnumVal *ev = nullptr;
     if (type.enum_def) {
@@ -1976,37 +2013,37 @@ CheckedError Parser::ParseHash(Value &e, FieldDef *field) {
   switch (e.type.base_type) {
     case BASE_TYPE_SHORT: {
       auto hash = FindHashFunction16(hash_name->constant.c_str());
-      int16_t hashed_value = static_cast<int16_t>(hash(attribute_.c_str()));
+      int16_t hashed_value = static_cast<int16_t>(hash(Attribute().c_str()));
       e.constant = NumToString(hashed_value);
       break;
     }
     case BASE_TYPE_USHORT: {
       auto hash = FindHashFunction16(hash_name->constant.c_str());
-      uint16_t hashed_value = hash(attribute_.c_str());
+      uint16_t hashed_value = hash(Attribute().c_str());
       e.constant = NumToString(hashed_value);
       break;
     }
     case BASE_TYPE_INT: {
       auto hash = FindHashFunction32(hash_name->constant.c_str());
-      int32_t hashed_value = static_cast<int32_t>(hash(attribute_.c_str()));
+      int32_t hashed_value = static_cast<int32_t>(hash(Attribute().c_str()));
       e.constant = NumToString(hashed_value);
       break;
     }
     case BASE_TYPE_UINT: {
       auto hash = FindHashFunction32(hash_name->constant.c_str());
-      uint32_t hashed_value = hash(attribute_.c_str());
+      uint32_t hashed_value = hash(Attribute().c_str());
       e.constant = NumToString(hashed_value);
       break;
     }
     case BASE_TYPE_LONG: {
       auto hash = FindHashFunction64(hash_name->constant.c_str());
-      int64_t hashed_value = static_cast<int64_t>(hash(attribute_.c_str()));
+      int64_t hashed_value = static_cast<int64_t>(hash(Attribute().c_str()));
       e.constant = NumToString(hashed_value);
       break;
     }
     case BASE_TYPE_ULONG: {
       auto hash = FindHashFunction64(hash_name->constant.c_str());
-      uint64_t hashed_value = hash(attribute_.c_str());
+      uint64_t hashed_value = hash(Attribute().c_str());
       e.constant = NumToString(hashed_value);
       break;
     }
@@ -2025,7 +2062,7 @@ CheckedError Parser::ParseFunction(const std::string *name, Value &e) {
   ECHECK(depth_guard.Check());
 
   // Copy name, attribute will be changed on NEXT().
-  const auto functionname = attribute_;
+  const auto functionname = Attribute();
   if (!IsFloat(e.type.base_type)) {
     return Error(functionname + ": type of argument mismatch, expecting: " +
                  TypeName(BASE_TYPE_DOUBLE) +
@@ -2068,7 +2105,7 @@ CheckedError Parser::TryTypedValue(const std::string *name, int dtoken,
                                    bool *destmatch) {
   FLATBUFFERS_ASSERT(*destmatch == false && dtoken == token_);
   *destmatch = true;
-  e.constant = attribute_;
+  e.constant.assign(TokenText(), TokenSize());
   // Check token match
   if (!check) {
     if (e.type.base_type == BASE_TYPE_NONE) {
@@ -2104,7 +2141,7 @@ CheckedError Parser::ParseSingleValue(const std::string *name, Value &e,
     // Get an indentifier: NAN, INF, or function name like cos/sin/deg.
     NEXT();
     if (token_ != kTokenIdentifier) return Error("constant name expected");
-    attribute_.insert(size_t(0), size_t(1), sign);
+    SetAttribute(sign + Attribute());
   }
 
   const auto in_type = e.type.base_type;
@@ -2137,20 +2174,20 @@ CheckedError Parser::ParseSingleValue(const std::string *name, Value &e,
           std::string("type mismatch or invalid value, an initializer of "
                       "non-string field must be trivial ASCII string: type: ") +
           TypeName(in_type) + ", name: " + (name ? *name : "") +
-          ", value: " + attribute_);
+          ", value: " + Attribute());
     }
 
     // A boolean as true/false. Boolean as Integer check below.
     if (!match && IsBool(in_type)) {
-      auto is_true = attribute_ == "true";
-      if (is_true || attribute_ == "false") {
-        attribute_ = is_true ? "1" : "0";
+      auto is_true = Attribute() == "true";
+      if (is_true || Attribute() == "false") {
+        SetAttribute(is_true ? "1" : "0");
         // accepts both kTokenStringConstant and kTokenIdentifier
         TRY_ECHECK(kTokenStringOrIdent, IsBool(in_type), BASE_TYPE_BOOL);
       }
     }
     // Check for optional scalars.
-    if (!match && IsScalar(in_type) && attribute_ == "null") {
+    if (!match && IsScalar(in_type) && Attribute() == "null") {
       e.constant = "null";
       NEXT();
       match = true;
@@ -2158,7 +2195,7 @@ CheckedError Parser::ParseSingleValue(const std::string *name, Value &e,
     // Check if this could be a string/identifier enum value.
     // Enum can have only true integer base type.
     if (!match && IsInteger(in_type) && !IsBool(in_type) &&
-        IsIdentifierStart(*attribute_.c_str())) {
+        IsIdentifierStart(*Attribute().c_str())) {
       ECHECK(ParseEnumFromString(e.type, &e.constant));
       NEXT();
       match = true;
@@ -2166,15 +2203,17 @@ CheckedError Parser::ParseSingleValue(const std::string *name, Value &e,
     // Parse a float/integer number from the string.
     // A "scalar-in-string" value needs extra checks.
     if (!match && is_tok_string && IsScalar(in_type)) {
-      // Strip trailing whitespaces from attribute_.
-      auto last_non_ws = attribute_.find_last_not_of(' ');
-      if (std::string::npos != last_non_ws) attribute_.resize(last_non_ws + 1);
+      // Strip trailing whitespaces from the token.
+      auto last_non_ws = Attribute().find_last_not_of(' ');
+      if (std::string::npos != last_non_ws) {
+        SetAttribute(Attribute().substr(0, last_non_ws + 1));
+      }
       if (IsFloat(e.type.base_type)) {
         // The functions strtod() and strtof() accept both 'nan' and
         // 'nan(number)' literals. While 'nan(number)' is rejected by the parser
         // as an unsupported function if is_tok_ident is true.
-        if (attribute_.find_last_of(')') != std::string::npos) {
-          return Error("invalid number: " + attribute_);
+        if (Attribute().find_last_of(')') != std::string::npos) {
+          return Error("invalid number: " + Attribute());
         }
       }
     }
@@ -2347,7 +2386,7 @@ void EnumDef::SortByValue() {
 void EnumDef::RemoveDuplicates() {
   // This method depends form SymbolTable implementation!
   // 1) vals.vec - owner (raw pointer)
-  // 2) vals.dict - access map
+  // 2) vals' lookup map
   auto first = vals.vec.begin();
   auto last = vals.vec.end();
   if (first == last) return;
@@ -2357,9 +2396,7 @@ void EnumDef::RemoveDuplicates() {
       *(++result) = *first;
     } else {
       auto ev = *first;
-      for (auto it = vals.dict.begin(); it != vals.dict.end(); ++it) {
-        if (it->second == ev) it->second = *result;  // reassign
-      }
+      vals.Redirect(ev, *result);  // reassign
       delete ev;  // delete enum value
       *first = nullptr;
     }
@@ -2477,7 +2514,7 @@ CheckedError Parser::ParseEnum(const bool is_union, EnumDef **dest,
                                const char *filename) {
   std::vector<std::string> enum_comment = doc_comment_;
   NEXT();
-  std::string enum_name = attribute_;
+  std::string enum_name = Attribute();
   EXPECT(kTokenIdentifier);
   EnumDef *enum_def;
   ECHECK(StartEnum(enum_name, is_union, &enum_def));
@@ -2539,10 +2576,10 @@ CheckedError Parser::ParseEnum(const bool is_union, EnumDef **dest,
   }
   std::set<std::pair<BaseType, StructDef *>> union_types;
   while (!Is('}')) {
-    if (opts.proto_mode && attribute_ == "option") {
+    if (opts.proto_mode && Attribute() == "option") {
       ECHECK(ParseProtoOption());
     } else {
-      auto &ev = *evb.CreateEnumerator(attribute_);
+      auto &ev = *evb.CreateEnumerator(Attribute());
       auto full_name = ev.name;
       ev.doc_comment = doc_comment_;
       EXPECT(kTokenIdentifier);
@@ -2572,7 +2609,7 @@ CheckedError Parser::ParseEnum(const bool is_union, EnumDef **dest,
 
       if (Is('=')) {
         NEXT();
-        ECHECK(evb.AssignEnumeratorValue(attribute_));
+        ECHECK(evb.AssignEnumeratorValue(Attribute()));
         EXPECT(kTokenIntegerConstant);
       }
 
@@ -2754,7 +2791,7 @@ CheckedError Parser::ParseDecl(const char *filename) {
   bool fixed = IsIdent("struct");
   if (!fixed && !IsIdent("table")) return Error("declaration expected");
   NEXT();
-  std::string name = attribute_;
+  std::string name = Attribute();
   EXPECT(kTokenIdentifier);
   StructDef *struct_def;
   ECHECK(StartStruct(name, &struct_def));
@@ -2847,7 +2884,7 @@ CheckedError Parser::ParseDecl(const char *filename) {
 CheckedError Parser::ParseService(const char *filename) {
   std::vector<std::string> service_comment = doc_comment_;
   NEXT();
-  auto service_name = attribute_;
+  auto service_name = Attribute();
   EXPECT(kTokenIdentifier);
   auto &service_def = *new ServiceDef();
   service_def.name = service_name;
@@ -2865,7 +2902,7 @@ CheckedError Parser::ParseService(const char *filename) {
   EXPECT('{');
   do {
     std::vector<std::string> doc_comment = doc_comment_;
-    auto rpc_name = attribute_;
+    auto rpc_name = Attribute();
     EXPECT(kTokenIdentifier);
     EXPECT('(');
     Type reqtype, resptype;
@@ -2919,7 +2956,7 @@ CheckedError Parser::ParseNamespace() {
   namespaces_.push_back(ns);  // Store it here to not leak upon error.
   if (token_ != ';') {
     for (;;) {
-      ns->components.push_back(attribute_);
+      ns->components.push_back(Attribute());
       EXPECT(kTokenIdentifier);
       if (Is('.')) NEXT() else break;
     }
@@ -2946,14 +2983,14 @@ CheckedError Parser::ParseProtoDecl() {
     Namespace *parent_namespace = nullptr;
     if (isextend) {
       if (Is('.')) NEXT();  // qualified names may start with a . ?
-      auto id = attribute_;
+      auto id = Attribute();
       EXPECT(kTokenIdentifier);
       ECHECK(ParseNamespacing(&id, nullptr));
       struct_def = LookupCreateStruct(id, false);
       if (!struct_def)
         return Error("cannot extend unknown message type: " + id);
     } else {
-      std::string name = attribute_;
+      std::string name = Attribute();
       EXPECT(kTokenIdentifier);
       ECHECK(StartStruct(name, &struct_def));
       // Since message definitions can be nested, we create a new namespace.
@@ -3046,7 +3083,7 @@ CheckedError Parser::ParseProtoFields(StructDef *struct_def, bool isextend,
       while (!Is(';')) {
         if (token_ == kTokenIntegerConstant) {
           voffset_t attribute = 0;
-          bool done = StringToNumber(attribute_.c_str(), &attribute);
+          bool done = StringToNumber(Attribute().c_str(), &attribute);
           if (!done)
             return Error("Protobuf has non positive number in reserved ids");
 
@@ -3062,7 +3099,7 @@ CheckedError Parser::ParseProtoFields(StructDef *struct_def, bool isextend,
           from = attribute;
         }
 
-        if (attribute_ == "to") range = true;
+        if (Attribute() == "to") range = true;
 
         NEXT();
       }  // A variety of formats, just skip.
@@ -3099,7 +3136,7 @@ CheckedError Parser::ParseProtoFields(StructDef *struct_def, bool isextend,
       if (IsIdent("group") || oneof) {
         if (!oneof) NEXT();
         if (oneof && opts.proto_oneof_union) {
-          auto name = ConvertCase(attribute_, Case::kUpperCamel) + "Union";
+          auto name = ConvertCase(Attribute(), Case::kUpperCamel) + "Union";
           ECHECK(StartEnum(name, true, &oneof_union));
           type = Type(BASE_TYPE_UNION, nullptr, oneof_union);
         } else {
@@ -3122,7 +3159,7 @@ CheckedError Parser::ParseProtoFields(StructDef *struct_def, bool isextend,
           type.element = BASE_TYPE_STRING;
         }
       }
-      std::string name = attribute_;
+      std::string name = Attribute();
       EXPECT(kTokenIdentifier);
       std::string proto_field_id;
       if (!oneof) {
@@ -3130,7 +3167,7 @@ CheckedError Parser::ParseProtoFields(StructDef *struct_def, bool isextend,
         // any kind of binary compatibility, we can safely ignore these, and
         // assign our own.
         EXPECT('=');
-        proto_field_id = attribute_;
+        proto_field_id = Attribute();
         EXPECT(kTokenIntegerConstant);
       }
       FieldDef *field = nullptr;
@@ -3153,10 +3190,10 @@ CheckedError Parser::ParseProtoFields(StructDef *struct_def, bool isextend,
       if (Is('[')) {
         NEXT();
         for (;;) {
-          auto key = attribute_;
+          auto key = Attribute();
           ECHECK(ParseProtoKey());
           EXPECT('=');
-          auto val = attribute_;
+          auto val = Attribute();
           ECHECK(ParseProtoCurliesOrIdent());
           if (key == "default") {
             // Temp: skip non-numeric and non-boolean defaults (enums).
@@ -3220,10 +3257,10 @@ CheckedError Parser::ParseProtoMapField(StructDef *struct_def) {
   Type value_type;
   ECHECK(ParseType(value_type));
   EXPECT('>');
-  auto field_name = attribute_;
+  auto field_name = Attribute();
   NEXT();
   EXPECT('=');
-  std::string proto_field_id = attribute_;
+  std::string proto_field_id = Attribute();
   EXPECT(kTokenIntegerConstant);
   EXPECT(';');
 
@@ -3317,7 +3354,7 @@ CheckedError Parser::ParseTypeFromProtoType(Type *type) {
     { nullptr, BASE_TYPE_NONE, BASE_TYPE_NONE }
   };
   for (auto tl = lookup; tl->proto_type; tl++) {
-    if (attribute_ == tl->proto_type) {
+    if (Attribute() == tl->proto_type) {
       type->base_type = tl->fb_type;
       type->element = tl->element;
       NEXT();
@@ -3365,8 +3402,8 @@ CheckedError Parser::SkipAnyJsonValue() {
 CheckedError Parser::ParseFlexBufferNumericConstant(
     flexbuffers::Builder *builder) {
   double d;
-  if (!StringToNumber(attribute_.c_str(), &d))
-    return Error("unexpected floating-point constant: " + attribute_);
+  if (!StringToNumber(Attribute().c_str(), &d))
+    return Error("unexpected floating-point constant: " + Attribute());
   builder->Double(d);
   return NoError();
 }
@@ -3404,16 +3441,16 @@ CheckedError Parser::ParseFlexBufferValue(flexbuffers::Builder *builder) {
       break;
     }
     case kTokenStringConstant:
-      builder->String(attribute_);
+      builder->String(Attribute());
       EXPECT(kTokenStringConstant);
       break;
     case kTokenIntegerConstant:
-      builder->Int(StringToInt(attribute_.c_str()));
+      builder->Int(StringToInt(Attribute().c_str()));
       EXPECT(kTokenIntegerConstant);
       break;
     case kTokenFloatConstant: {
       double d;
-      StringToNumber(attribute_.c_str(), &d);
+      StringToNumber(Attribute().c_str(), &d);
       builder->Double(d);
       EXPECT(kTokenFloatConstant);
       break;
@@ -3425,7 +3462,7 @@ CheckedError Parser::ParseFlexBufferValue(flexbuffers::Builder *builder) {
       NEXT();
       if (token_ != kTokenIdentifier)
         return Error("floating-point constant expected");
-      attribute_.insert(size_t(0), size_t(1), sign);
+      SetAttribute(sign + Attribute());
       ECHECK(ParseFlexBufferNumericConstant(builder));
       NEXT();
       break;
@@ -3470,6 +3507,7 @@ bool Parser::Parse(const char *source, const char **include_paths,
     r = ParseFlexBuffer(source, source_filename, &flex_builder_);
   } else {
     r = !ParseRoot(source, include_paths, source_filename).Check();
+    loaded_includes_.clear();
   }
   FLATBUFFERS_ASSERT(initial_depth == parse_depth_counter_);
   return r;
@@ -3548,7 +3586,7 @@ CheckedError Parser::ParseRoot(const char *source, const char **include_paths,
                          NumToString(initial_count) +
                          " use(s) of pre-declaration enum not accounted for: " +
                          enum_def->name);
-          structs_.dict.erase(structs_.dict.find(struct_def.name));
+          structs_.Erase(struct_def.name);
           it = structs_.vec.erase(it);
           delete &struct_def;
           continue;  // Skip error.
@@ -3582,8 +3620,10 @@ CheckedError Parser::ParseRoot(const char *source, const char **include_paths,
     }
   }
 
+  ECHECK(ResolveColumnarFields());
   auto err = CheckPrivateLeak();
   if (err.Check()) return err;
+  ECHECK(CheckFixedLayouts());
 
   // Parse JSON object only if the scheme has been parsed.
   if (token_ == '{') { ECHECK(DoParseJson()); }
@@ -3630,6 +3670,143 @@ CheckedError Parser::CheckPrivateLeak() {
   return NoError();
 }
 
+// Tables with a `fixed_layout` attribute are laid out at compile time, which
+// needs all their fields to be present in every instance.
+CheckedError Parser::CheckFixedLayouts() {
+  for (auto it = structs_.vec.begin(); it != structs_.vec.end(); ++it) {
+    const auto &struct_def = **it;
+    if (struct_def.fixed || !struct_def.attributes.Lookup("fixed_layout")) {
+      continue;
+    }
+    for (auto fld_it = struct_def.fields.vec.begin();
+         fld_it != struct_def.fields.vec.end(); ++fld_it) {
+      const auto &field = **fld_it;
+      if (field.deprecated) continue;
+      const auto &type = field.value.type;
+      std::string problem;
+      if (field.IsScalarOptional()) {
+        problem = "can't be optional";
+      } else if (IsUnion(type) || type.base_type == BASE_TYPE_UTYPE) {
+        problem = "can't be a union";
+      } else if (field.offset64) {
+        problem = "can't use 64-bit offsets";
+      } else if (!IsScalar(type.base_type) && !field.IsRequired()) {
+        problem = "must be required";
+      }
+      if (!problem.empty()) {
+        return Error("field " + field.name + " of fixed_layout table " +
+                     struct_def.name + " " + problem);
+      }
+    }
+  }
+  return NoError();
+}
+
+// A `columnar` vector of tables `[Row]` is stored as a companion table
+// `RowColumns` holding one vector per field of `Row`. The companion names the
+// table it was made from in its own `columnar` attribute, which is how
+// generators and binary schemas recognize it.
+CheckedError Parser::ResolveColumnarFields() {
+  // Companion tables are appended to structs_ but never need resolving.
+  const size_t num_structs = structs_.vec.size();
+  for (size_t i = 0; i < num_structs; i++) {
+    const auto &struct_def = *structs_.vec[i];
+    for (auto fld_it = struct_def.fields.vec.begin();
+         fld_it != struct_def.fields.vec.end(); ++fld_it) {
+      auto &field = **fld_it;
+      if (!field.attributes.Lookup("columnar")) continue;
+      auto &type = field.value.type;
+      // Already resolved by an earlier call to Parse().
+      if (type.base_type == BASE_TYPE_STRUCT &&
+          type.struct_def->attributes.Lookup("columnar")) {
+        continue;
+      }
+      if (type.base_type != BASE_TYPE_VECTOR ||
+          type.element != BASE_TYPE_STRUCT || type.struct_def->fixed) {
+        return Error("columnar field " + field.name + " of " +
+                     struct_def.name + " must be a vector of tables");
+      }
+      const auto &row = *type.struct_def;
+      const auto row_name =
+          row.defined_namespace->GetFullyQualifiedName(row.name);
+      const auto name = row.name + "Columns";
+      const auto qualified_name =
+          row.defined_namespace->GetFullyQualifiedName(name);
+      auto columns = structs_.Lookup(qualified_name);
+      if (columns) {
+        const auto made_from = columns->attributes.Lookup("columnar");
+        if (!made_from || made_from->constant != row_name) {
+          return Error("columnar layout of " + row.name +
+                       " clashes with existing type " + qualified_name);
+        }
+        type = Type(BASE_TYPE_STRUCT, columns);
+        continue;
+      }
+
+      columns = new StructDef();
+      structs_.Add(qualified_name, columns);
+      columns->name = name;
+      columns->predecl = false;
+      columns->defined_namespace = row.defined_namespace;
+      columns->file = struct_def.file;
+      columns->declaration_file = struct_def.declaration_file;
+      columns->generated = struct_def.generated;
+      columns->doc_comment.push_back(" Columnar layout of " + row.name +
+                                     ", one vector per field.");
+      auto made_from = new Value();
+      made_from->type = Type(BASE_TYPE_STRING);
+      made_from->constant = row_name;
+      columns->attributes.Add("columnar", made_from);
+      for (auto row_it = row.fields.vec.begin(); row_it != row.fields.vec.end();
+           ++row_it) {
+        const auto &row_field = **row_it;
+        if (row_field.deprecated) continue;
+        const auto &row_type = row_field.value.type;
+        const auto valid =
+            (IsScalar(row_type.base_type) &&
+             row_type.base_type != BASE_TYPE_UTYPE &&
+             !row_field.IsScalarOptional()) ||
+            IsStruct(row_type) || (IsString(row_type) && !row_field.offset64);
+        if (!valid) {
+          return Error("field " + row_field.name + " of columnar table " +
+                       row.name +
+                       " must be a non-optional scalar, a struct or a string");
+        }
+        Type column_type(BASE_TYPE_VECTOR, row_type.struct_def,
+                         row_type.enum_def);
+        column_type.element = row_type.base_type;
+        FieldDef *column;
+        ECHECK(AddField(*columns, row_field.name, column_type, &column));
+        column->doc_comment = row_field.doc_comment;
+        if (IsScalar(row_type.base_type)) continue;
+        // A row may have no string or struct, which a vector can't hold, so
+        // such a column comes with a `[bool]` marking the rows that have it.
+        const auto present_name = row_field.name + "_present";
+        if (row.fields.Lookup(present_name)) {
+          return Error("field " + present_name + " of columnar table " +
+                       row.name + " clashes with the presence column of " +
+                       row_field.name);
+        }
+        Type present_type(BASE_TYPE_VECTOR);
+        present_type.element = BASE_TYPE_BOOL;
+        ECHECK(AddField(*columns, present_name, present_type, &column));
+        column->doc_comment.push_back(" Whether each row has a " +
+                                      row_field.name +
+                                      ". Rows past its end do.");
+      }
+      if (columns->fields.vec.empty()) {
+        return Error("columnar table " + row.name + " has no fields");
+      }
+      if (types_.Add(qualified_name,
+                     new Type(BASE_TYPE_STRUCT, columns, nullptr))) {
+        return Error("datatype already exists: " + qualified_name);
+      }
+      type = Type(BASE_TYPE_STRUCT, columns);
+    }
+  }
+  return NoError();
+}
+
 CheckedError Parser::CheckPrivatelyLeakedFields(const Definition &def,
                                                 const Definition &value_type) {
   if (!opts.no_leak_private_annotations) return NoError();
@@ -3676,33 +3853,22 @@ CheckedError Parser::DoParse(const char *source, const char **include_paths,
   // Includes must come before type declarations:
   for (;;) {
     // Parse pre-include proto statements if any:
-    if (opts.proto_mode && (attribute_ == "option" || attribute_ == "syntax" ||
-                            attribute_ == "package")) {
+    if (opts.proto_mode &&
+        (Attribute() == "option" || Attribute() == "syntax" ||
+         Attribute() == "package")) {
       ECHECK(ParseProtoDecl());
     } else if (IsIdent("native_include")) {
       NEXT();
-      native_included_files_.emplace_back(attribute_);
+      native_included_files_.emplace_back(Attribute());
       EXPECT(kTokenStringConstant);
       EXPECT(';');
     } else if (IsIdent("include") || (opts.proto_mode && IsIdent("import"))) {
       NEXT();
-      if (opts.proto_mode && attribute_ == "public") NEXT();
-      auto name = flatbuffers::PosixPath(attribute_.c_str());
+      if (opts.proto_mode && Attribute() == "public") NEXT();
+      auto name = flatbuffers::PosixPath(Attribute().c_str());
       EXPECT(kTokenStringConstant);
-      // Look for the file relative to the directory of the current file.
-      std::string filepath;
-      if (source_filename) {
-        auto source_file_directory =
-            flatbuffers::StripFileName(source_filename);
-        filepath = flatbuffers::ConCatPathFileName(source_file_directory, name);
-      }
-      if (filepath.empty() || !FileExists(filepath.c_str())) {
-        // Look for the file in include_paths.
-        for (auto paths = include_paths; paths && *paths; paths++) {
-          filepath = flatbuffers::ConCatPathFileName(*paths, name);
-          if (FileExists(filepath.c_str())) break;
-        }
-      }
+      const std::string filepath =
+          FindIncludeFile(name, source_filename, include_paths);
       if (filepath.empty())
         return Error("unable to locate include file: " + name);
       if (source_filename) {
@@ -3712,15 +3878,15 @@ CheckedError Parser::DoParse(const char *source, const char **include_paths,
         files_included_per_file_[source_filename].insert(included_file);
       }
 
-      std::string contents;
-      bool file_loaded = LoadFile(filepath.c_str(), true, &contents);
-      if (included_files_.find(HashFile(filepath.c_str(), contents.c_str())) ==
-          included_files_.end()) {
+      const LoadedInclude &include = LoadInclude(filepath);
+      if (included_files_.find(include.hash) == included_files_.end()) {
         // We found an include file that we have not parsed yet.
         // Parse it.
-        if (!file_loaded) return Error("unable to load include file: " + name);
-        ECHECK(DoParse(contents.c_str(), include_paths, filepath.c_str(),
-                       name.c_str()));
+        if (!include.loaded) {
+          return Error("unable to load include file: " + name);
+        }
+        ECHECK(DoParse(include.contents.c_str(), include_paths,
+                       filepath.c_str(), name.c_str()));
         // We generally do not want to output code for any included files:
         if (!opts.generate_all) MarkGenerated();
         // Reset these just in case the included file had them, and the
@@ -3758,7 +3924,7 @@ CheckedError Parser::DoParse(const char *source, const char **include_paths,
       ECHECK(ParseEnum(true, nullptr, source_filename));
     } else if (IsIdent("root_type")) {
       NEXT();
-      auto root_type = attribute_;
+      auto root_type = Attribute();
       EXPECT(kTokenIdentifier);
       ECHECK(ParseNamespacing(&root_type, nullptr));
       if (opts.root_type.empty()) {
@@ -3769,7 +3935,7 @@ CheckedError Parser::DoParse(const char *source, const char **include_paths,
       EXPECT(';');
     } else if (IsIdent("file_identifier")) {
       NEXT();
-      file_identifier_ = attribute_;
+      file_identifier_ = Attribute();
       EXPECT(kTokenStringConstant);
       if (file_identifier_.length() != flatbuffers::kFileIdentifierLength)
         return Error("file_identifier must be exactly " +
@@ -3778,14 +3944,14 @@ CheckedError Parser::DoParse(const char *source, const char **include_paths,
       EXPECT(';');
     } else if (IsIdent("file_extension")) {
       NEXT();
-      file_extension_ = attribute_;
+      file_extension_ = Attribute();
       EXPECT(kTokenStringConstant);
       EXPECT(';');
     } else if (IsIdent("include")) {
       return Error("includes must come before declarations");
     } else if (IsIdent("attribute")) {
       NEXT();
-      auto name = attribute_;
+      auto name = Attribute();
       if (Is(kTokenIdentifier)) {
         NEXT();
       } else {
@@ -3806,6 +3972,38 @@ CheckedError Parser::DoParse(const char *source, const char **include_paths,
   return NoError();
 }
 
+std::string Parser::FindIncludeFile(const std::string &name,
+                                    const char *source_filename,
+                                    const char **include_paths) const {
+  // Look for the file relative to the directory of the current file.
+  std::string filepath;
+  if (source_filename) {
+    auto source_file_directory = flatbuffers::StripFileName(source_filename);
+    filepath = flatbuffers::ConCatPathFileName(source_file_directory, name);
+  }
+  if (filepath.empty() || !FileExists(filepath.c_str())) {
+    // Look for the file in include_paths.
+    for (auto paths = include_paths; paths && *paths; paths++) {
+      filepath = flatbuffers::ConCatPathFileName(*paths, name);
+      if (FileExists(filepath.c_str())) break;
+    }
+  }
+  return filepath;
+}
+
+void Parser::LoadedInclude::Load(const std::string &filepath) {
+  loaded = LoadFile(filepath.c_str(), true, &contents);
+  hash = HashFile(filepath.c_str(), contents.c_str());
+}
+
+const Parser::LoadedInclude &Parser::LoadInclude(const std::string &filepath) {
+  auto it = loaded_includes_.find(filepath);
+  if (it != loaded_includes_.end()) return it->second;
+  LoadedInclude &include = loaded_includes_[filepath];
+  include.Load(filepath);
+  return include;
+}
+
 CheckedError Parser::DoParseJson() {
   if (token_ != '{') {
     EXPECT('{');
@@ -3866,8 +4064,13 @@ static flatbuffers::Offset<
     flatbuffers::Vector<flatbuffers::Offset<reflection::KeyValue>>>
 SerializeAttributesCommon(const SymbolTable<Value> &attributes,
                           FlatBufferBuilder *builder, const Parser &parser) {
+  // Serialize in name order, so schemas serialize the same every time.
+  std::map<std::string, const Value *> sorted;
+  for (auto kv = attributes.begin(); kv != attributes.end(); ++kv) {
+    sorted[kv->first.str()] = kv->second;
+  }
   std::vector<flatbuffers::Offset<reflection::KeyValue>> attrs;
-  for (auto kv = attributes.dict.begin(); kv != attributes.dict.end(); ++kv) {
+  for (auto kv = sorted.begin(); kv != sorted.end(); ++kv) {
     auto it = parser.known_attributes_.find(kv->first);
     FLATBUFFERS_ASSERT(it != parser.known_attributes_.end());
     if (parser.opts.binary_schema_builtins || !it->second) {
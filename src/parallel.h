@@ -0,0 +1,55 @@
+/*
+ * Copyright 2024 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_PARALLEL_H_
+#define FLATBUFFERS_PARALLEL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace flatbuffers {
+
+// Calls `task(i)` for every `i` in [0, count), spread over up to
+// `num_threads` threads, and returns once all calls have finished. Tasks are
+// handed out in increasing order of `i`, but may complete in any order, so
+// each one should write its result to its own slot.
+// With `num_threads` <= 1 (or a single task) everything runs in order on the
+// calling thread, and no threads are created.
+template<typename F>
+void ParallelFor(size_t count, int num_threads, const F &task) {
+  size_t workers = num_threads > 1 ? static_cast<size_t>(num_threads) : 1;
+  if (workers > count) workers = count;
+  if (workers <= 1) {
+    for (size_t i = 0; i < count; i++) task(i);
+    return;
+  }
+  std::atomic<size_t> next(0);
+  auto worker = [&]() {
+    for (size_t i = next++; i < count; i = next++) task(i);
+  };
+  std::vector<std::thread> threads;
+  threads.reserve(workers - 1);
+  for (size_t t = 1; t < workers; t++) threads.emplace_back(worker);
+  // The calling thread does its share of the work too.
+  worker();
+  for (auto &thread : threads) thread.join();
+}
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_PARALLEL_H_
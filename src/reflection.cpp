@@ -608,6 +608,202 @@ uint8_t *ResizeAnyVector(const reflection::Schema &schema, uoffset_t newsize,
   return flatbuf->data() + start;
 }
 
+void ResizeBatch::SetString(const std::string &val, const String *str) {
+  AddEdit(reinterpret_cast<const uint8_t *>(str), str->size(),
+          static_cast<uoffset_t>(val.size()), 1, val, true);
+}
+
+void ResizeBatch::ResizeAnyVector(uoffset_t newsize, const VectorOfAny *vec,
+                                  uoffset_t num_elems, uoffset_t elem_size) {
+  AddEdit(reinterpret_cast<const uint8_t *>(vec), num_elems, newsize,
+          elem_size, std::string(elem_size, 0), false);
+}
+
+void ResizeBatch::AddEdit(const uint8_t *object, uoffset_t old_len,
+                          uoffset_t new_len, uoffset_t elem_size,
+                          const std::string &data, bool is_string) {
+  Edit edit;
+  edit.object = static_cast<uoffset_t>(object - flatbuf_->data());
+  edit.point = edit.object + static_cast<uoffset_t>(sizeof(uoffset_t)) +
+               old_len * elem_size;
+  // Same rounding as ResizeContext, so everything after the point stays
+  // aligned.
+  auto delta = (static_cast<int>(new_len) - static_cast<int>(old_len)) *
+               static_cast<int>(elem_size);
+  auto mask = static_cast<int>(sizeof(largest_scalar_t) - 1);
+  edit.delta = (delta + mask) & ~mask;
+  edit.old_len = old_len;
+  edit.new_len = new_len;
+  edit.elem_size = elem_size;
+  edit.data = data;
+  edit.is_string = is_string;
+  edits_.push_back(edit);
+}
+
+int64_t ResizeBatch::Shift(uoffset_t loc) const {
+  // Bytes inserted at a point end up before anything living at that point.
+  auto it = std::upper_bound(
+      edits_.begin(), edits_.end(), loc,
+      [](uoffset_t l, const Edit &edit) { return l < edit.point; });
+  return it == edits_.begin() ? 0 : shifts_[it - edits_.begin() - 1];
+}
+
+// Adjust the offset of type T at "loc", which encodes the distance between
+// "from" and "to" in the unmodified buffer.
+template<typename T>
+void ResizeBatch::FixOffset(uoffset_t loc, uoffset_t from, uoffset_t to) {
+  auto diff = Shift(to) - Shift(from);
+  if (!diff) return;
+  auto p = flatbuf_->data() + loc;
+  WriteScalar<T>(p, static_cast<T>(ReadScalar<T>(p) + diff));
+}
+
+void ResizeBatch::FixTable(const reflection::Object &objectdef,
+                           uoffset_t tableloc) {
+  if (Visited(tableloc)) return;  // Table already visited.
+  Visited(tableloc) = true;
+  auto buf = flatbuf_->data();
+  auto &table = *reinterpret_cast<Table *>(buf + tableloc);
+  auto fielddefs = objectdef.fields();
+  // First recurse into all children while the offsets in this table are
+  // still untouched (union vectors need to read their type vector), then
+  // adjust the offsets themselves.
+  for (int pass = 0; pass < 2; pass++) {
+    for (auto it = fielddefs->begin(); it != fielddefs->end(); ++it) {
+      auto &fielddef = **it;
+      auto base_type = fielddef.type()->base_type();
+      // Ignore scalars.
+      if (base_type <= reflection::Double) continue;
+      // Ignore fields that are not stored.
+      auto offset = table.GetOptionalFieldOffset(fielddef.offset());
+      if (!offset) continue;
+      // Ignore structs.
+      auto subobjectdef =
+          base_type == reflection::Obj
+              ? schema_.objects()->Get(fielddef.type()->index())
+              : nullptr;
+      if (subobjectdef && subobjectdef->is_struct()) continue;
+      auto offsetloc = tableloc + offset;
+      auto ref = offsetloc + ReadScalar<uoffset_t>(buf + offsetloc);
+      if (pass) {
+        FixOffset<uoffset_t>(offsetloc, offsetloc, ref);
+        continue;
+      }
+      switch (base_type) {
+        case reflection::Obj: FixTable(*subobjectdef, ref); break;
+        case reflection::Union:
+          FixTable(GetUnionType(schema_, objectdef, fielddef, table), ref);
+          break;
+        case reflection::Vector: FixVector(fielddef, table, ref); break;
+        case reflection::String: break;
+        default: FLATBUFFERS_ASSERT(false);
+      }
+    }
+  }
+  // Must do this last, since GetOptionalFieldOffset above still reads it.
+  auto vtable = static_cast<uoffset_t>(table.GetVTable() - buf);
+  FixOffset<soffset_t>(tableloc, vtable, tableloc);
+}
+
+void ResizeBatch::FixVector(const reflection::Field &fielddef,
+                            const Table &table, uoffset_t vecloc) {
+  auto elem_type = fielddef.type()->element();
+  auto elemobjectdef = elem_type == reflection::Obj
+                           ? schema_.objects()->Get(fielddef.type()->index())
+                           : nullptr;
+  if (elemobjectdef && elemobjectdef->is_struct()) return;
+  if (elem_type != reflection::Obj && elem_type != reflection::String &&
+      elem_type != reflection::Union)
+    return;
+  if (Visited(vecloc)) return;  // Vector shared with another table.
+  Visited(vecloc) = true;
+  auto buf = flatbuf_->data();
+  const Vector<uint8_t> *types = nullptr;
+  const reflection::Enum *enumdef = nullptr;
+  if (elem_type == reflection::Union) {
+    types = table.GetPointer<const Vector<uint8_t> *>(fielddef.offset() -
+                                                      sizeof(voffset_t));
+    enumdef = schema_.enums()->Get(fielddef.type()->index());
+    if (!types) return;
+  }
+  auto size = ReadScalar<uoffset_t>(buf + vecloc);
+  for (uoffset_t i = 0; i < size; i++) {
+    auto loc = vecloc + static_cast<uoffset_t>(sizeof(uoffset_t)) * (i + 1);
+    auto dest = loc + ReadScalar<uoffset_t>(buf + loc);
+    if (elemobjectdef) {
+      FixTable(*elemobjectdef, dest);
+    } else if (types) {
+      auto enumval = enumdef->values()->LookupByKey(types->Get(i));
+      auto union_type = enumval ? enumval->union_type() : nullptr;
+      if (union_type && union_type->base_type() == reflection::Obj) {
+        auto unionobjectdef = schema_.objects()->Get(union_type->index());
+        if (!unionobjectdef->is_struct()) FixTable(*unionobjectdef, dest);
+      }
+    }
+    FixOffset<uoffset_t>(loc, loc, dest);
+  }
+}
+
+void ResizeBatch::Apply() {
+  if (edits_.empty()) return;
+  auto &buf = *flatbuf_;
+  std::sort(edits_.begin(), edits_.end(), [](const Edit &a, const Edit &b) {
+    return a.point < b.point;
+  });
+  shifts_.resize(edits_.size());
+  int64_t total = 0;
+  for (size_t i = 0; i < edits_.size(); i++) {
+    // Edits must not overlap (e.g. two edits of the same string).
+    FLATBUFFERS_ASSERT(!i || edits_[i].object >= edits_[i - 1].point);
+    total += edits_[i].delta;
+    shifts_[i] = total;
+  }
+  // Now change all the offsets in a single pass over the buffer.
+  visited_.assign(buf.size() / sizeof(uoffset_t) + 1, false);
+  auto root = ReadScalar<uoffset_t>(buf.data());
+  FixTable(root_table_ ? *root_table_ : *schema_.root_table(), root);
+  FixOffset<uoffset_t>(0, 0, root);
+  // Clear old data we don't want remaining in the buffer: all of a string
+  // (it gets overwritten below), or the elements a vector is losing.
+  for (auto it = edits_.begin(); it != edits_.end(); ++it) {
+    auto keep = it->is_string ? 0 : std::min(it->old_len, it->new_len);
+    auto start = it->object + static_cast<uoffset_t>(sizeof(uoffset_t)) +
+                 keep * it->elem_size;
+    memset(buf.data() + start, 0, it->point - start);
+  }
+  // Move all bytes to their new location, inserting zeroes / removing
+  // (already cleared) bytes at each point.
+  std::vector<uint8_t> resized;
+  resized.reserve(
+      static_cast<size_t>(static_cast<int64_t>(buf.size()) + total));
+  size_t pos = 0;
+  for (auto it = edits_.begin(); it != edits_.end(); ++it) {
+    auto end = static_cast<size_t>(static_cast<int64_t>(it->point) +
+                                   std::min(it->delta, 0));
+    resized.insert(resized.end(), buf.begin() + pos, buf.begin() + end);
+    if (it->delta > 0) resized.insert(resized.end(), it->delta, 0);
+    pos = it->point;
+  }
+  resized.insert(resized.end(), buf.begin() + pos, buf.end());
+  buf.swap(resized);
+  // Finally write the new lengths and contents.
+  for (auto it = edits_.begin(); it != edits_.end(); ++it) {
+    auto object = buf.data() + it->object + Shift(it->object);
+    WriteScalar(object, it->new_len);
+    auto data = object + sizeof(uoffset_t);
+    if (it->is_string) {
+      memcpy(data, it->data.c_str(), it->new_len + 1);
+    } else {
+      for (auto i = it->old_len; i < it->new_len; i++) {
+        memcpy(data + i * it->elem_size, it->data.data(), it->elem_size);
+      }
+    }
+  }
+  edits_.clear();
+  shifts_.clear();
+  visited_.clear();
+}
+
 const uint8_t *AddFlatBuffer(std::vector<uint8_t> &flatbuf,
                              const uint8_t *newbuf, size_t newlen) {
   // Align to sizeof(uoffset_t) past sizeof(largest_scalar_t) since we're
@@ -47,6 +47,13 @@
 
 #include <sys/stat.h>
 
+#if !defined(_WIN32) && (defined(__unix__) || defined(__APPLE__))
+#  define FLATBUFFERS_MMAP 1
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
 #include <clocale>
 #include <cstdlib>
 #include <fstream>
@@ -83,8 +90,17 @@ static bool LoadFileRaw(const char *name, bool binary, std::string *buf) {
   return !ifs.bad();
 }
 
+static bool SaveFileRaw(const char *name, const char *buf, size_t len,
+                        bool binary) {
+  std::ofstream ofs(name, binary ? std::ofstream::binary : std::ofstream::out);
+  if (!ofs.is_open()) return false;
+  ofs.write(buf, len);
+  return !ofs.bad();
+}
+
 LoadFileFunction g_load_file_function = LoadFileRaw;
 FileExistsFunction g_file_exists_function = FileExistsRaw;
+SaveFileFunction g_save_file_function = SaveFileRaw;
 
 static std::string ToCamelCase(const std::string &input, bool is_upper) {
   std::string s;
@@ -238,6 +254,74 @@ bool DirExists(const char *name) {
   return (file_info.st_mode & FLATBUFFERS_S_IFDIR) != 0;
 }
 
+bool MappedFile::Open(const char *name) {
+  Close();
+  // A custom loader decides what the contents are, respect it.
+  if (g_load_file_function == LoadFileRaw && !DirExists(name)) {
+    // clang-format off
+    #if defined(_WIN32)
+      HANDLE file = CreateFileA(name, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (file != INVALID_HANDLE_VALUE) {
+        LARGE_INTEGER file_size;
+        if (GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0 &&
+            static_cast<uint64_t>(file_size.QuadPart) <=
+                static_cast<uint64_t>((std::numeric_limits<size_t>::max)())) {
+          HANDLE mapping =
+              CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+          if (mapping) {
+            // The view keeps the mapping alive once the handles are closed.
+            mapping_ = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            size_ = static_cast<size_t>(file_size.QuadPart);
+            CloseHandle(mapping);
+          }
+        }
+        CloseHandle(file);
+      }
+    #elif defined(FLATBUFFERS_MMAP)
+      const int fd = open(name, O_RDONLY);
+      if (fd >= 0) {
+        struct stat file_info;
+        if (fstat(fd, &file_info) == 0 && file_info.st_size > 0 &&
+            static_cast<uint64_t>(file_info.st_size) <=
+                static_cast<uint64_t>((std::numeric_limits<size_t>::max)())) {
+          size_ = static_cast<size_t>(file_info.st_size);
+          void *mapping = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+          if (mapping != MAP_FAILED) mapping_ = mapping;
+        }
+        close(fd);
+      }
+    #endif
+    // clang-format on
+    if (mapping_) {
+      data_ = static_cast<const uint8_t *>(mapping_);
+      return true;
+    }
+    size_ = 0;
+  }
+  // Empty files can't be mapped, and mapping may fail on some file systems.
+  if (!LoadFile(name, true, &copy_)) return false;
+  data_ = reinterpret_cast<const uint8_t *>(copy_.data());
+  size_ = copy_.size();
+  return true;
+}
+
+void MappedFile::Close() {
+  if (mapping_) {
+    // clang-format off
+    #if defined(_WIN32)
+      UnmapViewOfFile(mapping_);
+    #elif defined(FLATBUFFERS_MMAP)
+      munmap(mapping_, size_);
+    #endif
+    // clang-format on
+    mapping_ = nullptr;
+  }
+  std::string().swap(copy_);
+  data_ = nullptr;
+  size_ = 0;
+}
+
 LoadFileFunction SetLoadFileFunction(LoadFileFunction load_file_function) {
   LoadFileFunction previous_function = g_load_file_function;
   g_load_file_function = load_file_function ? load_file_function : LoadFileRaw;
@@ -252,11 +336,40 @@ FileExistsFunction SetFileExistsFunction(
   return previous_function;
 }
 
+SaveFileFunction SetSaveFileFunction(SaveFileFunction save_file_function) {
+  SaveFileFunction previous_function = g_save_file_function;
+  g_save_file_function = save_file_function ? save_file_function : SaveFileRaw;
+  return previous_function;
+}
+
 bool SaveFile(const char *name, const char *buf, size_t len, bool binary) {
-  std::ofstream ofs(name, binary ? std::ofstream::binary : std::ofstream::out);
-  if (!ofs.is_open()) return false;
-  ofs.write(buf, len);
-  return !ofs.bad();
+  FLATBUFFERS_ASSERT(g_save_file_function);
+  return g_save_file_function(name, buf, len, binary);
+}
+
+bool SaveFileIfChanged(const char *name, const char *buf, size_t len,
+                       bool binary, bool *changed) {
+  if (changed) *changed = false;
+  if (!DirExists(name)) {
+    std::ifstream ifs(name, std::ifstream::binary);
+    if (ifs.is_open()) {
+      ifs.seekg(0, std::ios::end);
+      auto size = static_cast<size_t>(ifs.tellg());
+      ifs.close();
+      // Text mode may translate newlines, so only a binary file can be told
+      // apart by its size alone.
+      bool same = false;
+      if (size == len || (!binary && size > len)) {
+        std::string existing;
+        same = LoadFileRaw(name, binary, &existing) &&
+               existing.size() == len &&
+               (!len || memcmp(existing.data(), buf, len) == 0);
+      }
+      if (same) return true;
+    }
+  }
+  if (changed) *changed = true;
+  return SaveFileRaw(name, buf, len, binary);
 }
 
 // We internally store paths in posix format ('/'). Paths supplied
@@ -0,0 +1,159 @@
+#include "columnar_test.h"
+
+#include <string>
+
+#include "flatbuffers/flatbuffer_builder.h"
+#include "flatbuffers/idl.h"
+#include "flatbuffers/reflection_generated.h"
+#include "test_assert.h"
+#include "tests/columnar_test_generated.h"
+
+namespace flatbuffers {
+namespace tests {
+
+using namespace columnar_test;
+
+void ColumnarTest() {
+  // Rows built the usual way, as a vector of tables.
+  FlatBufferBuilder row_builder;
+  const Vec2 pos(1.5f, -2.0f);
+  std::vector<Offset<Sample>> samples;
+  samples.push_back(CreateSample(row_builder, 1, 0.25, Kind_Area, true, &pos,
+                                 row_builder.CreateString("first")));
+  samples.push_back(CreateSample(row_builder, 2));
+  samples.push_back(CreateSample(row_builder, 3, -4.0, Kind_Point, false,
+                                 nullptr, row_builder.CreateString("third")));
+  row_builder.Finish(row_builder.CreateVector(samples));
+  const auto rows = GetRoot<Vector<Offset<Sample>>>(
+      row_builder.GetBufferPointer());
+
+  // Transposed into one vector per field.
+  FlatBufferBuilder builder;
+  const auto label = builder.CreateString("series");
+  const auto columns = CreateSampleColumnsFromRows(builder, rows);
+  FinishSeriesBuffer(builder, CreateSeries(builder, label, columns));
+  Verifier verifier(builder.GetBufferPointer(), builder.GetSize());
+  TEST_ASSERT(VerifySeriesBuffer(verifier));
+
+  const auto series = GetSeries(builder.GetBufferPointer());
+  TEST_EQ_STR(series->label()->c_str(), "series");
+  const auto cols = series->samples();
+  TEST_EQ(cols->num_rows(), 3u);
+  TEST_EQ(cols->id()->size(), 3u);
+  TEST_EQ(cols->id()->Get(0), 1u);
+  TEST_EQ(cols->id()->Get(2), 3u);
+  TEST_EQ(cols->value()->Get(1), 1.5);
+  TEST_EQ(cols->kind()->Get(0), Kind_Area);
+  TEST_EQ(cols->pos()->Get(0)->x(), 1.5f);
+
+  // The rows without a pos or a name are marked in the presence columns,
+  // which end at the last such row.
+  TEST_EQ(cols->pos_present()->size(), 3u);
+  TEST_EQ(cols->pos_present()->Get(0), 1);
+  TEST_EQ(cols->pos_present()->Get(1), 0);
+  TEST_EQ(cols->pos_present()->Get(2), 0);
+  TEST_EQ(cols->name_present()->size(), 2u);
+  TEST_EQ(cols->name_present()->Get(0), 1);
+  TEST_EQ(cols->name_present()->Get(1), 0);
+
+  // Rows read back through the row view, like a Sample.
+  const auto first = cols->row(0);
+  TEST_EQ(first.id(), 1u);
+  TEST_EQ(first.value(), 0.25);
+  TEST_EQ(first.kind(), Kind_Area);
+  TEST_EQ(first.valid(), true);
+  TEST_EQ(first.pos()->y(), -2.0f);
+  TEST_EQ_STR(first.name()->c_str(), "first");
+  const auto third = cols->row(2);
+  TEST_EQ(third.id(), 3u);
+  TEST_EQ(third.value(), -4.0);
+  TEST_EQ(third.kind(), Kind_Point);
+  TEST_EQ(third.valid(), false);
+  TEST_NULL(third.pos());
+  TEST_EQ_STR(third.name()->c_str(), "third");
+
+  // Like in the Sample it was made from, an absent name or pos is null.
+  const auto second = cols->row(1);
+  TEST_NULL(rows->Get(1)->pos());
+  TEST_NULL(second.pos());
+  TEST_NULL(rows->Get(1)->name());
+  TEST_NULL(second.name());
+
+  // Presence columns are left out when every row has the field.
+  FlatBufferBuilder full_row_builder;
+  const Offset<Sample> full_samples[] = {
+    CreateSample(full_row_builder, 1, 0, Kind_Area, true, &pos,
+                 full_row_builder.CreateString("a")),
+  };
+  full_row_builder.Finish(full_row_builder.CreateVector(full_samples, 1));
+  const auto full_rows = GetRoot<Vector<Offset<Sample>>>(
+      full_row_builder.GetBufferPointer());
+  FlatBufferBuilder full_builder;
+  FinishSeriesBuffer(
+      full_builder,
+      CreateSeries(full_builder, 0,
+                   CreateSampleColumnsFromRows(full_builder, full_rows)));
+  const auto full = GetSeries(full_builder.GetBufferPointer())->samples();
+  TEST_NULL(full->pos_present());
+  TEST_NULL(full->name_present());
+  TEST_EQ_STR(full->row(0).name()->c_str(), "a");
+  TEST_EQ(full->row(0).pos()->x(), 1.5f);
+
+  // Absent columns and cells past the end read as the defaults.
+  FlatBufferBuilder sparse_builder;
+  const uint32_t ids[] = { 7, 8 };
+  FinishSeriesBuffer(
+      sparse_builder,
+      CreateSeries(sparse_builder, 0,
+                   CreateSampleColumns(sparse_builder,
+                                       sparse_builder.CreateVector(ids, 2))));
+  const auto sparse = GetSeries(sparse_builder.GetBufferPointer())->samples();
+  TEST_EQ(sparse->num_rows(), 2u);
+  TEST_EQ(sparse->row(1).id(), 8u);
+  TEST_EQ(sparse->row(1).value(), 1.5);
+  TEST_EQ(sparse->row(1).kind(), Kind_Line);
+  TEST_NULL(sparse->row(1).pos());
+  TEST_NULL(sparse->row(1).name());
+  TEST_EQ(sparse->row(5).id(), 0u);
+
+  // The object API carries the columns as vectors.
+  SeriesT object;
+  series->UnPackTo(&object);
+  TEST_EQ(object.samples->id.size(), 3u);
+  TEST_EQ(object.samples->kind[2], Kind_Point);
+
+  // The schema, JSON and reflection see the companion table.
+  const char *schema =
+      "table Row { a:int = 5; b:string; }\n"
+      "table Rows { rows:[Row] (columnar); }\n"
+      "root_type Rows;";
+  IDLOptions opts;
+  opts.binary_schema_builtins = true;
+  Parser parser(opts);
+  TEST_ASSERT(parser.Parse(schema));
+  TEST_ASSERT(parser.Parse("{ rows: { a: [1, 2], b: [\"x\", \"y\"] } }"));
+  std::string json;
+  TEST_NULL(GenText(parser, parser.builder_.GetBufferPointer(), &json));
+  TEST_NOTNULL(strstr(json.c_str(), "rows: {"));
+  parser.Serialize();
+  const auto bfbs = reflection::GetSchema(parser.builder_.GetBufferPointer());
+  const auto rows_def = bfbs->objects()->LookupByKey("Rows");
+  const auto columns_def = bfbs->objects()->LookupByKey("RowColumns");
+  TEST_NOTNULL(rows_def);
+  TEST_NOTNULL(columns_def);
+  const auto rows_field = rows_def->fields()->LookupByKey("rows");
+  TEST_EQ(rows_field->type()->base_type(), reflection::Obj);
+  TEST_EQ(bfbs->objects()->Get(rows_field->type()->index()), columns_def);
+  const auto made_from = columns_def->attributes()->LookupByKey("columnar");
+  TEST_EQ_STR(made_from->value()->c_str(), "Row");
+  const auto a_column = columns_def->fields()->LookupByKey("a");
+  TEST_EQ(a_column->type()->base_type(), reflection::Vector);
+  TEST_EQ(a_column->type()->element(), reflection::Int);
+  TEST_NULL(columns_def->fields()->LookupByKey("a_present"));
+  const auto b_present = columns_def->fields()->LookupByKey("b_present");
+  TEST_EQ(b_present->type()->base_type(), reflection::Vector);
+  TEST_EQ(b_present->type()->element(), reflection::Bool);
+}
+
+}  // namespace tests
+}  // namespace flatbuffers
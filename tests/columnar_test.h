@@ -0,0 +1,12 @@
+#ifndef TESTS_COLUMNAR_TEST_H
+#define TESTS_COLUMNAR_TEST_H
+
+namespace flatbuffers {
+namespace tests {
+
+void ColumnarTest();
+
+}  // namespace tests
+}  // namespace flatbuffers
+
+#endif
@@ -24,6 +24,7 @@
 #include "flatbuffers/flexbuffers.h"
 #include "flatbuffers/idl.h"
 #include "flatbuffers/minireflect.h"
+#include "flatbuffers/native_arena.h"
 #include "flatbuffers/registry.h"
 #include "flatbuffers/util.h"
 #include "stringify_util.h"
@@ -31,6 +32,7 @@
 
 // Embed generated code into an isolated namespace.
 namespace cpp17 {
+#include "generated_cpp17/arena_test_generated.h"
 #include "generated_cpp17/monster_test_generated.h"
 #include "generated_cpp17/optional_scalars_generated.h"
 #include "generated_cpp17/union_vector_generated.h"
@@ -175,6 +177,66 @@ void StringifyAnyFlatbuffersTypeTest() {
   TEST_EQ_STR(expected.c_str(), result->c_str());
 }
 
+/*******************************************************************************
+** Test Case: FlatBufferToString without a TypeTable.
+*******************************************************************************/
+// The static reflection traits also drive the mini reflection visitors, which
+// should produce the same text as the TypeTable based iteration.
+void StaticFlatBufferToStringTest() {
+  using namespace ::cpp17::MyGame::Example;
+  flatbuffers::FlatBufferBuilder fbb;
+  auto barney = fbb.CreateString("Barney");
+  MonsterBuilder enemy_builder(fbb);
+  enemy_builder.add_name(barney);
+  enemy_builder.add_hp(1000);
+  enemy_builder.add_color(Color::Red);
+  auto enemy = enemy_builder.Finish();
+  auto name = fbb.CreateString("Fred");
+  auto inventory = fbb.CreateVector(std::vector<uint8_t>{ 0, 1, 2 });
+  std::vector<Test> tests = { Test(10, 20), Test(30, 40) };
+  auto test4 = fbb.CreateVectorOfStructs(tests);
+  auto strings = fbb.CreateVectorOfStrings({ "bob", "fr\"ed" });
+  auto tables = fbb.CreateVector(std::vector<flatbuffers::Offset<Monster>>{
+      enemy, enemy });
+  auto enums = fbb.CreateVector(
+      std::vector<Color>{ Color::Blue, Color::Green, static_cast<Color>(3) });
+  auto longs = fbb.CreateVector(std::vector<int64_t>{
+      -1, 1LL << 40, std::numeric_limits<int64_t>::min() });
+  // 1e300 is too large for the fast float formatting.
+  auto doubles =
+      fbb.CreateVector(std::vector<double>{ 1.5, -0.25, 1e300, -1e-9 });
+  auto vec3 = Vec3(1, 2, 3, 0.5, Color::Green, Test(5, 6));
+  MonsterBuilder builder(fbb);
+  builder.add_pos(&vec3);
+  builder.add_name(name);
+  builder.add_hp(80);
+  builder.add_inventory(inventory);
+  builder.add_color(Color::Blue);
+  builder.add_test_type(Any::Monster);
+  builder.add_test(enemy.Union());
+  builder.add_test4(test4);
+  builder.add_testarrayofstring(strings);
+  builder.add_testarrayoftables(tables);
+  builder.add_enemy(enemy);
+  builder.add_testbool(true);
+  builder.add_testf(3.25f);
+  builder.add_vector_of_enums(enums);
+  builder.add_vector_of_longs(longs);
+  builder.add_vector_of_doubles(doubles);
+  builder.add_signed_enum(Race::Elf);
+  fbb.Finish(builder.Finish());
+
+  auto type_table = Monster::MiniReflectTypeTable();
+  auto buf = fbb.GetBufferPointer();
+  TEST_EQ_STR(flatbuffers::FlatBufferToString<Monster>(buf).c_str(),
+              flatbuffers::FlatBufferToString(buf, type_table).c_str());
+  TEST_EQ_STR(
+      flatbuffers::FlatBufferToString<Monster>(buf, true, false, "  ", true)
+          .c_str(),
+      flatbuffers::FlatBufferToString(buf, type_table, true, false, "  ", true)
+          .c_str());
+}
+
 /*******************************************************************************
 ** Test Traits::FieldType
 *******************************************************************************/
@@ -255,10 +317,93 @@ void OptionalScalarsTest() {
   TEST_ASSERT(opts->maybe_i32() == std::optional<int64_t>(-1));
 }
 
+void ArenaObjectApiTest() {
+  using namespace cpp17::arena_test;
+  flatbuffers::FlatBufferBuilder fbb;
+  const Price price(1234, 2);
+  std::vector<flatbuffers::Offset<Level>> levels;
+  for (int64_t i = 0; i < 3; i++) {
+    const Price level_price(100 + i, 2);
+    levels.push_back(CreateLevel(
+        fbb, &level_price, 10 * i,
+        fbb.CreateVectorOfStrings({ "a long venue name, not inline", "x" })));
+  }
+  const auto levels_vec = fbb.CreateVector(levels);
+  const std::vector<Side> sides = { Side::Ask, Side::Bid };
+  const std::vector<uint8_t> flags = { 1, 0, 1 };
+  const std::vector<uint64_t> ids = { 7, 8, 9 };
+  const auto note = CreateNote(fbb, fbb.CreateString("note"));
+  const auto symbol = fbb.CreateString("SYMBOL-WITH-A-LONG-NAME");
+  const auto tags = fbb.CreateVectorOfStrings({ "tag" });
+  FinishBookBuffer(
+      fbb, CreateBook(fbb, symbol, Side::Bid, &price, levels[0], levels_vec,
+                      levels_vec, 0, fbb.CreateVector(sides),
+                      fbb.CreateVector(flags), fbb.CreateVector(ids), tags,
+                      Extra::Note, note.Union()));
+
+  std::pmr::monotonic_buffer_resource arena;
+  {
+    auto book = UnPackBook(fbb.GetBufferPointer(), nullptr, &arena);
+    TEST_ASSERT(book.get_deleter().resource == &arena);
+    TEST_ASSERT(book->symbol == "SYMBOL-WITH-A-LONG-NAME");
+    TEST_ASSERT(book->symbol.get_allocator().resource() == &arena);
+    TEST_EQ(book->last->ticks(), 1234);
+    TEST_ASSERT(book->last.get_deleter().resource == &arena);
+    TEST_ASSERT(book->best->venues[0].get_allocator().resource() == &arena);
+    TEST_EQ(book->levels.size(), 3);
+    TEST_ASSERT(book->levels.get_allocator().resource() == &arena);
+    TEST_EQ(book->levels[2]->quantity, 20);
+    TEST_ASSERT(book->levels[2].get_deleter().resource == &arena);
+    TEST_EQ(book->inline_levels[1].price.ticks(), 101);
+    TEST_ASSERT(book->inline_levels[1].venues[0] ==
+                "a long venue name, not inline");
+    TEST_ASSERT(book->inline_levels[1].venues[0].get_allocator().resource() ==
+                &arena);
+    TEST_ASSERT(book->sides[0] == Side::Ask);
+    TEST_ASSERT(book->flags[0] && !book->flags[1] && book->flags[2]);
+    TEST_EQ(book->ids[2], 9);
+    TEST_ASSERT(book->tags[0] == "tag");
+    TEST_ASSERT(book->extra.AsNote()->text == "note");
+
+    // The arena-allocated tree packs like any other.
+    flatbuffers::FlatBufferBuilder fbb2;
+    FinishBookBuffer(fbb2, Book::Pack(fbb2, book.get()));
+    auto repacked = GetBook(fbb2.GetBufferPointer());
+    TEST_EQ_STR(repacked->symbol()->c_str(), "SYMBOL-WITH-A-LONG-NAME");
+    TEST_EQ(repacked->levels()->Get(2)->venues()->size(), 2);
+    TEST_EQ(repacked->inline_levels()->Get(1)->price()->ticks(), 101);
+    TEST_EQ(repacked->flags()->size(), 3);
+    TEST_EQ_STR(repacked->extra_as_Note()->text()->c_str(), "note");
+
+    // Unpacking over the tree reuses its objects.
+    auto *best = book->best.get();
+    auto *extra = book->extra.value;
+    GetBook(fbb.GetBufferPointer())->UnPackTo(book.get(), nullptr, &arena);
+    TEST_ASSERT(book->best.get() == best);
+    TEST_ASSERT(book->extra.value == extra);
+
+    // Copies are independent of the arena.
+    BookT copy(*book);
+    TEST_ASSERT(copy.symbol == book->symbol);
+    TEST_ASSERT(copy.levels[1]->venues == book->levels[1]->venues);
+    TEST_ASSERT(copy.levels[1].get_deleter().resource == nullptr);
+  }
+  arena.release();
+
+  // Without an arena, the tree is allocated as usual.
+  auto book = UnPackBook(fbb.GetBufferPointer());
+  TEST_ASSERT(book.get_deleter().resource == nullptr);
+  TEST_ASSERT(book->symbol.get_allocator().resource() ==
+              std::pmr::get_default_resource());
+  TEST_EQ(book->levels[1]->quantity, 10);
+}
+
 int FlatBufferCpp17Tests() {
   CreateTableByTypeTest();
   OptionalScalarsTest();
+  ArenaObjectApiTest();
   StringifyAnyFlatbuffersTypeTest();
+  StaticFlatBufferToStringTest();
   return 0;
 }
 }  // namespace
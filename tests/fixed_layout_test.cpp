@@ -0,0 +1,110 @@
+#include "fixed_layout_test.h"
+
+#include "flatbuffers/flatbuffer_builder.h"
+#include "test_assert.h"
+#include "tests/fixed_layout_test_generated.h"
+
+namespace flatbuffers {
+namespace tests {
+
+using namespace fixed_layout_test;
+
+void FixedLayoutTest() {
+  FlatBufferBuilder builder;
+
+  // Fields at their defaults are stored too.
+  const Vec2 pos(1.5f, -2.0f);
+  std::vector<Offset<Sample>> samples;
+  samples.push_back(
+      CreateSample(builder, 0, false, Kind_Line, &pos, 0,
+                   builder.CreateString("first")));
+  samples.push_back(CreateSample(builder, 42, true, Kind_Point, &pos,
+                                 -1234567890123LL,
+                                 builder.CreateString("second"), 9));
+  // A table built field by field the usual way reads the same.
+  const auto name = builder.CreateString("built");
+  SampleBuilder sample_builder(builder);
+  sample_builder.add_id(7);
+  sample_builder.add_pos(&pos);
+  sample_builder.add_name(name);
+  samples.push_back(sample_builder.Finish());
+  FinishSamplesBuffer(builder, CreateSamples(builder,
+                                             builder.CreateVector(samples),
+                                             builder.CreateString("label")));
+
+  Verifier verifier(builder.GetBufferPointer(), builder.GetSize());
+  TEST_ASSERT(VerifySamplesBuffer(verifier));
+
+  const auto root = GetSamples(builder.GetBufferPointer());
+  TEST_EQ_STR(root->label()->c_str(), "label");
+  TEST_EQ(root->samples()->size(), 3);
+  const auto first = root->samples()->Get(0);
+  TEST_EQ(first->id(), 0u);
+  TEST_EQ(first->flag(), false);
+  TEST_EQ(first->kind(), Kind_Line);
+  TEST_EQ(first->pos()->x(), 1.5f);
+  TEST_EQ(first->pos()->y(), -2.0f);
+  TEST_EQ(first->time(), 0);
+  TEST_EQ_STR(first->name()->c_str(), "first");
+  TEST_EQ(first->tail(), 7);
+  TEST_ASSERT(IsFieldPresent(first, Sample::VT_KIND));
+  TEST_ASSERT(IsFieldPresent(first, Sample::VT_TAIL));
+  // The slot of the deprecated field stays empty.
+  TEST_EQ(reinterpret_cast<const Table *>(first)->GetOptionalFieldOffset(
+              Sample::VT_POS - sizeof(voffset_t)),
+          0);
+  const auto second = root->samples()->Get(1);
+  TEST_EQ(second->id(), 42u);
+  TEST_EQ(second->flag(), true);
+  TEST_EQ(second->kind(), Kind_Point);
+  TEST_EQ(second->time(), -1234567890123LL);
+  TEST_EQ_STR(second->name()->c_str(), "second");
+  TEST_EQ(second->tail(), 9);
+  const auto built = root->samples()->Get(2);
+  TEST_EQ(built->id(), 7u);
+  TEST_EQ(built->kind(), Kind_Line);
+  TEST_EQ_STR(built->name()->c_str(), "built");
+
+  // The fixed layout tables share their vtable.
+  TEST_ASSERT(reinterpret_cast<const Table *>(first)->GetVTable() ==
+              reinterpret_cast<const Table *>(second)->GetVTable());
+
+  // They share it without vtable deduplication too, also after Clear().
+  FlatBufferBuilder no_dedup;
+  no_dedup.DedupVtables(false);
+  for (int i = 0; i < 2; i++) {
+    no_dedup.Clear();
+    std::vector<Offset<Sample>> pair;
+    pair.push_back(CreateSample(no_dedup, 1, false, Kind_Line, &pos, 0,
+                                no_dedup.CreateString("one")));
+    pair.push_back(CreateSample(no_dedup, 2, false, Kind_Line, &pos, 0,
+                                no_dedup.CreateString("two")));
+    FinishSamplesBuffer(no_dedup,
+                        CreateSamples(no_dedup, no_dedup.CreateVector(pair)));
+    Verifier no_dedup_verifier(no_dedup.GetBufferPointer(),
+                               no_dedup.GetSize());
+    TEST_ASSERT(VerifySamplesBuffer(no_dedup_verifier));
+    const auto no_dedup_samples =
+        GetSamples(no_dedup.GetBufferPointer())->samples();
+    TEST_EQ(no_dedup_samples->Get(0)->id(), 1u);
+    TEST_EQ(no_dedup_samples->Get(1)->id(), 2u);
+    TEST_ASSERT(reinterpret_cast<const Table *>(no_dedup_samples->Get(0))
+                    ->GetVTable() ==
+                reinterpret_cast<const Table *>(no_dedup_samples->Get(1))
+                    ->GetVTable());
+  }
+
+  // The object API packs through the fixed layout too.
+  SamplesT object;
+  root->UnPackTo(&object);
+  FlatBufferBuilder builder2;
+  FinishSamplesBuffer(builder2, Samples::Pack(builder2, &object));
+  Verifier verifier2(builder2.GetBufferPointer(), builder2.GetSize());
+  TEST_ASSERT(VerifySamplesBuffer(verifier2));
+  SamplesT object2;
+  GetSamples(builder2.GetBufferPointer())->UnPackTo(&object2);
+  TEST_ASSERT(object == object2);
+}
+
+}  // namespace tests
+}  // namespace flatbuffers
@@ -0,0 +1,12 @@
+#ifndef TESTS_FIXED_LAYOUT_TEST_H
+#define TESTS_FIXED_LAYOUT_TEST_H
+
+namespace flatbuffers {
+namespace tests {
+
+void FixedLayoutTest();
+
+}  // namespace tests
+}  // namespace flatbuffers
+
+#endif
@@ -0,0 +1,103 @@
+# Copyright 2024 Google Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import re
+import shutil
+from pathlib import Path
+
+from flatc_test import *
+
+ANNOTATED_BINARY_PATH = tests_path / "annotated_binary"
+
+# The files the tests annotate, copied so the outputs land next to them.
+FILES = ["annotated_binary.fbs", "annotated_binary.bin"]
+
+
+# Returns the sections of an annotated binary: the file without its header
+# comments, with the columns (which a streamed output may widen as it goes)
+# squeezed.
+def read_sections(file):
+    return [
+        re.sub(" +", " ", line)
+        for line in Path(file).read_text().splitlines()
+        if not line.startswith("//")
+    ]
+
+
+# Annotates annotated_binary.bin in `path` with the extra `options`, and
+# returns the sections written.
+def annotate(path, options=[]):
+    flatc_ok(["--annotate", "annotated_binary.fbs"] + options
+             + ["annotated_binary.bin"], path)
+    return read_sections(Path(path, "annotated_binary.afb"))
+
+
+class AnnotateTests:
+    def StreamingMatchesFullOutput(self):
+        with TempDir() as tmp:
+            for name in FILES:
+                shutil.copyfile(str(ANNOTATED_BINARY_PATH / name),
+                                str(Path(tmp, name)))
+            full = annotate(tmp)
+            assert_equal(
+                full,
+                read_sections(ANNOTATED_BINARY_PATH / "annotated_binary.afb"),
+                "output",
+            )
+            for size in ["1", "64", "100000"]:
+                assert_equal(
+                    annotate(tmp, ["--annotate-stream", size]),
+                    full,
+                    "output streamed in batches of " + size,
+                )
+
+    def RangesConcatenateToFullOutput(self):
+        with TempDir() as tmp:
+            for name in FILES:
+                shutil.copyfile(str(ANNOTATED_BINARY_PATH / name),
+                                str(Path(tmp, name)))
+            full = annotate(tmp)
+            size = Path(tmp, "annotated_binary.bin").stat().st_size
+            # No section starts in 0x30:0x44, which is within the vtable of
+            # the root table.
+            bounds = [0, 0x30, 0x44, 0x100, 0x123, size]
+            ranges = []
+            for begin, end in zip(bounds, bounds[1:]):
+                ranges += annotate(
+                    tmp, ["--annotate-range", "{0}:{1}".format(begin, end)]
+                )
+            assert_equal(ranges, full, "output of the ranges")
+
+            # An open bound runs to the end of the binary, and may be hex.
+            assert_equal(
+                annotate(tmp, ["--annotate-range", "0x100:"]),
+                annotate(tmp, ["--annotate-range",
+                               "256:{0}".format(size)]),
+                "output of 0x100:",
+            )
+
+    def SampleOmitsVectorElements(self):
+        with TempDir() as tmp:
+            for name in FILES:
+                shutil.copyfile(str(ANNOTATED_BINARY_PATH / name),
+                                str(Path(tmp, name)))
+            sampled = annotate(tmp, ["--annotate-sample", "2"])
+            assert any("values omitted" in line for line in sampled), sampled
+            assert len(sampled) < len(annotate(tmp)), "nothing omitted"
+            assert_equal(
+                annotate(tmp, ["--annotate-sample", "2", "--annotate-stream",
+                               "64"]),
+                sampled,
+                "sampled output streamed",
+            )
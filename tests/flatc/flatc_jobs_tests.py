@@ -0,0 +1,144 @@
+# Copyright 2024 Google Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import shutil
+from pathlib import Path
+
+from flatc_test import *
+
+MONSTER_SCHEMA = [
+    "-I",
+    tests_path / "include_test",
+    tests_path / "monster_test.fbs",
+]
+
+# Schemas for the code generation tests, in the order they're given to flatc.
+SCHEMAS = [
+    "alignment_test.fbs",
+    "monster_test.fbs",
+    "nested_union_test.fbs",
+    "vector_has_test.fbs",
+]
+
+
+# Runs flatc with `options` writing to a fresh directory, once on a single
+# thread and once with --jobs 4, and asserts both write the same files and
+# report the same messages and exit code. Returns the exit code, the output
+# and the files written.
+def assert_same_as_sequential(options, cwd):
+    runs = []
+    for jobs in ["1", "4"]:
+        out = Path(cwd, "out" + jobs)
+        code, output = flatc(["-o", out, "--jobs", jobs] + options, cwd)
+        runs.append((code, output.replace(str(out), "OUT"), read_tree(out)))
+    assert_equal(runs[1][0], runs[0][0], "exit code")
+    assert_equal(runs[1][1], runs[0][1], "messages")
+    assert_equal(sorted(runs[1][2]), sorted(runs[0][2]), "files written")
+    for name in runs[0][2]:
+        assert runs[1][2][name] == runs[0][2][name], name + " differs"
+    return runs[0]
+
+
+# Writes copies of the monster test data to d1.json, d2.json ... in `path`.
+def write_json_files(path, count):
+    names = []
+    for i in range(1, count + 1):
+        name = "d{0}.json".format(i)
+        shutil.copyfile(str(tests_path / "monsterdata_test.json"),
+                        str(Path(path, name)))
+        names.append(name)
+    return names
+
+
+class JobsTests:
+    def JsonToBinaryMatchesSequential(self):
+        with TempDir() as tmp:
+            data = write_json_files(tmp, 6)
+            code, _, files = assert_same_as_sequential(
+                ["-b"] + MONSTER_SCHEMA + data, tmp
+            )
+            assert_equal(code, 0, "exit code")
+            assert_equal(len(files), 6, "number of outputs")
+
+    def BinaryToJsonMatchesSequential(self):
+        with TempDir() as tmp:
+            data = write_json_files(tmp, 6)
+            flatc_ok(["-b", "-o", tmp] + MONSTER_SCHEMA + data, tmp)
+            binaries = [name.replace(".json", ".mon") for name in data]
+            code, _, files = assert_same_as_sequential(
+                ["-t", "--strict-json"] + MONSTER_SCHEMA + ["--"] + binaries,
+                tmp,
+            )
+            assert_equal(code, 0, "exit code")
+            assert_equal(len(files), 6, "number of outputs")
+
+    def InvalidJsonStopsLikeSequential(self):
+        # A sequential run writes d1 and d2, then stops at d3. So does a
+        # parallel one, even though its threads may get to d4 to d6 first.
+        with TempDir() as tmp:
+            data = write_json_files(tmp, 6)
+            Path(tmp, "d3.json").write_text("{ name: ")
+            code, output, files = assert_same_as_sequential(
+                ["-b"] + MONSTER_SCHEMA + data, tmp
+            )
+            assert code != 0, "flatc succeeded"
+            assert "d3.json" in output, output
+            assert_equal(sorted(files), ["d1.mon", "d2.mon"], "files written")
+
+    def MissingBinaryStopsLikeSequential(self):
+        with TempDir() as tmp:
+            data = write_json_files(tmp, 4)
+            flatc_ok(["-b", "-o", tmp] + MONSTER_SCHEMA + data, tmp)
+            binaries = ["d1.mon", "d2.mon", "missing.mon", "d3.mon", "d4.mon"]
+            code, output, files = assert_same_as_sequential(
+                ["-t"] + MONSTER_SCHEMA + ["--"] + binaries, tmp
+            )
+            assert code != 0, "flatc succeeded"
+            assert "missing.mon" in output, output
+            assert_equal(sorted(files), ["d1.json", "d2.json"], "files written")
+
+    def SchemasMatchSequential(self):
+        # Both plain generators, which run per schema, and ones that keep
+        # state across schemas: --lua generates from the serialized schema
+        # (and has to come last for that), -b also converts data files,
+        # --rust writes a root file.
+        with TempDir() as tmp:
+            code, _, files = assert_same_as_sequential(
+                ["--cpp", "--python", "--ts", "--rust", "--jsonschema", "-b",
+                 "--schema", "--gen-object-api", "--lua", "-I",
+                 tests_path / "include_test"]
+                + [tests_path / schema for schema in SCHEMAS],
+                tmp,
+            )
+            assert_equal(code, 0, "exit code")
+            assert "alignment_test_generated.h" in files, sorted(files)
+            assert "vector_has_test.bfbs" in files, sorted(files)
+
+    def LaterSchemaParseErrorMatchesSequential(self):
+        # The code for the schemas before the broken one is generated before
+        # its error is reported, as in a sequential run.
+        with TempDir() as tmp:
+            Path(tmp, "broken.fbs").write_text("table Broken { a:int\n")
+            schemas = [tests_path / schema for schema in SCHEMAS]
+            schemas.insert(2, "broken.fbs")
+            code, output, files = assert_same_as_sequential(
+                ["--cpp", "--python", "-I", tests_path / "include_test"]
+                + schemas,
+                tmp,
+            )
+            assert code != 0, "flatc succeeded"
+            assert "broken.fbs" in output, output
+            assert "alignment_test_generated.h" in files, sorted(files)
+            assert "monster_test_generated.h" in files, sorted(files)
+            assert "nested_union_test_generated.h" not in files, sorted(files)
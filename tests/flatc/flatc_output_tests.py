@@ -0,0 +1,133 @@
+# Copyright 2024 Google Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import json
+import os
+from pathlib import Path
+
+from flatc_test import *
+
+# An mtime well in the past, to tell whether flatc wrote a file again.
+OLD_MTIME = 1000000000
+
+
+def read_manifest(path):
+    manifest = json.loads(Path(path).read_text())
+    return (
+        sorted(Path(name).name for name in manifest["changed"]),
+        sorted(Path(name).name for name in manifest["unchanged"]),
+    )
+
+
+class OutputTests:
+    def ManifestListsAllOutputsAsChangedOnFirstRun(self):
+        with TempDir() as out:
+            manifest = Path(out, "manifest.json")
+            flatc_ok(
+                ["--cpp", "--python", "-o", out, "--output-manifest",
+                 manifest, "optional_scalars.fbs"]
+            )
+            changed, unchanged = read_manifest(manifest)
+            assert "optional_scalars_generated.h" in changed, changed
+            assert "ScalarStuff.py" in changed, changed
+            assert_equal(unchanged, [], "unchanged")
+
+    def ManifestWithoutSkipUnchanged(self):
+        with TempDir() as out:
+            manifest = Path(out, "manifest.json")
+            options = ["--cpp", "-o", out, "--output-manifest", manifest,
+                       "-I", "include_test", "optional_scalars.fbs",
+                       "monster_test.fbs"]
+            flatc_ok(options)
+            first_changed, _ = read_manifest(manifest)
+
+            # Nothing changed, so nothing is listed as changed, but every
+            # output is still written.
+            header = Path(out, "optional_scalars_generated.h")
+            os.utime(str(header), (OLD_MTIME, OLD_MTIME))
+            flatc_ok(options)
+            changed, unchanged = read_manifest(manifest)
+            assert_equal(changed, [], "changed")
+            assert_equal(unchanged, first_changed, "unchanged")
+            assert header.stat().st_mtime != OLD_MTIME, "output not written"
+
+            # An output that was edited is restored, and listed as changed.
+            contents = header.read_bytes()
+            header.write_bytes(contents + b"// edited\n")
+            flatc_ok(options)
+            changed, unchanged = read_manifest(manifest)
+            assert_equal(changed, ["optional_scalars_generated.h"], "changed")
+            assert_equal(header.read_bytes(), contents, "restored output")
+            assert "monster_test_generated.h" in unchanged, unchanged
+
+    def SkipUnchangedLeavesOutputsAlone(self):
+        with TempDir() as out:
+            manifest = Path(out, "manifest.json")
+            options = ["--cpp", "-o", out, "--skip-unchanged",
+                       "--output-manifest", manifest, "optional_scalars.fbs"]
+            flatc_ok(options)
+            header = Path(out, "optional_scalars_generated.h")
+            os.utime(str(header), (OLD_MTIME, OLD_MTIME))
+            flatc_ok(options)
+            assert_equal(header.stat().st_mtime, OLD_MTIME, "mtime")
+            assert_equal(
+                read_manifest(manifest),
+                ([], ["optional_scalars_generated.h"]),
+                "manifest",
+            )
+
+    def ManifestWithJobs(self):
+        with TempDir() as out:
+            manifest = Path(out, "manifest.json")
+            options = ["--cpp", "--python", "-o", out, "--output-manifest",
+                       manifest, "-I", "include_test"]
+            schemas = ["optional_scalars.fbs", "monster_test.fbs"]
+            flatc_ok(options + schemas)
+            sequential = read_manifest(manifest)
+            flatc_ok(options + ["--jobs", "4"] + schemas)
+            changed, unchanged = read_manifest(manifest)
+            assert_equal(changed, [], "changed")
+            assert_equal(unchanged, sequential[0], "unchanged")
+
+    def BinaryToTextRoundTrips(self):
+        # -t alone reads the binary where it's mapped; with -b as well, the
+        # binary is copied into the parser first. Both give the same text.
+        with TempDir() as out:
+            schema = ["-I", "include_test", "monster_test.fbs"]
+            flatc_ok(["-b", "-o", out] + schema + ["monsterdata_test.json"])
+            binary = Path(out, "monsterdata_test.mon")
+            text_only = Path(out, "text_only")
+            with_binary = Path(out, "with_binary")
+            flatc_ok(["-t", "--strict-json", "-o", text_only] + schema
+                     + ["--", binary])
+            flatc_ok(["-t", "-b", "--strict-json", "-o", with_binary] + schema
+                     + ["--", binary])
+            text = Path(text_only, "monsterdata_test.json").read_bytes()
+            assert_equal(
+                Path(with_binary, "monsterdata_test.json").read_bytes(),
+                text,
+                "text",
+            )
+            # The text describes the same data: converting it back and forth
+            # gives the same text again.
+            again = Path(out, "again")
+            flatc_ok(["-b", "-o", again] + schema
+                     + [Path(text_only, "monsterdata_test.json")])
+            flatc_ok(["-t", "--strict-json", "-o", again] + schema
+                     + ["--", Path(again, "monsterdata_test.mon")])
+            assert_equal(
+                Path(again, "monsterdata_test.json").read_bytes(),
+                text,
+                "text",
+            )
@@ -0,0 +1,149 @@
+# Copyright 2024 Google Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os
+from pathlib import Path
+
+from flatc_test import *
+
+# An mtime well in the past. flatc writes every output it generates, so an
+# output that keeps it was skipped.
+OLD_MTIME = 1000000000
+
+FOO_FBS = """include "bar.fbs";
+table Foo { bar:Bar; name:string; }
+root_type Foo;
+"""
+
+BAR_FBS = "table Bar { value:int; }\n"
+
+BAZ_FBS = "table Baz { value:float; }\n"
+
+
+# Writes the schemas the tests compile to `path`: foo.fbs, which includes
+# inc/bar.fbs, and baz.fbs.
+def write_schemas(path):
+    Path(path, "inc").mkdir()
+    Path(path, "foo.fbs").write_text(FOO_FBS)
+    Path(path, "inc", "bar.fbs").write_text(BAR_FBS)
+    Path(path, "baz.fbs").write_text(BAZ_FBS)
+
+
+def mark_old(*files):
+    for file in files:
+        os.utime(str(file), (OLD_MTIME, OLD_MTIME))
+
+
+def was_written(file):
+    return Path(file).stat().st_mtime != OLD_MTIME
+
+
+class StampTests:
+    def SkipsUnchangedSchema(self):
+        with TempDir() as tmp:
+            write_schemas(tmp)
+            options = ["--cpp", "-o", "out", "-I", "inc", "--stamp-dir",
+                       "stamps", "foo.fbs", "baz.fbs"]
+            flatc_ok(options, cwd=tmp)
+            foo_h = assert_file_exists("out/foo_generated.h", tmp)
+            baz_h = assert_file_exists("out/baz_generated.h", tmp)
+            mark_old(foo_h, baz_h)
+            flatc_ok(options, cwd=tmp)
+            assert not was_written(foo_h), "foo.fbs was compiled again"
+            assert not was_written(baz_h), "baz.fbs was compiled again"
+
+    def RecompilesWhenIncludeChanges(self):
+        with TempDir() as tmp:
+            write_schemas(tmp)
+            options = ["--cpp", "-o", "out", "-I", "inc", "--stamp-dir",
+                       "stamps", "foo.fbs", "baz.fbs"]
+            flatc_ok(options, cwd=tmp)
+            foo_h = Path(tmp, "out", "foo_generated.h")
+            baz_h = Path(tmp, "out", "baz_generated.h")
+            mark_old(foo_h, baz_h)
+            Path(tmp, "inc", "bar.fbs").write_text(
+                "table Bar { value:int; other:int; }\n"
+            )
+            flatc_ok(options, cwd=tmp)
+            assert was_written(foo_h), "foo.fbs was not compiled again"
+            assert not was_written(baz_h), "baz.fbs was compiled again"
+            assert "other" in foo_h.read_text(), "stale output"
+
+    def RecompilesWhenOptionsChange(self):
+        with TempDir() as tmp:
+            write_schemas(tmp)
+            options = ["--cpp", "-o", "out", "-I", "inc", "--stamp-dir",
+                       "stamps"]
+            flatc_ok(options + ["foo.fbs"], cwd=tmp)
+            foo_h = Path(tmp, "out", "foo_generated.h")
+            mark_old(foo_h)
+            flatc_ok(options + ["--gen-object-api", "foo.fbs"], cwd=tmp)
+            assert was_written(foo_h), "foo.fbs was not compiled again"
+            assert "FooT" in foo_h.read_text(), "stale output"
+
+    def RecompilesWhenOutputIsDeletedOrEdited(self):
+        with TempDir() as tmp:
+            write_schemas(tmp)
+            options = ["--cpp", "-o", "out", "-I", "inc", "--stamp-dir",
+                       "stamps", "foo.fbs"]
+            flatc_ok(options, cwd=tmp)
+            foo_h = Path(tmp, "out", "foo_generated.h")
+            contents = foo_h.read_bytes()
+
+            foo_h.unlink()
+            flatc_ok(options, cwd=tmp)
+            assert_equal(foo_h.read_bytes(), contents, "regenerated output")
+
+            foo_h.write_bytes(contents + b"// edited\n")
+            flatc_ok(options, cwd=tmp)
+            assert_equal(foo_h.read_bytes(), contents, "regenerated output")
+
+    def RelativePathsFromAnotherDirectory(self):
+        # The same command line, run from two directories, writes to two
+        # different output directories, so the second run can't be skipped.
+        with TempDir() as tmp:
+            write_schemas(tmp)
+            first = Path(tmp, "first")
+            second = Path(tmp, "second")
+            first.mkdir()
+            second.mkdir()
+            stamps = Path(tmp, "stamps")
+            options = ["--cpp", "-o", "out", "-I", Path(tmp, "inc"),
+                       "--stamp-dir", stamps, Path(tmp, "foo.fbs")]
+            flatc_ok(options, cwd=first)
+            assert_file_exists("out/foo_generated.h", first)
+            flatc_ok(options, cwd=second)
+            assert_file_exists("out/foo_generated.h", second)
+
+    def SkipsUnchangedSchemaWithJobs(self):
+        with TempDir() as tmp:
+            write_schemas(tmp)
+            options = ["--cpp", "--python", "-o", "out", "-I", "inc",
+                       "--stamp-dir", "stamps", "--jobs", "4", "foo.fbs",
+                       "baz.fbs"]
+            flatc_ok(options, cwd=tmp)
+            foo_h = Path(tmp, "out", "foo_generated.h")
+            baz_h = Path(tmp, "out", "baz_generated.h")
+            foo_py = Path(tmp, "out", "Foo.py")
+            mark_old(foo_h, baz_h, foo_py)
+            flatc_ok(options, cwd=tmp)
+            assert not was_written(foo_h), "foo.fbs was compiled again"
+            assert not was_written(baz_h), "baz.fbs was compiled again"
+
+            # The python output of foo.fbs is recorded in its entry too.
+            foo_py.unlink()
+            flatc_ok(options, cwd=tmp)
+            assert_file_exists(foo_py)
+            assert was_written(foo_h), "foo.fbs was not compiled again"
+            assert not was_written(baz_h), "baz.fbs was compiled again"
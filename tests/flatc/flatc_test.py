@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 Google Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse
+import platform
+import shutil
+import subprocess
+import tempfile
+from pathlib import Path
+
+parser = argparse.ArgumentParser()
+parser.add_argument(
+    "--flatc",
+    help="path of the Flat C compiler relative to the root directory",
+)
+args = parser.parse_args()
+
+# Get the path where this script is located so we can invoke the script from
+# any directory and have the paths work correctly.
+script_path = Path(__file__).parent.resolve()
+
+# Get the root path as an absolute path, so all derived paths are absolute.
+root_path = script_path.parent.parent.absolute()
+
+# The tests directory, which holds the schemas and data the tests use.
+tests_path = Path(root_path, "tests")
+
+# Get the location of the flatc executable, reading from the command line
+# argument or defaulting to default names.
+flatc_exe = Path(
+    ("flatc" if not platform.system() == "Windows" else "flatc.exe")
+    if not args.flatc
+    else args.flatc
+)
+
+# Find and assert flatc compiler is present.
+if root_path in flatc_exe.parents:
+    flatc_exe = flatc_exe.relative_to(root_path)
+flatc_path = Path(root_path, flatc_exe)
+assert flatc_path.exists(), "Cannot find the flatc compiler " + str(flatc_path)
+
+
+# Runs flatc with the given options, and returns its exit code and its output
+# (stdout and stderr together).
+def flatc(options, cwd=tests_path):
+    cmd = [str(flatc_path)] + [str(option) for option in options]
+    result = subprocess.run(
+        cmd,
+        cwd=str(cwd),
+        stdout=subprocess.PIPE,
+        stderr=subprocess.STDOUT,
+        universal_newlines=True,
+    )
+    return result.returncode, result.stdout
+
+
+# Runs flatc with the given options, and asserts that it succeeds.
+def flatc_ok(options, cwd=tests_path):
+    code, output = flatc(options, cwd)
+    assert code == 0, "flatc {0} failed:\n{1}".format(options, output)
+    return output
+
+
+# A fresh directory for the outputs of a test, removed when the test is done.
+class TempDir:
+    def __enter__(self):
+        self.path = Path(tempfile.mkdtemp(prefix="flatc_test_"))
+        return self.path
+
+    def __exit__(self, *exc):
+        shutil.rmtree(str(self.path), ignore_errors=True)
+
+
+# Returns the contents of every file under `path`, keyed by their paths
+# relative to it.
+def read_tree(path):
+    return {
+        str(file.relative_to(path)): file.read_bytes()
+        for file in sorted(Path(path).rglob("*"))
+        if file.is_file()
+    }
+
+
+def assert_file_exists(filename, path=tests_path):
+    file = Path(path, filename)
+    assert file.exists(), "could not find file: " + str(file)
+    return file
+
+
+def assert_file_doesnt_exists(filename, path=tests_path):
+    file = Path(path, filename)
+    assert not file.exists(), "file exists but shouldn't: " + str(file)
+    return file
+
+
+def assert_equal(actual, expected, what="value"):
+    assert actual == expected, "{0}: expected {1!r}, got {2!r}".format(
+        what, expected, actual
+    )
+
+
+# Runs every method of each of the test classes given, printing whether it
+# passed, and returns the number of failing tests.
+def run_all(*modules):
+    failing = 0
+    passing = 0
+    for module in modules:
+        methods = [
+            func
+            for func in dir(module)
+            if callable(getattr(module, func)) and not func.startswith("__")
+        ]
+        module_failing = 0
+        module_passing = 0
+        for method in methods:
+            try:
+                print("{0}.{1}".format(module.__name__, method))
+                getattr(module, method)(module)
+                print(" [PASSED]")
+                module_passing = module_passing + 1
+            except Exception as e:
+                print(" [FAILED]: " + str(e))
+                module_failing = module_failing + 1
+        print(
+            "{0}: {1} of {2} passed".format(
+                module.__name__, module_passing, module_passing + module_failing
+            )
+        )
+        passing = passing + module_passing
+        failing = failing + module_failing
+    print("{0} of {1} tests passed".format(passing, passing + failing))
+    return failing
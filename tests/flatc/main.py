@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+#
+# Copyright 2024 Google Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Runs the tests of the flatc command line, against the flatc given with
+# --flatc (default: the one in the root directory).
+
+import sys
+
+from flatc_test import run_all
+from flatc_annotate_tests import AnnotateTests
+from flatc_stamp_tests import StampTests
+from flatc_jobs_tests import JobsTests
+from flatc_output_tests import OutputTests
+
+failing = run_all(AnnotateTests, JobsTests, OutputTests, StampTests)
+
+sys.exit(1 if failing > 0 else 0)
@@ -1,5 +1,8 @@
 #include "json_test.h"
 
+#include <functional>
+#include <thread>
+
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/idl.h"
 #include "monster_test_bfbs_generated.h"
@@ -203,5 +206,210 @@ root_type JsonUnionStructTest;
   TEST_EQ_STR(json_source, json_generated.c_str());
 }
 
+void JsonNumbersAndEscapesTest() {
+  auto schema = R"(
+table JsonNumbers {
+  b: byte; ub: ubyte; s: short; l: long; ul: ulong;
+  f: float; d: double; whole: double; tiny: double;
+  str: string;
+}
+root_type JsonNumbers;
+)";
+  auto json_source = R"({
+  b: -128,
+  ub: 255,
+  s: -32768,
+  l: -9223372036854775808,
+  ul: 18446744073709551615,
+  f: 3.14159,
+  d: 0.30000000000000004,
+  whole: 42.0,
+  tiny: 1.5e-7,
+  str: "a long run of plain text \"quoted\"\n\ttabbed \\ slashed\u00E9"
+}
+)";
+  // Fixed precision output, matching NumToString / FloatToString.
+  auto json_fixed = R"({
+  b: -128,
+  ub: 255,
+  s: -32768,
+  l: -9223372036854775808,
+  ul: 18446744073709551615,
+  f: 3.14159,
+  d: 0.3,
+  whole: 42.0,
+  tiny: 0.00000015,
+  str: "a long run of plain text \"quoted\"\n\ttabbed \\ slashed\u00E9"
+}
+)";
+  // Shortest round-trip output.
+  auto json_shortest = R"({
+  b: -128,
+  ub: 255,
+  s: -32768,
+  l: -9223372036854775808,
+  ul: 18446744073709551615,
+  f: 3.14159,
+  d: 0.30000000000000004,
+  whole: 42.0,
+  tiny: 1.5e-07,
+  str: "a long run of plain text \"quoted\"\n\ttabbed \\ slashed\u00E9"
+}
+)";
+
+  flatbuffers::Parser parser;
+  TEST_EQ(true, parser.Parse(schema));
+  TEST_EQ(true, parser.ParseJson(json_source));
+
+  std::string json_generated;
+  TEST_NULL(
+      GenText(parser, parser.builder_.GetBufferPointer(), &json_generated));
+  TEST_EQ_STR(json_fixed, json_generated.c_str());
+
+  parser.opts.json_shortest_floats = true;
+  json_generated.clear();
+  TEST_NULL(
+      GenText(parser, parser.builder_.GetBufferPointer(), &json_generated));
+  TEST_EQ_STR(json_shortest, json_generated.c_str());
+
+  // Shortest output must parse back to the exact same buffer.
+  flatbuffers::Parser reparser;
+  TEST_EQ(true, reparser.Parse(schema));
+  TEST_EQ(true, reparser.ParseJson(json_generated.c_str()));
+  TEST_EQ(parser.builder_.GetSize(), reparser.builder_.GetSize());
+  TEST_EQ(0, memcmp(parser.builder_.GetBufferPointer(),
+                    reparser.builder_.GetBufferPointer(),
+                    parser.builder_.GetSize()));
+}
+
+void JsonParallelTest() {
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Deserialize(MyGame::Example::MonsterBinarySchema::data(),
+                             MyGame::Example::MonsterBinarySchema::size()),
+          true);
+
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  std::vector<flatbuffers::Offset<flatbuffers::String>> strings;
+  for (int i = 0; i < 100; i++) {
+    auto name = builder.CreateString("monster" + NumToString(i));
+    const uint8_t inventory[] = { static_cast<uint8_t>(i), 1, 2 };
+    auto inv = builder.CreateVector(inventory, 3);
+    monsters.push_back(CreateMonster(builder, nullptr, 0, 0, name, inv));
+    strings.push_back(builder.CreateString(std::string(i, 'x')));
+  }
+  auto tables = builder.CreateVectorOfSortedTables(&monsters);
+  auto strs = builder.CreateVector(strings);
+  auto name = builder.CreateString("root");
+  MonsterBuilder root(builder);
+  root.add_name(name);
+  root.add_testarrayoftables(tables);
+  root.add_testarrayofstring(strs);
+  FinishMonsterBuffer(builder, root.Finish());
+
+  // Runs every chunk on a thread of its own.
+  const flatbuffers::TextExecutor executor =
+      [](size_t count, const std::function<void(size_t)> &task) {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < count; i++) threads.emplace_back(task, i);
+        for (auto &thread : threads) thread.join();
+      };
+
+  const int indent_steps[] = { 2, 0, -1 };
+  for (auto indent_step : indent_steps) {
+    parser.opts.indent_step = indent_step;
+    std::string serial;
+    TEST_NULL(GenText(parser, builder.GetBufferPointer(), &serial));
+    for (size_t chunks = 1; chunks <= 16; chunks++) {
+      std::string parallel;
+      TEST_NULL(GenTextParallel(parser, builder.GetBufferPointer(), &parallel,
+                                executor, chunks, 8));
+      TEST_EQ_STR(serial.c_str(), parallel.c_str());
+    }
+  }
+}
+
+// Parses `json` with both Parser::ParseJson and JsonTableParser, and checks
+// they agree on the result.
+static void CheckJsonTableParser(flatbuffers::Parser &reference,
+                                 flatbuffers::JsonTableParser &fast,
+                                 flatbuffers::Parser &parser, const char *json,
+                                 bool expect_fallback) {
+  const bool ok = reference.ParseJson(json);
+  TEST_EQ(ok, fast.Parse(json));
+  TEST_EQ(expect_fallback, fast.used_fallback());
+  TEST_EQ_STR(reference.error_.c_str(), parser.error_.c_str());
+  if (!ok) return;
+  TEST_EQ(reference.builder_.GetSize(), parser.builder_.GetSize());
+  TEST_EQ(0, memcmp(reference.builder_.GetBufferPointer(),
+                    parser.builder_.GetBufferPointer(),
+                    parser.builder_.GetSize()));
+}
+
+void JsonTableParserTest(const std::string &tests_data_path) {
+  std::string schemafile;
+  std::string jsonfile;
+  TEST_EQ(flatbuffers::LoadFile((tests_data_path + "monster_test.fbs").c_str(),
+                                false, &schemafile),
+          true);
+  TEST_EQ(
+      flatbuffers::LoadFile((tests_data_path + "monsterdata_test.json").c_str(),
+                            false, &jsonfile),
+      true);
+  auto include_test_path =
+      flatbuffers::ConCatPathFileName(tests_data_path, "include_test");
+  const char *include_directories[] = { tests_data_path.c_str(),
+                                        include_test_path.c_str(), nullptr };
+  flatbuffers::Parser reference;
+  flatbuffers::Parser parser;
+  TEST_EQ(reference.Parse(schemafile.c_str(), include_directories), true);
+  TEST_EQ(parser.Parse(schemafile.c_str(), include_directories), true);
+  flatbuffers::JsonTableParser fast(parser);
+
+  CheckJsonTableParser(reference, fast, parser, jsonfile.c_str(), false);
+  CheckJsonTableParser(reference, fast, parser,
+                       "{ \"name\": \"caf\\u00e9 \\ud83d\\ude00 \\\"q\\\"\\n\","
+                       "  hp: \"-5\", testf: -0, testf2: 1.5e3, color: Red,"
+                       "  inventory: [1, 2,], testarrayofstring2: [],"
+                       "  /* comment */ mana: 7, // comment\n"
+                       "  test_type: MyGame_Example2_Monster, test: {},"
+                       "  testarrayoftables: [{ name: \"b\" }, { name: \"a\" }],"
+                       "  testarrayofsortedstruct: [{ id: 2, distance: 1 }] }",
+                       false);
+  // Structs leave the builder aligned, which shows in the layout of whatever
+  // gets serialized after them.
+  CheckJsonTableParser(reference, fast, parser,
+                       "{ name: \"root\", testarrayoftables: ["
+                       "  { name: \"a\", pos: { x: 1, y: 2, z: 3, test1: 4,"
+                       "    test2: Blue, test3: { a: 5, b: 6 } } },"
+                       "  { name: \"bcd\", test4: [{ a: 1, b: 2 }],"
+                       "    pos: { x: 1, y: 2, z: 3, test1: 4,"
+                       "    test2: Blue, test3: { a: 5, b: 6 } } }] }",
+                       false);
+  parser.opts.skip_unexpected_fields_in_json = true;
+  reference.opts.skip_unexpected_fields_in_json = true;
+  CheckJsonTableParser(reference, fast, parser,
+                       "{ name: \"a\", unknown_field: [1, { x: \"y\" }],"
+                       "  test_type: MyGame_Example2_Monster, test: {} }",
+                       false);
+
+  // Parsed again by ParseJson: a union type after its value, a conversion
+  // function, bit flags, and errors.
+  CheckJsonTableParser(reference, fast, parser,
+                       "{ name: \"a\", test: { name: \"b\" }, test_type: "
+                       "Monster }",
+                       true);
+  CheckJsonTableParser(reference, fast, parser,
+                       "{ name: \"a\", testf: rad(180) }", true);
+  CheckJsonTableParser(reference, fast, parser,
+                       "{ name: \"a\", color: \"Red Blue\" }", true);
+  CheckJsonTableParser(reference, fast, parser, "{ name: \"a\", hp: 1.5 }",
+                       true);
+  CheckJsonTableParser(reference, fast, parser,
+                       "{ name: \"a\", hp: 1, hp: 2 }", true);
+  CheckJsonTableParser(reference, fast, parser, "{ hp: 1 }", true);
+  CheckJsonTableParser(reference, fast, parser, "{ name: \"a\" ", true);
+}
+
 }  // namespace tests
 }  // namespace flatbuffers
@@ -12,6 +12,9 @@ void JsonOptionalTest(const std::string& tests_data_path, bool default_scalars);
 void ParseIncorrectMonsterJsonTest(const std::string& tests_data_path);
 void JsonUnsortedArrayTest();
 void JsonUnionStructTest();
+void JsonNumbersAndEscapesTest();
+void JsonParallelTest();
+void JsonTableParserTest(const std::string& tests_data_path);
 
 }  // namespace tests
 }  // namespace flatbuffers
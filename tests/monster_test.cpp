@@ -23,6 +23,16 @@ static const auto infinity_d = std::numeric_limits<double>::infinity();
 
 using namespace MyGame::Example;
 
+// Counts the allocations a builder makes through it.
+struct CountingAllocator : public DefaultAllocator {
+  CountingAllocator() : allocations(0) {}
+  uint8_t *allocate(size_t size) FLATBUFFERS_OVERRIDE {
+    allocations++;
+    return DefaultAllocator::allocate(size);
+  }
+  int allocations;
+};
+
 // example of how to build up a serialized buffer algorithmically:
 flatbuffers::DetachedBuffer CreateFlatBufferTest(std::string &buffer) {
   flatbuffers::FlatBufferBuilder builder;
@@ -897,5 +907,243 @@ void UnPackTo(const uint8_t *flatbuf) {
   TEST_ASSERT(mon.enemy == nullptr);
 }
 
+void UnPackToReuseTest(const uint8_t *flatbuf) {
+  auto monster = GetMonster(flatbuf);
+  MonsterT mon;
+  monster->UnPackTo(&mon);
+  TEST_NOTNULL(mon.pos);
+  TEST_EQ(mon.test.type, Any_Monster);
+  TEST_EQ(mon.testarrayoftables.size(), 3);
+
+  // Unpacking a buffer of the same shape again reuses the sub-objects,
+  // union value and string and vector storage already there.
+  mon.name.reserve(64);
+  const auto name = mon.name.data();
+  const auto pos = mon.pos.get();
+  const auto test = mon.test.value;
+  const auto inventory = mon.inventory.data();
+  const auto tables = mon.testarrayoftables.data();
+  const auto table = mon.testarrayoftables[1].get();
+  const auto strings = mon.testarrayofstring.data();
+  mon.hp = 0;
+  mon.test.AsMonster()->name = "changed";
+  mon.testarrayoftables[1]->name = "changed";
+  monster->UnPackTo(&mon);
+  TEST_ASSERT(mon.name.data() == name);
+  TEST_ASSERT(mon.pos.get() == pos);
+  TEST_ASSERT(mon.test.value == test);
+  TEST_ASSERT(mon.inventory.data() == inventory);
+  TEST_ASSERT(mon.testarrayoftables.data() == tables);
+  TEST_ASSERT(mon.testarrayoftables[1].get() == table);
+  TEST_ASSERT(mon.testarrayofstring.data() == strings);
+  TEST_EQ_STR(mon.name.c_str(), "MyMonster");
+  TEST_EQ(mon.hp, 80);
+  TEST_EQ_STR(mon.test.AsMonster()->name.c_str(),
+              monster->test_as_Monster()->name()->c_str());
+  TEST_EQ_STR(mon.testarrayoftables[1]->name.c_str(),
+              monster->testarrayoftables()->Get(1)->name()->c_str());
+  TEST_EQ_STR(mon.testarrayofstring[1].c_str(), "fred");
+
+  // Fields absent from the next buffer are reset or cleared.
+  flatbuffers::FlatBufferBuilder fbb;
+  FinishMonsterBuffer(
+      fbb, CreateMonster(fbb, nullptr, 150, 100, fbb.CreateString("bob")));
+  GetMonster(fbb.GetBufferPointer())->UnPackTo(&mon);
+  TEST_EQ_STR(mon.name.c_str(), "bob");
+  TEST_ASSERT(mon.pos == nullptr);
+  TEST_EQ(mon.test.type, Any_NONE);
+  TEST_ASSERT(mon.test.value == nullptr);
+  TEST_EQ(mon.inventory.size(), 0);
+  TEST_EQ(mon.testarrayoftables.size(), 0);
+  TEST_EQ(mon.testarrayofstring.size(), 0);
+}
+
+void PackedSizeTest(const uint8_t *flatbuf) {
+  auto monster = UnPackMonster(flatbuf);
+  flatbuffers::FlatBufferBuilder fbb;
+  FinishMonsterBuffer(fbb, CreateMonster(fbb, monster.get()));
+  const auto packed_size = PackedBufferSize(Monster::PackedSize(*monster));
+  TEST_ASSERT(packed_size >= fbb.GetSize());
+
+  // Pack() grows the buffer to fit the whole object at once.
+  CountingAllocator allocator;
+  flatbuffers::FlatBufferBuilder fbb2(16, &allocator);
+  FinishMonsterBuffer(fbb2, Monster::Pack(fbb2, monster.get()));
+  TEST_EQ(allocator.allocations, 1);
+  TEST_EQ(fbb2.GetSize(), fbb.GetSize());
+  TEST_EQ(memcmp(fbb2.GetBufferPointer(), fbb.GetBufferPointer(),
+                 fbb.GetSize()),
+          0);
+
+  // Packing into caller memory gives the same buffer, at its end.
+  std::vector<uint8_t> mem(packed_size + 64);
+  auto packed = PackMonsterInto(
+      flatbuffers::span<uint8_t>(mem.data(), mem.size()), *monster);
+  TEST_EQ(packed.size(), fbb.GetSize());
+  TEST_ASSERT(packed.data() > mem.data() &&
+              packed.data() + packed.size() <= mem.data() + mem.size());
+  TEST_EQ(memcmp(packed.data(), fbb.GetBufferPointer(), fbb.GetSize()), 0);
+  flatbuffers::Verifier verifier(packed.data(), packed.size());
+  TEST_ASSERT(VerifyMonsterBuffer(verifier));
+
+  // Memory that may be too small is left alone.
+  auto too_small = PackMonsterInto(
+      flatbuffers::span<uint8_t>(mem.data(), fbb.GetSize()), *monster);
+  TEST_ASSERT(too_small.empty());
+
+  // The builder collects the offsets of the vectors of tables, strings and
+  // unions in the region too, so packing needs no memory beyond it.
+  std::vector<uint64_t> region((packed_size + 7) / 8);
+  const auto region_size = region.size() * sizeof(uint64_t);
+  CountingAllocator fallback;
+  FixedAllocator fixed(reinterpret_cast<uint8_t *>(region.data()),
+                       region_size, &fallback);
+  flatbuffers::FlatBufferBuilder fbb3(region_size, &fixed);
+  FinishMonsterBuffer(fbb3, Monster::Pack(fbb3, monster.get()));
+  TEST_EQ(fallback.allocations, 0);
+  TEST_ASSERT(!fixed.overflowed());
+
+  // Should the object outgrow the region, the builder carries on in memory
+  // from the fallback allocator.
+  FixedAllocator small(reinterpret_cast<uint8_t *>(region.data()), 64,
+                       &fallback);
+  flatbuffers::FlatBufferBuilder fbb4(64, &small);
+  FinishMonsterBuffer(fbb4, Monster::Pack(fbb4, monster.get()));
+  TEST_ASSERT(small.overflowed());
+  TEST_ASSERT(fallback.allocations > 0);
+  TEST_EQ(fbb4.GetSize(), fbb.GetSize());
+  TEST_EQ(memcmp(fbb4.GetBufferPointer(), fbb.GetBufferPointer(),
+                 fbb.GetSize()),
+          0);
+}
+
+void CreateVectorByFunctionTest() {
+  // Each monster has a vector of stats, also created by function, whose
+  // vtable offsets are kept in the scratch area in between the offsets of
+  // the monsters.
+  struct State {
+    flatbuffers::FlatBufferBuilder *fbb;
+    size_t monster;
+  };
+  flatbuffers::FlatBufferBuilder fbb;
+  State state = { &fbb, 0 };
+  auto monsters = fbb.CreateVector<Offset<Monster>>(
+      3, [](size_t i, State *s) {
+        s->monster = i;
+        auto stats = s->fbb->CreateVector<Offset<Stat>>(
+            i + 1, [](size_t j, State *t) {
+              return CreateStat(*t->fbb, 0,
+                                static_cast<int64_t>(t->monster * 10 + j + 1));
+            },
+            s);
+        auto name = s->fbb->CreateString(NumToString(i));
+        MonsterBuilder builder(*s->fbb);
+        builder.add_name(name);
+        builder.add_scalar_key_sorted_tables(stats);
+        return builder.Finish();
+      },
+      &state);
+  fbb.Finish(monsters);
+
+  auto vec = GetRoot<Vector<Offset<Monster>>>(fbb.GetBufferPointer());
+  flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_ASSERT(verifier.VerifyVector(vec) && verifier.VerifyVectorOfTables(vec));
+  TEST_EQ(vec->size(), 3);
+  for (uoffset_t i = 0; i < vec->size(); i++) {
+    auto monster = vec->Get(i);
+    TEST_EQ_STR(monster->name()->c_str(), NumToString(i).c_str());
+    TEST_EQ(monster->scalar_key_sorted_tables()->size(), i + 1);
+    for (uoffset_t j = 0; j <= i; j++) {
+      TEST_EQ(monster->scalar_key_sorted_tables()->Get(j)->val(),
+              i * 10 + j + 1);
+    }
+    TEST_ASSERT(reinterpret_cast<const Table *>(monster)->GetVTable() ==
+                reinterpret_cast<const Table *>(vec->Get(0))->GetVTable());
+  }
+
+  // Tables of the same layout still share their vtable, across the vectors
+  // of stats too. The padding of the stats may differ, and with it the size
+  // of the table their vtables hold.
+  std::vector<const uint8_t *> vtables;
+  for (auto monster : *vec) {
+    for (auto stat : *monster->scalar_key_sorted_tables()) {
+      vtables.push_back(reinterpret_cast<const Table *>(stat)->GetVTable());
+    }
+  }
+  size_t shared = 0;
+  for (size_t i = 0; i < vtables.size(); i++) {
+    for (size_t j = 0; j < i; j++) {
+      const auto size = ReadScalar<voffset_t>(vtables[i]);
+      if (size != ReadScalar<voffset_t>(vtables[j]) ||
+          memcmp(vtables[i], vtables[j], size)) {
+        continue;
+      }
+      TEST_ASSERT(vtables[i] == vtables[j]);
+      shared++;
+    }
+  }
+  TEST_ASSERT(shared > 0);
+}
+
+void StructColumnTest(const uint8_t *flatbuf) {
+  auto monster = GetMonster(flatbuf);
+  auto tests = monster->test4();
+  TEST_NOTNULL(tests);
+
+  // Gather a field of every struct into its own array.
+  int16_t a[2] = { 0, 0 };
+  int8_t b[3] = { 0, 0, 99 };
+  TEST_EQ(Test::gather_a(tests, flatbuffers::make_span(a)), 2);
+  TEST_EQ(Test::gather_b(tests, flatbuffers::make_span(b)), 2);
+  TEST_EQ(a[0], 10);
+  TEST_EQ(a[1], 30);
+  TEST_EQ(b[0], 20);
+  TEST_EQ(b[1], 40);
+  TEST_EQ(b[2], 99);  // Past the end of the vector, left alone.
+  TEST_EQ(Test::gather_a(tests, flatbuffers::span<int16_t>(a, 1)), 1);
+  TEST_EQ(Test::gather_a(nullptr, flatbuffers::make_span(a)), 0);
+
+  // Scatter arrays back into structs being built.
+  flatbuffers::FlatBufferBuilder fbb;
+  Test *structs = nullptr;
+  auto vec = fbb.CreateUninitializedVectorOfStructs(2, &structs);
+  auto out = flatbuffers::span<Test>(structs, 2);
+  const int16_t new_a[] = { 1, 2 };
+  const int8_t new_b[] = { 3, 4 };
+  TEST_EQ(Test::scatter_a(flatbuffers::make_span(new_a), out), 2);
+  TEST_EQ(Test::scatter_b(flatbuffers::make_span(new_b), out), 2);
+  fbb.Finish(vec);
+  auto built = flatbuffers::GetRoot<flatbuffers::Vector<const Test *>>(
+      fbb.GetBufferPointer());
+  TEST_EQ(built->Get(0)->a(), 1);
+  TEST_EQ(built->Get(0)->b(), 3);
+  TEST_EQ(built->Get(1)->a(), 2);
+  TEST_EQ(built->Get(1)->b(), 4);
+
+  // Enum and floating point fields round trip through their own types.
+  Vec3 vec3s[2];
+  const Color colors[] = { Color_Blue, Color_Green };
+  const float xs[] = { 1.5f, -2.5f };
+  TEST_EQ(Vec3::scatter_test2(flatbuffers::make_span(colors),
+                              flatbuffers::make_span(vec3s)),
+          2);
+  TEST_EQ(Vec3::scatter_x(flatbuffers::make_span(xs),
+                          flatbuffers::make_span(vec3s)),
+          2);
+  fbb.Clear();
+  fbb.Finish(fbb.CreateVectorOfStructs(vec3s, 2));
+  auto built_vec3s = flatbuffers::GetRoot<flatbuffers::Vector<const Vec3 *>>(
+      fbb.GetBufferPointer());
+  Color colors_out[2] = { Color_Red, Color_Red };
+  float xs_out[2] = { 0, 0 };
+  TEST_EQ(Vec3::gather_test2(built_vec3s, flatbuffers::make_span(colors_out)),
+          2);
+  TEST_EQ(Vec3::gather_x(built_vec3s, flatbuffers::make_span(xs_out)), 2);
+  TEST_EQ(colors_out[0], Color_Blue);
+  TEST_EQ(colors_out[1], Color_Green);
+  TEST_EQ(xs_out[0], 1.5f);
+  TEST_EQ(xs_out[1], -2.5f);
+}
+
 }  // namespace tests
 }  // namespace flatbuffers
@@ -32,6 +32,14 @@ void ParseAndGenerateTextTest(const std::string& tests_data_path, bool binary);
 
 void UnPackTo(const uint8_t *flatbuf);
 
+void UnPackToReuseTest(const uint8_t *flatbuf);
+
+void PackedSizeTest(const uint8_t *flatbuf);
+
+void CreateVectorByFunctionTest();
+
+void StructColumnTest(const uint8_t *flatbuf);
+
 }  // namespace tests
 }  // namespace flatbuffers
 
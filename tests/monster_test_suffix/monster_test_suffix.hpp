@@ -326,7 +326,9 @@ struct AnyUnion {
   }
 
   static void *UnPack(const void *obj, Any type, const ::flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, const ::flatbuffers::resolver_function_t *resolver);
   ::flatbuffers::Offset<void> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t PackedSize() const;
 
   MyGame::Example::MonsterT *AsMonster() {
     return type == Any_Monster ?
@@ -482,7 +484,9 @@ struct AnyUniqueAliasesUnion {
   }
 
   static void *UnPack(const void *obj, AnyUniqueAliases type, const ::flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, const ::flatbuffers::resolver_function_t *resolver);
   ::flatbuffers::Offset<void> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t PackedSize() const;
 
   MyGame::Example::MonsterT *AsM() {
     return type == AnyUniqueAliases_M ?
@@ -596,7 +600,9 @@ struct AnyAmbiguousAliasesUnion {
   void Reset();
 
   static void *UnPack(const void *obj, AnyAmbiguousAliases type, const ::flatbuffers::resolver_function_t *resolver);
+  void UnPackTo(const void *obj, const ::flatbuffers::resolver_function_t *resolver);
   ::flatbuffers::Offset<void> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr) const;
+  size_t PackedSize() const;
 
   MyGame::Example::MonsterT *AsM1() {
     return type == AnyAmbiguousAliases_M1 ?
@@ -956,6 +962,7 @@ struct InParentNamespace FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table
   InParentNamespaceT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(InParentNamespaceT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static ::flatbuffers::Offset<InParentNamespace> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static size_t PackedSize(const InParentNamespaceT &_o);
 };
 
 struct InParentNamespaceBuilder {
@@ -1000,6 +1007,7 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   MonsterT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(MonsterT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static ::flatbuffers::Offset<Monster> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static size_t PackedSize(const MonsterT &_o);
 };
 
 struct MonsterBuilder {
@@ -1057,6 +1065,7 @@ struct TestSimpleTableWithEnum FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::
   TestSimpleTableWithEnumT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(TestSimpleTableWithEnumT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static ::flatbuffers::Offset<TestSimpleTableWithEnum> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static size_t PackedSize(const TestSimpleTableWithEnumT &_o);
 };
 
 struct TestSimpleTableWithEnumBuilder {
@@ -1130,16 +1139,20 @@ struct Stat FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     return static_cast<int>(count() > _count) - static_cast<int>(count() < _count);
   }
   bool Verify(::flatbuffers::Verifier &verifier) const {
+    static const ::flatbuffers::InlineField inline_fields_[] = {
+      { VT_VAL, 8, 8 },
+      { VT_COUNT, 2, 2 },
+    };
     return VerifyTableStart(verifier) &&
+           VerifyInlineFields(verifier, inline_fields_) &&
            VerifyOffset(verifier, VT_ID) &&
            verifier.VerifyString(id()) &&
-           VerifyField<int64_t>(verifier, VT_VAL, 8) &&
-           VerifyField<uint16_t>(verifier, VT_COUNT, 2) &&
            verifier.EndTable();
   }
   StatT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(StatT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static ::flatbuffers::Offset<Stat> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const StatT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static size_t PackedSize(const StatT &_o);
 };
 
 struct StatBuilder {
@@ -1227,6 +1240,7 @@ struct Referrable FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   ReferrableT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(ReferrableT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static ::flatbuffers::Offset<Referrable> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ReferrableT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static size_t PackedSize(const ReferrableT &_o);
 };
 
 struct ReferrableBuilder {
@@ -1809,16 +1823,48 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     return SetField<double>(VT_DOUBLE_INF_DEFAULT, _double_inf_default, std::numeric_limits<double>::infinity());
   }
   bool Verify(::flatbuffers::Verifier &verifier) const {
+    static const ::flatbuffers::InlineField inline_fields_[] = {
+      { VT_POS, 32, 8 },
+      { VT_MANA, 2, 2 },
+      { VT_HP, 2, 2 },
+      { VT_COLOR, 1, 1 },
+      { VT_TEST_TYPE, 1, 1 },
+      { VT_TESTBOOL, 1, 1 },
+      { VT_TESTHASHS32_FNV1, 4, 4 },
+      { VT_TESTHASHU32_FNV1, 4, 4 },
+      { VT_TESTHASHS64_FNV1, 8, 8 },
+      { VT_TESTHASHU64_FNV1, 8, 8 },
+      { VT_TESTHASHS32_FNV1A, 4, 4 },
+      { VT_TESTHASHU32_FNV1A, 4, 4 },
+      { VT_TESTHASHS64_FNV1A, 8, 8 },
+      { VT_TESTHASHU64_FNV1A, 8, 8 },
+      { VT_TESTF, 4, 4 },
+      { VT_TESTF2, 4, 4 },
+      { VT_TESTF3, 4, 4 },
+      { VT_SINGLE_WEAK_REFERENCE, 8, 8 },
+      { VT_CO_OWNING_REFERENCE, 8, 8 },
+      { VT_NON_OWNING_REFERENCE, 8, 8 },
+      { VT_ANY_UNIQUE_TYPE, 1, 1 },
+      { VT_ANY_AMBIGUOUS_TYPE, 1, 1 },
+      { VT_SIGNED_ENUM, 1, 1 },
+      { VT_NATIVE_INLINE, 4, 2 },
+      { VT_LONG_ENUM_NON_ENUM_DEFAULT, 8, 8 },
+      { VT_LONG_ENUM_NORMAL_DEFAULT, 8, 8 },
+      { VT_NAN_DEFAULT, 4, 4 },
+      { VT_INF_DEFAULT, 4, 4 },
+      { VT_POSITIVE_INF_DEFAULT, 4, 4 },
+      { VT_INFINITY_DEFAULT, 4, 4 },
+      { VT_POSITIVE_INFINITY_DEFAULT, 4, 4 },
+      { VT_NEGATIVE_INF_DEFAULT, 4, 4 },
+      { VT_NEGATIVE_INFINITY_DEFAULT, 4, 4 },
+      { VT_DOUBLE_INF_DEFAULT, 8, 8 },
+    };
     return VerifyTableStart(verifier) &&
-           VerifyField<MyGame::Example::Vec3>(verifier, VT_POS, 8) &&
-           VerifyField<int16_t>(verifier, VT_MANA, 2) &&
-           VerifyField<int16_t>(verifier, VT_HP, 2) &&
+           VerifyInlineFields(verifier, inline_fields_) &&
            VerifyOffsetRequired(verifier, VT_NAME) &&
            verifier.VerifyString(name()) &&
            VerifyOffset(verifier, VT_INVENTORY) &&
            verifier.VerifyVector(inventory()) &&
-           VerifyField<uint8_t>(verifier, VT_COLOR, 1) &&
-           VerifyField<uint8_t>(verifier, VT_TEST_TYPE, 1) &&
            VerifyOffset(verifier, VT_TEST) &&
            VerifyAny(verifier, test(), test_type()) &&
            VerifyOffset(verifier, VT_TEST4) &&
@@ -1836,20 +1882,8 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            verifier.VerifyNestedFlatBuffer<MyGame::Example::Monster>(testnestedflatbuffer(), nullptr) &&
            VerifyOffset(verifier, VT_TESTEMPTY) &&
            verifier.VerifyTable(testempty()) &&
-           VerifyField<uint8_t>(verifier, VT_TESTBOOL, 1) &&
-           VerifyField<int32_t>(verifier, VT_TESTHASHS32_FNV1, 4) &&
-           VerifyField<uint32_t>(verifier, VT_TESTHASHU32_FNV1, 4) &&
-           VerifyField<int64_t>(verifier, VT_TESTHASHS64_FNV1, 8) &&
-           VerifyField<uint64_t>(verifier, VT_TESTHASHU64_FNV1, 8) &&
-           VerifyField<int32_t>(verifier, VT_TESTHASHS32_FNV1A, 4) &&
-           VerifyField<uint32_t>(verifier, VT_TESTHASHU32_FNV1A, 4) &&
-           VerifyField<int64_t>(verifier, VT_TESTHASHS64_FNV1A, 8) &&
-           VerifyField<uint64_t>(verifier, VT_TESTHASHU64_FNV1A, 8) &&
            VerifyOffset(verifier, VT_TESTARRAYOFBOOLS) &&
            verifier.VerifyVector(testarrayofbools()) &&
-           VerifyField<float>(verifier, VT_TESTF, 4) &&
-           VerifyField<float>(verifier, VT_TESTF2, 4) &&
-           VerifyField<float>(verifier, VT_TESTF3, 4) &&
            VerifyOffset(verifier, VT_TESTARRAYOFSTRING2) &&
            verifier.VerifyVector(testarrayofstring2()) &&
            verifier.VerifyVectorOfStrings(testarrayofstring2()) &&
@@ -1869,49 +1903,33 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
            VerifyOffset(verifier, VT_VECTOR_OF_REFERRABLES) &&
            verifier.VerifyVector(vector_of_referrables()) &&
            verifier.VerifyVectorOfTables(vector_of_referrables()) &&
-           VerifyField<uint64_t>(verifier, VT_SINGLE_WEAK_REFERENCE, 8) &&
            VerifyOffset(verifier, VT_VECTOR_OF_WEAK_REFERENCES) &&
            verifier.VerifyVector(vector_of_weak_references()) &&
            VerifyOffset(verifier, VT_VECTOR_OF_STRONG_REFERRABLES) &&
            verifier.VerifyVector(vector_of_strong_referrables()) &&
            verifier.VerifyVectorOfTables(vector_of_strong_referrables()) &&
-           VerifyField<uint64_t>(verifier, VT_CO_OWNING_REFERENCE, 8) &&
            VerifyOffset(verifier, VT_VECTOR_OF_CO_OWNING_REFERENCES) &&
            verifier.VerifyVector(vector_of_co_owning_references()) &&
-           VerifyField<uint64_t>(verifier, VT_NON_OWNING_REFERENCE, 8) &&
            VerifyOffset(verifier, VT_VECTOR_OF_NON_OWNING_REFERENCES) &&
            verifier.VerifyVector(vector_of_non_owning_references()) &&
-           VerifyField<uint8_t>(verifier, VT_ANY_UNIQUE_TYPE, 1) &&
            VerifyOffset(verifier, VT_ANY_UNIQUE) &&
            VerifyAnyUniqueAliases(verifier, any_unique(), any_unique_type()) &&
-           VerifyField<uint8_t>(verifier, VT_ANY_AMBIGUOUS_TYPE, 1) &&
            VerifyOffset(verifier, VT_ANY_AMBIGUOUS) &&
            VerifyAnyAmbiguousAliases(verifier, any_ambiguous(), any_ambiguous_type()) &&
            VerifyOffset(verifier, VT_VECTOR_OF_ENUMS) &&
            verifier.VerifyVector(vector_of_enums()) &&
-           VerifyField<int8_t>(verifier, VT_SIGNED_ENUM, 1) &&
            VerifyOffset(verifier, VT_TESTREQUIREDNESTEDFLATBUFFER) &&
            verifier.VerifyVector(testrequirednestedflatbuffer()) &&
            verifier.VerifyNestedFlatBuffer<MyGame::Example::Monster>(testrequirednestedflatbuffer(), nullptr) &&
            VerifyOffset(verifier, VT_SCALAR_KEY_SORTED_TABLES) &&
            verifier.VerifyVector(scalar_key_sorted_tables()) &&
            verifier.VerifyVectorOfTables(scalar_key_sorted_tables()) &&
-           VerifyField<MyGame::Example::Test>(verifier, VT_NATIVE_INLINE, 2) &&
-           VerifyField<uint64_t>(verifier, VT_LONG_ENUM_NON_ENUM_DEFAULT, 8) &&
-           VerifyField<uint64_t>(verifier, VT_LONG_ENUM_NORMAL_DEFAULT, 8) &&
-           VerifyField<float>(verifier, VT_NAN_DEFAULT, 4) &&
-           VerifyField<float>(verifier, VT_INF_DEFAULT, 4) &&
-           VerifyField<float>(verifier, VT_POSITIVE_INF_DEFAULT, 4) &&
-           VerifyField<float>(verifier, VT_INFINITY_DEFAULT, 4) &&
-           VerifyField<float>(verifier, VT_POSITIVE_INFINITY_DEFAULT, 4) &&
-           VerifyField<float>(verifier, VT_NEGATIVE_INF_DEFAULT, 4) &&
-           VerifyField<float>(verifier, VT_NEGATIVE_INFINITY_DEFAULT, 4) &&
-           VerifyField<double>(verifier, VT_DOUBLE_INF_DEFAULT, 8) &&
            verifier.EndTable();
   }
   MonsterT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(MonsterT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static ::flatbuffers::Offset<Monster> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static size_t PackedSize(const MonsterT &_o);
 };
 
 template<> inline const MyGame::Example::Monster *Monster::test_as<MyGame::Example::Monster>() const {
@@ -2525,17 +2543,20 @@ struct TypeAliases FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
     return GetPointer<::flatbuffers::Vector<double> *>(VT_VF64);
   }
   bool Verify(::flatbuffers::Verifier &verifier) const {
+    static const ::flatbuffers::InlineField inline_fields_[] = {
+      { VT_I8, 1, 1 },
+      { VT_U8, 1, 1 },
+      { VT_I16, 2, 2 },
+      { VT_U16, 2, 2 },
+      { VT_I32, 4, 4 },
+      { VT_U32, 4, 4 },
+      { VT_I64, 8, 8 },
+      { VT_U64, 8, 8 },
+      { VT_F32, 4, 4 },
+      { VT_F64, 8, 8 },
+    };
     return VerifyTableStart(verifier) &&
-           VerifyField<int8_t>(verifier, VT_I8, 1) &&
-           VerifyField<uint8_t>(verifier, VT_U8, 1) &&
-           VerifyField<int16_t>(verifier, VT_I16, 2) &&
-           VerifyField<uint16_t>(verifier, VT_U16, 2) &&
-           VerifyField<int32_t>(verifier, VT_I32, 4) &&
-           VerifyField<uint32_t>(verifier, VT_U32, 4) &&
-           VerifyField<int64_t>(verifier, VT_I64, 8) &&
-           VerifyField<uint64_t>(verifier, VT_U64, 8) &&
-           VerifyField<float>(verifier, VT_F32, 4) &&
-           VerifyField<double>(verifier, VT_F64, 8) &&
+           VerifyInlineFields(verifier, inline_fields_) &&
            VerifyOffset(verifier, VT_V8) &&
            verifier.VerifyVector(v8()) &&
            VerifyOffset(verifier, VT_VF64) &&
@@ -2545,6 +2566,7 @@ struct TypeAliases FLATBUFFERS_FINAL_CLASS : private ::flatbuffers::Table {
   TypeAliasesT *UnPack(const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(TypeAliasesT *_o, const ::flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static ::flatbuffers::Offset<TypeAliases> Pack(::flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT* _o, const ::flatbuffers::rehasher_function_t *_rehasher = nullptr);
+  static size_t PackedSize(const TypeAliasesT &_o);
 };
 
 struct TypeAliasesBuilder {
@@ -2686,9 +2708,16 @@ inline void InParentNamespace::UnPackTo(InParentNamespaceT *_o, const ::flatbuff
 }
 
 inline ::flatbuffers::Offset<InParentNamespace> InParentNamespace::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(::flatbuffers::PackedBufferSize(PackedSize(*_o)));
   return CreateInParentNamespace(_fbb, _o, _rehasher);
 }
 
+inline size_t InParentNamespace::PackedSize(const InParentNamespaceT &_o) {
+  (void)_o;
+  size_t _s = ::flatbuffers::PackedTableSize(0, 0);
+  return _s;
+}
+
 inline ::flatbuffers::Offset<InParentNamespace> CreateInParentNamespace(::flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -2721,9 +2750,16 @@ inline void Monster::UnPackTo(MonsterT *_o, const ::flatbuffers::resolver_functi
 }
 
 inline ::flatbuffers::Offset<Monster> Monster::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(::flatbuffers::PackedBufferSize(PackedSize(*_o)));
   return CreateMonster(_fbb, _o, _rehasher);
 }
 
+inline size_t Monster::PackedSize(const MonsterT &_o) {
+  (void)_o;
+  size_t _s = ::flatbuffers::PackedTableSize(0, 0);
+  return _s;
+}
+
 inline ::flatbuffers::Offset<Monster> CreateMonster(::flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -2760,9 +2796,16 @@ inline void TestSimpleTableWithEnum::UnPackTo(TestSimpleTableWithEnumT *_o, cons
 }
 
 inline ::flatbuffers::Offset<TestSimpleTableWithEnum> TestSimpleTableWithEnum::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(::flatbuffers::PackedBufferSize(PackedSize(*_o)));
   return CreateTestSimpleTableWithEnum(_fbb, _o, _rehasher);
 }
 
+inline size_t TestSimpleTableWithEnum::PackedSize(const TestSimpleTableWithEnumT &_o) {
+  (void)_o;
+  size_t _s = ::flatbuffers::PackedTableSize(1, 1);
+  return _s;
+}
+
 inline ::flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnum(::flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -2795,15 +2838,23 @@ inline StatT *Stat::UnPack(const ::flatbuffers::resolver_function_t *_resolver)
 inline void Stat::UnPackTo(StatT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = id(); if (_e) _o->id = _e->str(); }
+  { auto _e = id(); if (_e) { _o->id.assign(_e->c_str(), _e->size()); } else { _o->id.clear(); } }
   { auto _e = val(); _o->val = _e; }
   { auto _e = count(); _o->count = _e; }
 }
 
 inline ::flatbuffers::Offset<Stat> Stat::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const StatT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(::flatbuffers::PackedBufferSize(PackedSize(*_o)));
   return CreateStat(_fbb, _o, _rehasher);
 }
 
+inline size_t Stat::PackedSize(const StatT &_o) {
+  (void)_o;
+  size_t _s = ::flatbuffers::PackedTableSize(3, 25);
+  _s += ::flatbuffers::PackedStringSize(_o.id.length());
+  return _s;
+}
+
 inline ::flatbuffers::Offset<Stat> CreateStat(::flatbuffers::FlatBufferBuilder &_fbb, const StatT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -2842,9 +2893,16 @@ inline void Referrable::UnPackTo(ReferrableT *_o, const ::flatbuffers::resolver_
 }
 
 inline ::flatbuffers::Offset<Referrable> Referrable::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ReferrableT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(::flatbuffers::PackedBufferSize(PackedSize(*_o)));
   return CreateReferrable(_fbb, _o, _rehasher);
 }
 
+inline size_t Referrable::PackedSize(const ReferrableT &_o) {
+  (void)_o;
+  size_t _s = ::flatbuffers::PackedTableSize(1, 15);
+  return _s;
+}
+
 inline ::flatbuffers::Offset<Referrable> CreateReferrable(::flatbuffers::FlatBufferBuilder &_fbb, const ReferrableT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -3060,19 +3118,19 @@ inline MonsterT *Monster::UnPack(const ::flatbuffers::resolver_function_t *_reso
 inline void Monster::UnPackTo(MonsterT *_o, const ::flatbuffers::resolver_function_t *_resolver) const {
   (void)_o;
   (void)_resolver;
-  { auto _e = pos(); if (_e) _o->pos = std::unique_ptr<MyGame::Example::Vec3>(new MyGame::Example::Vec3(*_e)); }
+  { auto _e = pos(); if (_e) { if(_o->pos) { *_o->pos = *_e; } else { _o->pos = std::unique_ptr<MyGame::Example::Vec3>(new MyGame::Example::Vec3(*_e)); } } else if (_o->pos) { _o->pos.reset(); } }
   { auto _e = mana(); _o->mana = _e; }
   { auto _e = hp(); _o->hp = _e; }
-  { auto _e = name(); if (_e) _o->name = _e->str(); }
-  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->inventory.begin()); } }
+  { auto _e = name(); if (_e) { _o->name.assign(_e->c_str(), _e->size()); } else { _o->name.clear(); } }
+  { auto _e = inventory(); if (_e) { _o->inventory.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->inventory.begin()); } else { _o->inventory.resize(0); } }
   { auto _e = color(); _o->color = _e; }
-  { auto _e = test_type(); _o->test.type = _e; }
-  { auto _e = test(); if (_e) _o->test.value = MyGame::Example::AnyUnion::UnPack(_e, test_type(), _resolver); }
+  { auto _e = test_type(); if (_o->test.type != _e) { _o->test.Reset(); _o->test.type = _e; } }
+  { auto _e = test(); if (_e) _o->test.UnPackTo(_e, _resolver); }
   { auto _e = test4(); if (_e) { _o->test4.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->test4[_i] = *_e->Get(_i); } } else { _o->test4.resize(0); } }
-  { auto _e = testarrayofstring(); if (_e) { _o->testarrayofstring.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring[_i] = _e->Get(_i)->str(); } } else { _o->testarrayofstring.resize(0); } }
+  { auto _e = testarrayofstring(); if (_e) { _o->testarrayofstring.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else { _o->testarrayofstring.resize(0); } }
   { auto _e = testarrayoftables(); if (_e) { _o->testarrayoftables.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->testarrayoftables[_i]) { _e->Get(_i)->UnPackTo(_o->testarrayoftables[_i].get(), _resolver); } else { _o->testarrayoftables[_i] = std::unique_ptr<MyGame::Example::MonsterT>(_e->Get(_i)->UnPack(_resolver)); } } } else { _o->testarrayoftables.resize(0); } }
   { auto _e = enemy(); if (_e) { if(_o->enemy) { _e->UnPackTo(_o->enemy.get(), _resolver); } else { _o->enemy = std::unique_ptr<MyGame::Example::MonsterT>(_e->UnPack(_resolver)); } } else if (_o->enemy) { _o->enemy.reset(); } }
-  { auto _e = testnestedflatbuffer(); if (_e) { _o->testnestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testnestedflatbuffer.begin()); } }
+  { auto _e = testnestedflatbuffer(); if (_e) { _o->testnestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testnestedflatbuffer.begin()); } else { _o->testnestedflatbuffer.resize(0); } }
   { auto _e = testempty(); if (_e) { if(_o->testempty) { _e->UnPackTo(_o->testempty.get(), _resolver); } else { _o->testempty = std::unique_ptr<MyGame::Example::StatT>(_e->UnPack(_resolver)); } } else if (_o->testempty) { _o->testempty.reset(); } }
   { auto _e = testbool(); _o->testbool = _e; }
   { auto _e = testhashs32_fnv1(); _o->testhashs32_fnv1 = _e; }
@@ -3087,9 +3145,9 @@ inline void Monster::UnPackTo(MonsterT *_o, const ::flatbuffers::resolver_functi
   { auto _e = testf(); _o->testf = _e; }
   { auto _e = testf2(); _o->testf2 = _e; }
   { auto _e = testf3(); _o->testf3 = _e; }
-  { auto _e = testarrayofstring2(); if (_e) { _o->testarrayofstring2.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring2[_i] = _e->Get(_i)->str(); } } else { _o->testarrayofstring2.resize(0); } }
+  { auto _e = testarrayofstring2(); if (_e) { _o->testarrayofstring2.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofstring2[_i].assign(_e->Get(_i)->c_str(), _e->Get(_i)->size()); } } else { _o->testarrayofstring2.resize(0); } }
   { auto _e = testarrayofsortedstruct(); if (_e) { _o->testarrayofsortedstruct.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->testarrayofsortedstruct[_i] = *_e->Get(_i); } } else { _o->testarrayofsortedstruct.resize(0); } }
-  { auto _e = flex(); if (_e) { _o->flex.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->flex.begin()); } }
+  { auto _e = flex(); if (_e) { _o->flex.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->flex.begin()); } else { _o->flex.resize(0); } }
   { auto _e = test5(); if (_e) { _o->test5.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->test5[_i] = *_e->Get(_i); } } else { _o->test5.resize(0); } }
   { auto _e = vector_of_longs(); if (_e) { _o->vector_of_longs.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_longs[_i] = _e->Get(_i); } } else { _o->vector_of_longs.resize(0); } }
   { auto _e = vector_of_doubles(); if (_e) { _o->vector_of_doubles.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_doubles[_i] = _e->Get(_i); } } else { _o->vector_of_doubles.resize(0); } }
@@ -3102,13 +3160,13 @@ inline void Monster::UnPackTo(MonsterT *_o, const ::flatbuffers::resolver_functi
   { auto _e = vector_of_co_owning_references(); if (_e) { _o->vector_of_co_owning_references.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { /*vector resolver, default_ptr_type*/ if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_co_owning_references[_i]), static_cast<::flatbuffers::hash_value_t>(_e->Get(_i)));/* else do nothing */} } else { _o->vector_of_co_owning_references.resize(0); } }
   { auto _e = non_owning_reference(); /*scalar resolver, naked*/ if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->non_owning_reference), static_cast<::flatbuffers::hash_value_t>(_e)); else _o->non_owning_reference = nullptr; }
   { auto _e = vector_of_non_owning_references(); if (_e) { _o->vector_of_non_owning_references.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { /*vector resolver, naked*/ if (_resolver) (*_resolver)(reinterpret_cast<void **>(&_o->vector_of_non_owning_references[_i]), static_cast<::flatbuffers::hash_value_t>(_e->Get(_i))); else _o->vector_of_non_owning_references[_i] = nullptr; } } else { _o->vector_of_non_owning_references.resize(0); } }
-  { auto _e = any_unique_type(); _o->any_unique.type = _e; }
-  { auto _e = any_unique(); if (_e) _o->any_unique.value = MyGame::Example::AnyUniqueAliasesUnion::UnPack(_e, any_unique_type(), _resolver); }
-  { auto _e = any_ambiguous_type(); _o->any_ambiguous.type = _e; }
-  { auto _e = any_ambiguous(); if (_e) _o->any_ambiguous.value = MyGame::Example::AnyAmbiguousAliasesUnion::UnPack(_e, any_ambiguous_type(), _resolver); }
+  { auto _e = any_unique_type(); if (_o->any_unique.type != _e) { _o->any_unique.Reset(); _o->any_unique.type = _e; } }
+  { auto _e = any_unique(); if (_e) _o->any_unique.UnPackTo(_e, _resolver); }
+  { auto _e = any_ambiguous_type(); if (_o->any_ambiguous.type != _e) { _o->any_ambiguous.Reset(); _o->any_ambiguous.type = _e; } }
+  { auto _e = any_ambiguous(); if (_e) _o->any_ambiguous.UnPackTo(_e, _resolver); }
   { auto _e = vector_of_enums(); if (_e) { _o->vector_of_enums.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vector_of_enums[_i] = static_cast<MyGame::Example::Color>(_e->Get(_i)); } } else { _o->vector_of_enums.resize(0); } }
   { auto _e = signed_enum(); _o->signed_enum = _e; }
-  { auto _e = testrequirednestedflatbuffer(); if (_e) { _o->testrequirednestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testrequirednestedflatbuffer.begin()); } }
+  { auto _e = testrequirednestedflatbuffer(); if (_e) { _o->testrequirednestedflatbuffer.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->testrequirednestedflatbuffer.begin()); } else { _o->testrequirednestedflatbuffer.resize(0); } }
   { auto _e = scalar_key_sorted_tables(); if (_e) { _o->scalar_key_sorted_tables.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { if(_o->scalar_key_sorted_tables[_i]) { _e->Get(_i)->UnPackTo(_o->scalar_key_sorted_tables[_i].get(), _resolver); } else { _o->scalar_key_sorted_tables[_i] = std::unique_ptr<MyGame::Example::StatT>(_e->Get(_i)->UnPack(_resolver)); } } } else { _o->scalar_key_sorted_tables.resize(0); } }
   { auto _e = native_inline(); if (_e) _o->native_inline = *_e; }
   { auto _e = long_enum_non_enum_default(); _o->long_enum_non_enum_default = _e; }
@@ -3124,9 +3182,49 @@ inline void Monster::UnPackTo(MonsterT *_o, const ::flatbuffers::resolver_functi
 }
 
 inline ::flatbuffers::Offset<Monster> Monster::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(::flatbuffers::PackedBufferSize(PackedSize(*_o)));
   return CreateMonster(_fbb, _o, _rehasher);
 }
 
+inline size_t Monster::PackedSize(const MonsterT &_o) {
+  (void)_o;
+  size_t _s = ::flatbuffers::PackedTableSize(61, 493);
+  _s += ::flatbuffers::PackedStringSize(_o.name.length());
+  _s += ::flatbuffers::PackedVectorSize(_o.inventory.size(), 1, 1);
+  _s += _o.test.PackedSize();
+  _s += ::flatbuffers::PackedVectorSize(_o.test4.size(), 4, 2);
+  _s += ::flatbuffers::PackedOffsetVectorSize(_o.testarrayofstring.size());
+  for (size_t _i = 0; _i < _o.testarrayofstring.size(); _i++) _s += ::flatbuffers::PackedStringSize(_o.testarrayofstring[_i].length());
+  _s += ::flatbuffers::PackedOffsetVectorSize(_o.testarrayoftables.size());
+  for (size_t _i = 0; _i < _o.testarrayoftables.size(); _i++) _s += MyGame::Example::Monster::PackedSize(*_o.testarrayoftables[_i].get());
+  if (_o.enemy) _s += MyGame::Example::Monster::PackedSize(*_o.enemy.get());
+  _s += ::flatbuffers::PackedVectorSize(_o.testnestedflatbuffer.size(), 1, 1);
+  if (_o.testempty) _s += MyGame::Example::Stat::PackedSize(*_o.testempty.get());
+  _s += ::flatbuffers::PackedVectorSize(_o.testarrayofbools.size(), 1, 1);
+  _s += ::flatbuffers::PackedOffsetVectorSize(_o.testarrayofstring2.size());
+  for (size_t _i = 0; _i < _o.testarrayofstring2.size(); _i++) _s += ::flatbuffers::PackedStringSize(_o.testarrayofstring2[_i].length());
+  _s += ::flatbuffers::PackedVectorSize(_o.testarrayofsortedstruct.size(), 8, 4);
+  _s += ::flatbuffers::PackedVectorSize(_o.flex.size(), 1, 1);
+  _s += ::flatbuffers::PackedVectorSize(_o.test5.size(), 4, 2);
+  _s += ::flatbuffers::PackedVectorSize(_o.vector_of_longs.size(), 8, 8);
+  _s += ::flatbuffers::PackedVectorSize(_o.vector_of_doubles.size(), 8, 8);
+  if (_o.parent_namespace_test) _s += MyGame::InParentNamespace::PackedSize(*_o.parent_namespace_test.get());
+  _s += ::flatbuffers::PackedOffsetVectorSize(_o.vector_of_referrables.size());
+  for (size_t _i = 0; _i < _o.vector_of_referrables.size(); _i++) _s += MyGame::Example::Referrable::PackedSize(*_o.vector_of_referrables[_i].get());
+  _s += ::flatbuffers::PackedVectorSize(_o.vector_of_weak_references.size(), 8, 8);
+  _s += ::flatbuffers::PackedOffsetVectorSize(_o.vector_of_strong_referrables.size());
+  for (size_t _i = 0; _i < _o.vector_of_strong_referrables.size(); _i++) _s += MyGame::Example::Referrable::PackedSize(*_o.vector_of_strong_referrables[_i].get());
+  _s += ::flatbuffers::PackedVectorSize(_o.vector_of_co_owning_references.size(), 8, 8);
+  _s += ::flatbuffers::PackedVectorSize(_o.vector_of_non_owning_references.size(), 8, 8);
+  _s += _o.any_unique.PackedSize();
+  _s += _o.any_ambiguous.PackedSize();
+  _s += ::flatbuffers::PackedVectorSize(_o.vector_of_enums.size(), 1, 1);
+  _s += ::flatbuffers::PackedVectorSize(_o.testrequirednestedflatbuffer.size(), 1, 1);
+  _s += ::flatbuffers::PackedOffsetVectorSize(_o.scalar_key_sorted_tables.size());
+  for (size_t _i = 0; _i < _o.scalar_key_sorted_tables.size(); _i++) _s += MyGame::Example::Stat::PackedSize(*_o.scalar_key_sorted_tables[_i].get());
+  return _s;
+}
+
 inline ::flatbuffers::Offset<Monster> CreateMonster(::flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -3298,14 +3396,23 @@ inline void TypeAliases::UnPackTo(TypeAliasesT *_o, const ::flatbuffers::resolve
   { auto _e = u64(); _o->u64 = _e; }
   { auto _e = f32(); _o->f32 = _e; }
   { auto _e = f64(); _o->f64 = _e; }
-  { auto _e = v8(); if (_e) { _o->v8.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->v8.begin()); } }
+  { auto _e = v8(); if (_e) { _o->v8.resize(_e->size()); std::copy(_e->begin(), _e->end(), _o->v8.begin()); } else { _o->v8.resize(0); } }
   { auto _e = vf64(); if (_e) { _o->vf64.resize(_e->size()); for (::flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->vf64[_i] = _e->Get(_i); } } else { _o->vf64.resize(0); } }
 }
 
 inline ::flatbuffers::Offset<TypeAliases> TypeAliases::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT* _o, const ::flatbuffers::rehasher_function_t *_rehasher) {
+  _fbb.Reserve(::flatbuffers::PackedBufferSize(PackedSize(*_o)));
   return CreateTypeAliases(_fbb, _o, _rehasher);
 }
 
+inline size_t TypeAliases::PackedSize(const TypeAliasesT &_o) {
+  (void)_o;
+  size_t _s = ::flatbuffers::PackedTableSize(12, 88);
+  _s += ::flatbuffers::PackedVectorSize(_o.v8.size(), 1, 1);
+  _s += ::flatbuffers::PackedVectorSize(_o.vf64.size(), 8, 8);
+  return _s;
+}
+
 inline ::flatbuffers::Offset<TypeAliases> CreateTypeAliases(::flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT *_o, const ::flatbuffers::rehasher_function_t *_rehasher) {
   (void)_rehasher;
   (void)_o;
@@ -3390,6 +3497,31 @@ inline void *AnyUnion::UnPack(const void *obj, Any type, const ::flatbuffers::re
   }
 }
 
+inline void AnyUnion::UnPackTo(const void *obj, const ::flatbuffers::resolver_function_t *resolver) {
+  if (!value) {
+    value = UnPack(obj, type, resolver);
+    return;
+  }
+  switch (type) {
+    case Any_Monster: {
+      auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      ptr->UnPackTo(reinterpret_cast<MyGame::Example::MonsterT *>(value), resolver);
+      break;
+    }
+    case Any_TestSimpleTableWithEnum: {
+      auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnum *>(obj);
+      ptr->UnPackTo(reinterpret_cast<MyGame::Example::TestSimpleTableWithEnumT *>(value), resolver);
+      break;
+    }
+    case Any_MyGame_Example2_Monster: {
+      auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+      ptr->UnPackTo(reinterpret_cast<MyGame::Example2::MonsterT *>(value), resolver);
+      break;
+    }
+    default: break;
+  }
+}
+
 inline ::flatbuffers::Offset<void> AnyUnion::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ::flatbuffers::rehasher_function_t *_rehasher) const {
   (void)_rehasher;
   switch (type) {
@@ -3409,6 +3541,21 @@ inline ::flatbuffers::Offset<void> AnyUnion::Pack(::flatbuffers::FlatBufferBuild
   }
 }
 
+inline size_t AnyUnion::PackedSize() const {
+  switch (type) {
+    case Any_Monster: {
+      return MyGame::Example::Monster::PackedSize(*reinterpret_cast<const MyGame::Example::MonsterT *>(value));
+    }
+    case Any_TestSimpleTableWithEnum: {
+      return MyGame::Example::TestSimpleTableWithEnum::PackedSize(*reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnumT *>(value));
+    }
+    case Any_MyGame_Example2_Monster: {
+      return MyGame::Example2::Monster::PackedSize(*reinterpret_cast<const MyGame::Example2::MonsterT *>(value));
+    }
+    default: return 0;
+  }
+}
+
 inline AnyUnion::AnyUnion(const AnyUnion &u) : type(u.type), value(nullptr) {
   switch (type) {
     case Any_Monster: {
@@ -3503,6 +3650,31 @@ inline void *AnyUniqueAliasesUnion::UnPack(const void *obj, AnyUniqueAliases typ
   }
 }
 
+inline void AnyUniqueAliasesUnion::UnPackTo(const void *obj, const ::flatbuffers::resolver_function_t *resolver) {
+  if (!value) {
+    value = UnPack(obj, type, resolver);
+    return;
+  }
+  switch (type) {
+    case AnyUniqueAliases_M: {
+      auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      ptr->UnPackTo(reinterpret_cast<MyGame::Example::MonsterT *>(value), resolver);
+      break;
+    }
+    case AnyUniqueAliases_TS: {
+      auto ptr = reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnum *>(obj);
+      ptr->UnPackTo(reinterpret_cast<MyGame::Example::TestSimpleTableWithEnumT *>(value), resolver);
+      break;
+    }
+    case AnyUniqueAliases_M2: {
+      auto ptr = reinterpret_cast<const MyGame::Example2::Monster *>(obj);
+      ptr->UnPackTo(reinterpret_cast<MyGame::Example2::MonsterT *>(value), resolver);
+      break;
+    }
+    default: break;
+  }
+}
+
 inline ::flatbuffers::Offset<void> AnyUniqueAliasesUnion::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ::flatbuffers::rehasher_function_t *_rehasher) const {
   (void)_rehasher;
   switch (type) {
@@ -3522,6 +3694,21 @@ inline ::flatbuffers::Offset<void> AnyUniqueAliasesUnion::Pack(::flatbuffers::Fl
   }
 }
 
+inline size_t AnyUniqueAliasesUnion::PackedSize() const {
+  switch (type) {
+    case AnyUniqueAliases_M: {
+      return MyGame::Example::Monster::PackedSize(*reinterpret_cast<const MyGame::Example::MonsterT *>(value));
+    }
+    case AnyUniqueAliases_TS: {
+      return MyGame::Example::TestSimpleTableWithEnum::PackedSize(*reinterpret_cast<const MyGame::Example::TestSimpleTableWithEnumT *>(value));
+    }
+    case AnyUniqueAliases_M2: {
+      return MyGame::Example2::Monster::PackedSize(*reinterpret_cast<const MyGame::Example2::MonsterT *>(value));
+    }
+    default: return 0;
+  }
+}
+
 inline AnyUniqueAliasesUnion::AnyUniqueAliasesUnion(const AnyUniqueAliasesUnion &u) : type(u.type), value(nullptr) {
   switch (type) {
     case AnyUniqueAliases_M: {
@@ -3616,6 +3803,31 @@ inline void *AnyAmbiguousAliasesUnion::UnPack(const void *obj, AnyAmbiguousAlias
   }
 }
 
+inline void AnyAmbiguousAliasesUnion::UnPackTo(const void *obj, const ::flatbuffers::resolver_function_t *resolver) {
+  if (!value) {
+    value = UnPack(obj, type, resolver);
+    return;
+  }
+  switch (type) {
+    case AnyAmbiguousAliases_M1: {
+      auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      ptr->UnPackTo(reinterpret_cast<MyGame::Example::MonsterT *>(value), resolver);
+      break;
+    }
+    case AnyAmbiguousAliases_M2: {
+      auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      ptr->UnPackTo(reinterpret_cast<MyGame::Example::MonsterT *>(value), resolver);
+      break;
+    }
+    case AnyAmbiguousAliases_M3: {
+      auto ptr = reinterpret_cast<const MyGame::Example::Monster *>(obj);
+      ptr->UnPackTo(reinterpret_cast<MyGame::Example::MonsterT *>(value), resolver);
+      break;
+    }
+    default: break;
+  }
+}
+
 inline ::flatbuffers::Offset<void> AnyAmbiguousAliasesUnion::Pack(::flatbuffers::FlatBufferBuilder &_fbb, const ::flatbuffers::rehasher_function_t *_rehasher) const {
   (void)_rehasher;
   switch (type) {
@@ -3635,6 +3847,21 @@ inline ::flatbuffers::Offset<void> AnyAmbiguousAliasesUnion::Pack(::flatbuffers:
   }
 }
 
+inline size_t AnyAmbiguousAliasesUnion::PackedSize() const {
+  switch (type) {
+    case AnyAmbiguousAliases_M1: {
+      return MyGame::Example::Monster::PackedSize(*reinterpret_cast<const MyGame::Example::MonsterT *>(value));
+    }
+    case AnyAmbiguousAliases_M2: {
+      return MyGame::Example::Monster::PackedSize(*reinterpret_cast<const MyGame::Example::MonsterT *>(value));
+    }
+    case AnyAmbiguousAliases_M3: {
+      return MyGame::Example::Monster::PackedSize(*reinterpret_cast<const MyGame::Example::MonsterT *>(value));
+    }
+    default: return 0;
+  }
+}
+
 inline AnyAmbiguousAliasesUnion::AnyAmbiguousAliasesUnion(const AnyAmbiguousAliasesUnion &u) : type(u.type), value(nullptr) {
   switch (type) {
     case AnyAmbiguousAliases_M1: {
@@ -4168,6 +4395,11 @@ inline const MyGame::Example::Monster *GetMonster(const void *buf) {
   return ::flatbuffers::GetRoot<MyGame::Example::Monster>(buf);
 }
 
+inline const MyGame::Example::Monster *GetMonster(
+    const ::flatbuffers::TrustedBuffer<MyGame::Example::Monster> &buf) {
+  return ::flatbuffers::GetRoot(buf);
+}
+
 inline const MyGame::Example::Monster *GetSizePrefixedMonster(const void *buf) {
   return ::flatbuffers::GetSizePrefixedRoot<MyGame::Example::Monster>(buf);
 }
@@ -4204,6 +4436,12 @@ inline bool VerifySizePrefixedMonsterBuffer(
   return verifier.VerifySizePrefixedBuffer<MyGame::Example::Monster>(MonsterIdentifier());
 }
 
+inline ::flatbuffers::TrustedBuffer<MyGame::Example::Monster> TrustMonsterBuffer(
+    ::flatbuffers::DetachedBuffer &&buf) {
+  return ::flatbuffers::TrustedBuffer<MyGame::Example::Monster>::Verify(
+      std::move(buf), MonsterIdentifier());
+}
+
 inline const char *MonsterExtension() {
   return "mon";
 }
@@ -4220,6 +4458,12 @@ inline void FinishSizePrefixedMonsterBuffer(
   fbb.FinishSizePrefixed(root, MonsterIdentifier());
 }
 
+inline ::flatbuffers::TrustedBuffer<MyGame::Example::Monster> FinishAndReleaseMonsterBuffer(
+    ::flatbuffers::FlatBufferBuilder &fbb,
+    ::flatbuffers::Offset<MyGame::Example::Monster> root) {
+  return fbb.FinishAndRelease(root, MonsterIdentifier());
+}
+
 inline std::unique_ptr<MyGame::Example::MonsterT> UnPackMonster(
     const void *buf,
     const ::flatbuffers::resolver_function_t *res = nullptr) {
@@ -4232,6 +4476,14 @@ inline std::unique_ptr<MyGame::Example::MonsterT> UnPackSizePrefixedMonster(
   return std::unique_ptr<MyGame::Example::MonsterT>(GetSizePrefixedMonster(buf)->UnPack(res));
 }
 
+inline ::flatbuffers::span<uint8_t> PackMonsterInto(
+    ::flatbuffers::span<uint8_t> buf,
+    const MyGame::Example::MonsterT &_o,
+    const ::flatbuffers::rehasher_function_t *_rehasher = nullptr) {
+  return ::flatbuffers::PackInto<MyGame::Example::Monster>(
+      buf, _o, MonsterIdentifier(), _rehasher);
+}
+
 }  // namespace Example
 }  // namespace MyGame
 
@@ -106,6 +106,25 @@ void ErrorTest() {
   TestError("union X { Y }", "referenced");
   TestError("union Z { X } struct X { Y:int; }", "only tables");
   TestError("table X { Y:[int]; YLength:int; }", "clash");
+  TestError("table X (fixed_layout) { y:int = null; }", "be optional");
+  TestError("table X (fixed_layout) { y:string; }", "must be required");
+  TestError("struct Y { a:int; } table X (fixed_layout) { y:Y; }",
+            "must be required");
+  TestError("table Y {} union Z { Y } table X (fixed_layout) { z:Z; }",
+            "be a union");
+  TestError("table X { y:[int] (columnar); }", "vector of tables");
+  TestError("struct Y { a:int; } table X { y:[Y] (columnar); }",
+            "vector of tables");
+  TestError("table Y { a:[int]; } table X { y:[Y] (columnar); }",
+            "must be a non-optional scalar");
+  TestError("table Y { a:int = null; } table X { y:[Y] (columnar); }",
+            "must be a non-optional scalar");
+  TestError(
+      "table Y { a:string; a_present:int; } table X { y:[Y] (columnar); }",
+      "clashes with the presence column");
+  TestError(
+      "table Y { a:int; } table YColumns {} table X { y:[Y] (columnar); }",
+      "clashes with existing type");
   TestError("table X { Y:byte; } root_type X; { Y:1, Y:2 }", "more than once");
   // float to integer conversion is forbidden
   TestError("table X { Y:int; } root_type X; { Y:1.0 }", "float");
@@ -746,6 +765,51 @@ void UnicodeTest() {
               "\\u5225\\u30B5\\u30A4\\u30C8\\u20AC\\u0080\\uD83D\\uDE0E\"}");
 }
 
+void StringTokenTest() {
+  // Strings without escape sequences are taken straight from the source, the
+  // others from where the lexer decoded them. Either may be a field name, or
+  // be changed by the parser before it is used.
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse("table T { a:string; b:string; c:float; d:int; "
+                       "e:double; }"
+                       "root_type T;"
+                       "{ a: \"plain\", \"\\u0062\": \"x\\ty\", "
+                       "c: -infinity, d: \"7  \", e: \"1.5\" }"),
+          true);
+  std::string jsongen;
+  parser.opts.indent_step = -1;
+  auto result = GenText(parser, parser.builder_.GetBufferPointer(), &jsongen);
+  TEST_NULL(result);
+  TEST_EQ_STR(jsongen.c_str(),
+              "{a: \"plain\",b: \"x\\ty\",c: -inf,d: 7,e: 1.5}");
+}
+
+void UnionStringTokenTest() {
+  // The union value is parsed after scanning ahead for its type, and then
+  // coming back to it. The decoded text of the escaped string it starts with
+  // must survive the tokens read on the way.
+  flatbuffers::IDLOptions opts;
+  opts.lang_to_generate = flatbuffers::IDLOptions::kJson;
+  flatbuffers::Parser parser(opts);
+  TEST_EQ(parser.Parse(
+              "table T { a:int; }"
+              "union U { T, S:string }"
+              "table R { s:string; a_long_union_field_name_to_grow_buffers:U; }"
+              "root_type R;"
+              "{ s: \"a\\tb\", "
+              "a_long_union_field_name_to_grow_buffers: \"x\\ty\", "
+              "a_long_union_field_name_to_grow_buffers_type: \"S\" }"),
+          true);
+  std::string jsongen;
+  parser.opts.indent_step = -1;
+  auto result = GenText(parser, parser.builder_.GetBufferPointer(), &jsongen);
+  TEST_NULL(result);
+  TEST_EQ_STR(jsongen.c_str(),
+              "{s: \"a\\tb\","
+              "a_long_union_field_name_to_grow_buffers_type: \"S\","
+              "a_long_union_field_name_to_grow_buffers: \"x\\ty\"}");
+}
+
 void UnicodeTestAllowNonUTF8() {
   flatbuffers::Parser parser;
   parser.opts.allow_non_utf8 = true;
@@ -17,6 +17,8 @@ void EnumValueTest();
 void IntegerBoundaryTest();
 void ValidFloatTest();
 void UnicodeTest();
+void StringTokenTest();
+void UnionStringTokenTest();
 void UnicodeTestAllowNonUTF8();
 void UnicodeTestGenerateTextFailsOnNonUTF8();
 void UnicodeSurrogatesTest();
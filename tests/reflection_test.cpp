@@ -233,6 +233,51 @@ void ReflectionTest(const std::string &tests_data_path, uint8_t *flatbuf,
   SetFieldT(*rroot, name_field, string_ptr);
   TEST_EQ_STR(GetFieldS(**rroot, name_field)->c_str(), "hank");
 
+  // Many resizing edits can also be batched, such that the buffer only gets
+  // walked and moved once, no matter how many edits there are.
+  std::vector<uint8_t> batchbuf(flatbuf, flatbuf + length);
+  auto bmonster = GetMonster(batchbuf.data());
+  flatbuffers::ResizeBatch batch(schema, &batchbuf);
+  batch.SetString("Batched", bmonster->name());
+  // These strings are shared, so they change in two places each.
+  batch.SetString("a string much longer than bob",
+                  bmonster->testarrayofstring()->Get(0));
+  batch.SetString("", bmonster->testarrayofstring()->Get(1));
+  batch.SetString("Wilma Flintstone",
+                  bmonster->testarrayoftables()->Get(2)->name());
+  batch.ResizeVector<uint8_t>(20, 50, bmonster->inventory());
+  batch.ResizeAnyVector(
+      1, reinterpret_cast<const VectorOfAny *>(bmonster->test4()),
+      bmonster->test4()->size(), static_cast<uoffset_t>(sizeof(Test)));
+  TEST_EQ(batch.size(), 6);
+  batch.Apply();
+  TEST_EQ(batch.size(), 0);
+  flatbuffers::Verifier batch_verifier(batchbuf.data(), batchbuf.size());
+  TEST_EQ(VerifyMonsterBuffer(batch_verifier), true);
+  TEST_EQ(flatbuffers::Verify(schema, *schema.root_table(), batchbuf.data(),
+                              batchbuf.size()),
+          true);
+  bmonster = GetMonster(batchbuf.data());
+  TEST_EQ_STR(bmonster->name()->c_str(), "Batched");
+  TEST_EQ(bmonster->hp(), 80);
+  TEST_EQ_STR(bmonster->testarrayofstring()->Get(0)->c_str(),
+              "a string much longer than bob");
+  TEST_EQ_STR(bmonster->testarrayofstring()->Get(1)->c_str(), "");
+  TEST_EQ_STR(bmonster->testarrayofstring()->Get(2)->c_str(),
+              "a string much longer than bob");
+  TEST_EQ_STR(bmonster->testarrayofstring()->Get(3)->c_str(), "");
+  TEST_EQ_STR(bmonster->testarrayofstring2()->Get(1)->c_str(), "mary");
+  TEST_EQ_STR(bmonster->testarrayoftables()->Get(0)->name()->c_str(),
+              "Barney");
+  TEST_EQ_STR(bmonster->testarrayoftables()->Get(2)->name()->c_str(),
+              "Wilma Flintstone");
+  TEST_EQ(bmonster->inventory()->size(), 20);
+  TEST_EQ(bmonster->inventory()->Get(9), 9);
+  TEST_EQ(bmonster->inventory()->Get(10), 50);
+  TEST_EQ(bmonster->test4()->size(), 1);
+  TEST_EQ(bmonster->test4()->Get(0)->a(), 10);
+  TEST_EQ_STR(bmonster->test_as_Monster()->name()->c_str(), "Fred");
+
   // Using reflection, rather than mutating binary FlatBuffers, we can also copy
   // tables and other things out of other FlatBuffers into a FlatBufferBuilder,
   // either part or whole.
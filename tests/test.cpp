@@ -27,7 +27,9 @@
 #endif
 
 #include "alignment_test.h"
+#include "columnar_test.h"
 #include "evolution_test.h"
+#include "fixed_layout_test.h"
 #include "flatbuffers/flatbuffers.h"
 #include "flatbuffers/idl.h"
 #include "flatbuffers/minireflect.h"
@@ -1229,6 +1231,80 @@ void NestedVerifierTest() {
   }
 }
 
+void InlineFieldsVerifierTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  const Vec3 pos(1, 2, 3, 0, Color_Red, Test(10, 20));
+  FinishMonsterBuffer(builder, CreateMonster(builder, &pos, 150, 80,
+                                             builder.CreateString("Inline")));
+  std::vector<uint8_t> buf(builder.GetBufferPointer(),
+                           builder.GetBufferPointer() + builder.GetSize());
+  {
+    flatbuffers::Verifier verifier(buf.data(), buf.size());
+    TEST_EQ(true, VerifyMonsterBuffer(verifier));
+  }
+
+  // The scalars of Monster are checked together, so move one of them around
+  // through its vtable entry.
+  const auto table = reinterpret_cast<const uint8_t *>(GetMonster(buf.data()));
+  const auto vtable =
+      reinterpret_cast<const flatbuffers::Table *>(table)->GetVTable();
+  const auto hp_entry = buf.data() + (vtable - buf.data()) + Monster::VT_HP;
+  const auto hp_offset = flatbuffers::ReadScalar<flatbuffers::voffset_t>(
+      hp_entry);
+  TEST_ASSERT(hp_offset != 0);
+
+  // Past the end of the buffer.
+  flatbuffers::WriteScalar(
+      hp_entry, static_cast<flatbuffers::voffset_t>(
+                    buf.data() + buf.size() - table - 1));
+  {
+    flatbuffers::Verifier verifier(buf.data(), buf.size());
+    TEST_EQ(false, VerifyMonsterBuffer(verifier));
+  }
+
+  // Misaligned, which only fails when alignment is checked.
+  flatbuffers::WriteScalar(
+      hp_entry, static_cast<flatbuffers::voffset_t>(hp_offset + 1));
+  {
+    flatbuffers::Verifier verifier(buf.data(), buf.size());
+    TEST_EQ(false, VerifyMonsterBuffer(verifier));
+    flatbuffers::Verifier::Options options;
+    options.check_alignment = false;
+    flatbuffers::Verifier unaligned(buf.data(), buf.size(), options);
+    TEST_EQ(true, VerifyMonsterBuffer(unaligned));
+  }
+}
+
+void TrustedBufferTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  auto trusted = FinishAndReleaseMonsterBuffer(
+      builder, CreateMonster(builder, nullptr, 150, 80,
+                             builder.CreateString("Trusted")));
+  TEST_EQ(trusted.empty(), false);
+  TEST_EQ(builder.GetSize(), 0u);
+  TEST_EQ(GetMonster(trusted)->hp(), 80);
+  TEST_EQ_STR(GetMonster(trusted)->name()->c_str(), "Trusted");
+
+  // Giving it up and verifying it again makes it trusted again.
+  flatbuffers::DetachedBuffer released = trusted.Release();
+  TEST_EQ(trusted.empty(), true);
+  TEST_NULL(trusted.root());
+  auto verified = TrustMonsterBuffer(std::move(released));
+  TEST_EQ(verified.empty(), false);
+  TEST_NULL(released.data());
+  TEST_EQ_STR(GetMonster(verified)->name()->c_str(), "Trusted");
+
+  // A buffer that fails to verify is left with the caller.
+  flatbuffers::DetachedBuffer corrupt = verified.Release();
+  const size_t size = corrupt.size();
+  flatbuffers::WriteScalar<flatbuffers::uoffset_t>(
+      corrupt.data(), static_cast<flatbuffers::uoffset_t>(size));
+  auto rejected = TrustMonsterBuffer(std::move(corrupt));
+  TEST_EQ(rejected.empty(), true);
+  TEST_NULL(GetMonster(rejected));
+  TEST_EQ(corrupt.size(), size);
+}
+
 template<class T, class Container>
 void TestIterators(const std::vector<T> &expected, const Container &tested) {
   TEST_ASSERT(tested.rbegin().base() == tested.end());
@@ -1482,6 +1558,49 @@ void VectorSpanTest() {
   }
 }
 
+void CreateVectorFromSpanTest() {
+  flatbuffers::FlatBufferBuilder builder;
+
+  const uint8_t inventory[] = { 0, 1, 2, 3, 4 };
+  const Test tests[] = { Test(10, 20), Test(30, 40) };
+  std::vector<std::string> names;
+  for (int i = 0; i < 100; i++) names.push_back(NumToString(i * 7));
+  auto inventory_vec = builder.CreateVector(
+      flatbuffers::span<const uint8_t>(inventory, 5));
+  auto tests_vec = builder.CreateVectorOfStructs(
+      flatbuffers::span<const Test>(tests, 2));
+  auto names_vec = builder.CreateVectorOfStrings(
+      flatbuffers::span<const std::string>(names.data(), names.size()));
+  auto name = builder.CreateString("Span");
+
+  MonsterBuilder mb(builder);
+  mb.add_name(name);
+  mb.add_inventory(inventory_vec);
+  mb.add_test4(tests_vec);
+  mb.add_testarrayofstring(names_vec);
+  FinishMonsterBuffer(builder, mb.Finish());
+
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(), builder.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  auto monster = GetMonster(builder.GetBufferPointer());
+  TEST_EQ(monster->inventory()->size(), 5u);
+  TEST_EQ(monster->inventory()->Get(4), 4);
+  TEST_EQ(monster->test4()->size(), 2u);
+  TEST_EQ(monster->test4()->Get(1)->a(), 30);
+  auto strings = monster->testarrayofstring();
+  TEST_EQ(strings->size(), names.size());
+  for (flatbuffers::uoffset_t i = 0; i < strings->size(); i++) {
+    TEST_EQ_STR(strings->Get(i)->c_str(), names[i].c_str());
+  }
+  // The strings are laid out in the same order as the vector.
+  TEST_ASSERT(strings->Get(0)->c_str() < strings->Get(1)->c_str());
+
+  // Empty spans make empty vectors.
+  auto empty = builder.CreateVectorOfStrings(
+      flatbuffers::span<const std::string>(names.data(), 0));
+  TEST_EQ(flatbuffers::GetTemporaryPointer(builder, empty)->size(), 0u);
+}
+
 void NativeInlineTableVectorTest() {
   TestNativeInlineTableT test;
   for (int i = 0; i < 10; ++i) {
@@ -1613,6 +1732,10 @@ int FlatBufferTests(const std::string &tests_data_path) {
 
   ObjectFlatBuffersTest(flatbuf.data());
   UnPackTo(flatbuf.data());
+  UnPackToReuseTest(flatbuf.data());
+  PackedSizeTest(flatbuf.data());
+  CreateVectorByFunctionTest();
+  StructColumnTest(flatbuf.data());
 
   MiniReflectFlatBuffersTest(flatbuf.data());
   MiniReflectFixedLengthArrayTest();
@@ -1620,6 +1743,8 @@ int FlatBufferTests(const std::string &tests_data_path) {
   SizePrefixedTest();
 
   AlignmentTest();
+  FixedLayoutTest();
+  ColumnarTest();
 
 #ifndef FLATBUFFERS_NO_FILE_TESTS
   ParseAndGenerateTextTest(tests_data_path, false);
@@ -1644,6 +1769,9 @@ int FlatBufferTests(const std::string &tests_data_path) {
   FixedLengthArraySpanTest(tests_data_path);
   DoNotRequireEofTest(tests_data_path);
   JsonUnionStructTest();
+  JsonNumbersAndEscapesTest();
+  JsonParallelTest();
+  JsonTableParserTest(tests_data_path);
 #else
   // Guard against -Wunused-parameter.
   (void)tests_data_path;
@@ -1665,6 +1793,8 @@ int FlatBufferTests(const std::string &tests_data_path) {
   IntegerOutOfRangeTest();
   IntegerBoundaryTest();
   UnicodeTest();
+  StringTokenTest();
+  UnionStringTokenTest();
   UnicodeTestAllowNonUTF8();
   UnicodeTestGenerateTextFailsOnNonUTF8();
   UnicodeSurrogatesTest();
@@ -1684,7 +1814,10 @@ int FlatBufferTests(const std::string &tests_data_path) {
   UninitializedVectorTest();
   EqualOperatorTest();
   NumericUtilsTest();
+  NumberRoundTripTest();
   IsAsciiUtilsTest();
+  SaveFileIfChangedTest();
+  MappedFileTest();
   ValidFloatTest();
   InvalidFloatTest();
   FixedLengthArrayTest();
@@ -1700,9 +1833,12 @@ int FlatBufferTests(const std::string &tests_data_path) {
   FlatbuffersIteratorsTest();
   WarningsAsErrorsTest();
   NestedVerifierTest();
+  InlineFieldsVerifierTest();
+  TrustedBufferTest();
   PrivateAnnotationsLeaks();
   JsonUnsortedArrayTest();
   VectorSpanTest();
+  CreateVectorFromSpanTest();
   NativeInlineTableVectorTest();
   FixedSizedScalarKeyInStructTest();
   StructKeyInStructTest();
@@ -1,5 +1,6 @@
 #include "test_builder.h"
 
+#include "flatbuffers/builder_pool.h"
 #include "flatbuffers/flatbuffer_builder.h"
 #include "flatbuffers/stl_emulation.h"
 #include "monster_test_generated.h"
@@ -118,6 +119,55 @@ bool release_n_verify(flatbuffers::FlatBufferBuilder &fbb,
   return verify(buf, expected_name, color);
 }
 
+void BuilderPoolTest() {
+  BuilderPool pool(256);
+  TEST_EQ(pool.InitialSize(), 256u);
+
+  // A released buffer goes back to the pool when it is destroyed, and the
+  // next builder gets it.
+  const uint8_t *block_end = nullptr;
+  {
+    FlatBufferBuilder fbb = pool.NewBuilder();
+    fbb.Finish(populate1(fbb));
+    DetachedBuffer buf = fbb.Release();
+    TEST_ASSERT_FUNC(verify(buf, m1_name(), m1_color()));
+    TEST_EQ(pool.cached_bytes(), 0u);
+    block_end = buf.data() + buf.size();
+  }
+  TEST_EQ(pool.cached_bytes(), 256u);
+  {
+    FlatBufferBuilder fbb = pool.NewBuilder();
+    fbb.Finish(populate2(fbb));
+    TEST_EQ(pool.cached_bytes(), 0u);
+    TEST_EQ(fbb.GetBufferPointer() + fbb.GetSize(), block_end);
+  }
+  TEST_EQ(pool.cached_bytes(), 256u);
+
+  // Builders start out as big as a builder recently had to grow to, and
+  // smaller again once messages are small for a while.
+  {
+    FlatBufferBuilder fbb = pool.NewBuilder();
+    std::vector<uint8_t> inventory(10000);
+    auto name = fbb.CreateString("big");
+    fbb.Finish(CreateMonster(fbb, nullptr, 0, 0, name,
+                             fbb.CreateVector(inventory)));
+  }
+  const size_t big = pool.InitialSize();
+  TEST_ASSERT(big >= 10000u);
+  for (int i = 0; i < 100; i++) {
+    FlatBufferBuilder fbb = pool.NewBuilder();
+    fbb.Finish(populate1(fbb));
+  }
+  TEST_EQ(pool.InitialSize(), 256u);
+
+  // Trim() frees what was idle since the last Trim().
+  TEST_ASSERT(pool.cached_bytes() > 0u);
+  pool.Trim();
+  TEST_ASSERT(pool.cached_bytes() > 0u);
+  pool.Trim();
+  TEST_EQ(pool.cached_bytes(), 0u);
+}
+
 // forward-declared in test.cpp
 void FlatBufferBuilderTest();
 
@@ -140,6 +190,8 @@ void FlatBufferBuilderTest() {
       TestSelector(tests, tests + 4));
   BuilderReuseTests<GrpcLikeMessageBuilder, GrpcLikeMessageBuilder>::run_tests(
       TestSelector(tests, tests + 4));
+
+  BuilderPoolTest();
 }
 
 // forward-declared in test_builder.h
@@ -50,6 +50,8 @@ bool release_n_verify(flatbuffers::FlatBufferBuilder &fbb,
 bool release_n_verify(flatbuffers::grpc::MessageBuilder &mbb,
                       const std::string &expected_name, Color color);
 
+void BuilderPoolTest();
+
 // Invokes this function when testing the following Builder types
 // FlatBufferBuilder, TestHeapBuilder, and GrpcLikeMessageBuilder
 template<class Builder>
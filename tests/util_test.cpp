@@ -1,5 +1,13 @@
 #include "util_test.h"
 
+#include <clocale>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
 #include "flatbuffers/util.h"
 #include "test_assert.h"
 
@@ -32,6 +40,76 @@ void NumericUtilsTestFloat(const char *lower, const char *upper) {
   TEST_EQ(flatbuffers::StringToNumber(lower, &f), true);
   TEST_EQ(f, -flatbuffers::numeric_limits<T>::infinity());
 }
+
+// splitmix64, so the randomized tests are reproducible everywhere.
+uint64_t NextRandom(uint64_t *state) {
+  uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+template<typename T> uint64_t Bits(T v) {
+  uint64_t bits = 0;
+  memcpy(&bits, &v, sizeof(v));
+  return bits;
+}
+
+// What StringToNumber returned before its fast paths.
+double ReferenceParse(const char *s, double *) { return strtod(s, nullptr); }
+float ReferenceParse(const char *s, float *) {
+#if defined(FLATBUFFERS_LOCALE_INDEPENDENT) && \
+    (FLATBUFFERS_LOCALE_INDEPENDENT > 0)
+  return strtof(s, nullptr);
+#else
+  return static_cast<float>(strtod(s, nullptr));
+#endif
+}
+
+// What FloatToString returned before its fast path.
+template<typename T> std::string ReferenceFormat(T t, int precision) {
+  std::stringstream ss;
+  ss << std::fixed << std::setprecision(precision) << t;
+  auto s = ss.str();
+  auto p = s.find_last_not_of('0');
+  if (p != std::string::npos) s.resize(p + (s[p] == '.' ? 2 : 1));
+  return s;
+}
+
+template<typename T> void CheckParse(const std::string &s) {
+  T val;
+  TEST_EQ(StringToNumber(s.c_str(), &val), true);
+  TEST_EQ(Bits(val), Bits(ReferenceParse(s.c_str(), &val)));
+}
+
+template<typename T> void CheckFormat(T val, int precision) {
+  TEST_EQ_STR(FloatToString(val, precision).c_str(),
+              ReferenceFormat(val, precision).c_str());
+}
+
+// A random plain decimal: sign, digits, fraction and exponent all optional.
+std::string RandomDecimal(uint64_t *state) {
+  std::string s;
+  const auto r = NextRandom(state);
+  if (r & 1) s += (r & 2) ? '-' : '+';
+  const int int_digits = static_cast<int>((r >> 2) % 21);
+  const int frac_digits = static_cast<int>((r >> 8) % 21);
+  for (int i = 0; i < int_digits; i++) {
+    s += static_cast<char>('0' + NextRandom(state) % 10);
+  }
+  if (!int_digits || (r & 0x4000)) {
+    s += '.';
+    for (int i = 0; i < frac_digits || (!int_digits && !i); i++) {
+      s += static_cast<char>('0' + NextRandom(state) % 10);
+    }
+  }
+  if (r & 0x8000) {
+    s += (r & 0x10000) ? 'e' : 'E';
+    if (r & 0x20000) s += (r & 0x40000) ? '-' : '+';
+    s += NumToString((r >> 20) % 40);
+  }
+  return s;
+}
 }  // namespace
 
 void NumericUtilsTest() {
@@ -44,6 +122,62 @@ void NumericUtilsTest() {
   NumericUtilsTestFloat<float>("-1.7977e+308", "+1.7977e+308");
 }
 
+void NumberRoundTripTest() {
+  // The references below follow the C locale.
+  const auto lc = localeconv();
+  if (!lc || !lc->decimal_point || strcmp(lc->decimal_point, ".") != 0) {
+    return;
+  }
+  uint64_t state = 0x5EED;
+  char buf[64];
+  for (int i = 0; i < 100000; i++) {
+    // Plain decimals take the fast paths, or fall back to strtod.
+    const auto decimal = RandomDecimal(&state);
+    CheckParse<double>(decimal);
+    CheckParse<float>(decimal);
+
+    // Parse every double printed with up to 17 significant digits.
+    double d;
+    do {
+      const auto bits = NextRandom(&state);
+      memcpy(&d, &bits, sizeof(d));
+    } while (!std::isfinite(d));
+    snprintf(buf, sizeof(buf), "%.*g", 1 + static_cast<int>(i % 17), d);
+    CheckParse<double>(buf);
+    CheckParse<float>(buf);
+
+    // Integers of every length, including those that overflow.
+    const auto r = NextRandom(&state);
+    auto digits = NumToString(r);
+    digits = digits.substr(r % digits.size());
+    int64_t i64;
+    const auto ok = StringToNumber(digits.c_str(), &i64);
+    errno = 0;
+    const auto ref = strtoll(digits.c_str(), nullptr, 10);
+    TEST_EQ(ok, errno == 0);
+    TEST_EQ(i64, ref);
+    uint64_t u64;
+    TEST_EQ(StringToNumber(digits.c_str(), &u64), true);
+    TEST_EQ(u64, strtoull(digits.c_str(), nullptr, 10));
+
+    // Fixed point formatting: random bit patterns, which are mostly huge or
+    // tiny, dyadic fractions m / 2^k, which include exact ties, and decimal
+    // fractions n / 10^k.
+    CheckFormat(d, 12);
+    CheckFormat(static_cast<float>(d), 6);
+    const auto m = NextRandom(&state) >> (11 + r % 53);
+    const auto dyadic = std::ldexp(static_cast<double>(m), -(i % 75));
+    CheckFormat(dyadic, 12);
+    CheckFormat(-dyadic, 12);
+    CheckFormat(static_cast<float>(dyadic), 6);
+    CheckFormat(dyadic, i % 18);
+    const auto dec = static_cast<double>(m % 100000000000ULL) /
+                     std::pow(10.0, static_cast<double>(i % 23));
+    CheckFormat(dec, 12);
+    CheckFormat(static_cast<float>(dec), 6);
+  }
+}
+
 void IsAsciiUtilsTest() {
   char c = -128;
   for (int cnt = 0; cnt < 256; cnt++) {
@@ -171,5 +305,49 @@ void UtilConvertCase() {
   }
 }
 
+void SaveFileIfChangedTest() {
+  const char *name = "save_file_if_changed_test.tmp";
+  std::remove(name);
+  for (int binary = 0; binary < 2; binary++) {
+    bool changed = false;
+    TEST_EQ(SaveFileIfChanged(name, "abc", 3, binary != 0, &changed), true);
+    TEST_EQ(changed, true);
+    TEST_EQ(SaveFileIfChanged(name, "abc", 3, binary != 0, &changed), true);
+    TEST_EQ(changed, false);
+    // Same size, different contents.
+    TEST_EQ(SaveFileIfChanged(name, "abd", 3, binary != 0, &changed), true);
+    TEST_EQ(changed, true);
+    TEST_EQ(SaveFileIfChanged(name, "ab", 2, binary != 0, &changed), true);
+    TEST_EQ(changed, true);
+    std::string contents;
+    TEST_EQ(LoadFile(name, binary != 0, &contents), true);
+    TEST_EQ_STR(contents.c_str(), "ab");
+    TEST_EQ(SaveFileIfChanged(name, "", 0, binary != 0, &changed), true);
+    TEST_EQ(changed, true);
+    TEST_EQ(SaveFileIfChanged(name, "", 0, binary != 0, nullptr), true);
+  }
+  std::remove(name);
+}
+
+void MappedFileTest() {
+  const char *name = "mapped_file_test.tmp";
+  const std::string data("\x01\x00\xff binary\n", 11);
+  TEST_EQ(SaveFile(name, data, true), true);
+  MappedFile file;
+  TEST_EQ(file.Open(name), true);
+  TEST_EQ(file.size(), data.size());
+  TEST_EQ(memcmp(file.data(), data.data(), data.size()), 0);
+  // Empty files can't be mapped, but still open.
+  TEST_EQ(SaveFile(name, "", 0, true), true);
+  TEST_EQ(file.Open(name), true);
+  TEST_EQ(file.size(), 0u);
+  TEST_EQ(file.mapped(), false);
+  file.Close();
+  TEST_EQ(file.data() == nullptr, true);
+  std::remove(name);
+  TEST_EQ(file.Open(name), false);
+  TEST_EQ(file.size(), 0u);
+}
+
 }  // namespace tests
 }  // namespace flatbuffers
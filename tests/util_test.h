@@ -5,8 +5,11 @@ namespace flatbuffers {
 namespace tests {
 
 void NumericUtilsTest();
+void NumberRoundTripTest();
 void IsAsciiUtilsTest();
 void UtilConvertCase();
+void SaveFileIfChangedTest();
+void MappedFileTest();
 
 
 }  // namespace tests